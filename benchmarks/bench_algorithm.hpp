@@ -0,0 +1,121 @@
+#pragma once
+
+#include "algorithm.hpp"
+#include "benchmark.hpp"
+#include "list.hpp"
+#include "vector.hpp"
+
+class BenchAlgorithm {
+   public:
+    static void run_vectorized(size_t element_budget) {
+        Benchmark::start_group("find/count/equal/lexicographical_compare: generic (vector iterators) vs contiguous (pointers), uint8_t");
+        for (size_t n : {size_t{16}, size_t{256}, size_t{4096}, size_t{65536}, size_t{1} << 20})
+            run_vectorized_templated<uint8_t>(n, element_budget);
+
+        Benchmark::start_group("find/count/equal/lexicographical_compare: generic (vector iterators) vs contiguous (pointers), int32_t");
+        for (size_t n : {size_t{16}, size_t{256}, size_t{4096}, size_t{65536}, size_t{1} << 20})
+            run_vectorized_templated<int32_t>(n, element_budget);
+    }
+
+    static void run_comparison(size_t element_budget) {
+        Benchmark::start_group("container comparison (equal containers, so every element is visited)");
+        for (size_t n : {size_t{16}, size_t{4096}, size_t{1} << 20}) {
+            run_comparison_templated<lw_std::vector<uint8_t>>("vector<uint8_t>", n, element_budget);
+            run_comparison_templated<lw_std::vector<int>>("vector<int>", n, element_budget);
+            run_comparison_templated<lw_std::list<int>>("list<int>", n, element_budget);
+        }
+    }
+
+   private:
+    template <typename T>
+    static void reserve(lw_std::vector<T>& c, size_t n) {
+        c.reserve(n);
+    }
+
+    template <typename T>
+    static void reserve(lw_std::list<T>&, size_t) {}
+
+    template <typename Container>
+    static void run_comparison_templated(const char* name, size_t n, size_t element_budget) {
+        Container a;
+        reserve(a, n);
+        for (size_t i = 0; i < n; ++i)
+            a.push_back(static_cast<typename Container::value_type>(i));
+        Container b = a;
+
+        size_t repetitions = element_budget / n + 1;
+        char label[64];
+
+        std::snprintf(label, sizeof(label), "%s operator<", name);
+        Benchmark::report(label, n, Benchmark::ns_per_op(repetitions, [&] {
+                              for (size_t i = 0; i < repetitions; ++i)
+                                  Benchmark::do_not_optimize(a < b);
+                          }));
+
+        std::snprintf(label, sizeof(label), "%s operator<=", name);
+        Benchmark::report(label, n, Benchmark::ns_per_op(repetitions, [&] {
+                              for (size_t i = 0; i < repetitions; ++i)
+                                  Benchmark::do_not_optimize(a <= b);
+                          }));
+
+        std::snprintf(label, sizeof(label), "%s lexicographical_compare", name);
+        Benchmark::report(label, n, Benchmark::ns_per_op(repetitions, [&] {
+                              for (size_t i = 0; i < repetitions; ++i)
+                                  Benchmark::do_not_optimize(lw_std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+                          }));
+    }
+
+    template <typename T>
+    static void run_vectorized_templated(size_t n, size_t element_budget) {
+        // NOTE: every call scans the whole range: the value is only at the end and the ranges only differ in the last element
+        lw_std::vector<T> a(n, T{1});
+        lw_std::vector<T> b(n, T{1});
+        a[n - 1] = T{2};
+        b[n - 1] = T{3};
+
+        const T* a_first = a.data();
+        const T* a_last = a.data() + n;
+        const T* b_first = b.data();
+        const T* b_last = b.data() + n;
+
+        const T value{2};
+        size_t repetitions = element_budget / n + 1;
+        size_t bytes = n * sizeof(T);
+
+        Benchmark::report_throughput("find (generic)", n, bytes, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t i = 0; i < repetitions; ++i)
+                                             Benchmark::do_not_optimize(lw_std::find(a.begin(), a.end(), value) == a.end());
+                                     }));
+        Benchmark::report_throughput("find (contiguous)", n, bytes, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t i = 0; i < repetitions; ++i)
+                                             Benchmark::do_not_optimize(lw_std::find(a_first, a_last, value));
+                                     }));
+
+        Benchmark::report_throughput("count (generic)", n, bytes, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t i = 0; i < repetitions; ++i)
+                                             Benchmark::do_not_optimize(lw_std::count(a.begin(), a.end(), value));
+                                     }));
+        Benchmark::report_throughput("count (contiguous)", n, bytes, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t i = 0; i < repetitions; ++i)
+                                             Benchmark::do_not_optimize(lw_std::count(a_first, a_last, value));
+                                     }));
+
+        Benchmark::report_throughput("equal (generic)", n, 2 * bytes, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t i = 0; i < repetitions; ++i)
+                                             Benchmark::do_not_optimize(lw_std::equal(a.begin(), a.end(), b.begin()));
+                                     }));
+        Benchmark::report_throughput("equal (contiguous)", n, 2 * bytes, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t i = 0; i < repetitions; ++i)
+                                             Benchmark::do_not_optimize(lw_std::equal(a_first, a_last, b_first));
+                                     }));
+
+        Benchmark::report_throughput("lexicographical_compare (generic)", n, 2 * bytes, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t i = 0; i < repetitions; ++i)
+                                             Benchmark::do_not_optimize(lw_std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+                                     }));
+        Benchmark::report_throughput("lexicographical_compare (contiguous)", n, 2 * bytes, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t i = 0; i < repetitions; ++i)
+                                             Benchmark::do_not_optimize(lw_std::lexicographical_compare(a_first, a_last, b_first, b_last));
+                                     }));
+    }
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "benchmark.hpp"
+#include "dynamic_bitset.hpp"
+#include "vector.hpp"
+
+class BenchBitset {
+   public:
+    static void run(size_t flag_budget) {
+        Benchmark::start_group("presence flags, byte per flag vs dynamic_bitset, ns per flag");
+        for (size_t size : {size_t{1} << 12, size_t{1} << 18, size_t{1} << 22})
+            run_templated(size, flag_budget);
+    }
+
+   private:
+    static void run_templated(size_t size, size_t flag_budget) {
+        size_t repetitions = flag_budget / size + 1;
+
+        lw_std::vector<uint8_t> byte_a(size, uint8_t{0});
+        lw_std::vector<uint8_t> byte_b(size, uint8_t{0});
+        lw_std::dynamic_bitset bits_a(size);
+        lw_std::dynamic_bitset bits_b(size);
+
+        for (size_t i = 0; i < size; ++i) {
+            bool a = (Benchmark::rng()() & 1) != 0;
+            bool b = (Benchmark::rng()() & 3) == 0;
+            byte_a[i] = a;
+            byte_b[i] = b;
+            bits_a.set(i, a);
+            bits_b.set(i, b);
+        }
+
+        Benchmark::report("vector<uint8_t> count", size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              for (size_t r = 0; r < repetitions; ++r)
+                                  Benchmark::do_not_optimize(lw_std::count(byte_a.data(), byte_a.data() + size, uint8_t{1}));
+                          }));
+
+        Benchmark::report("dynamic_bitset count", size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              for (size_t r = 0; r < repetitions; ++r)
+                                  Benchmark::do_not_optimize(bits_a.count());
+                          }));
+
+        Benchmark::report("vector<uint8_t> and", size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  for (size_t i = 0; i < size; ++i)
+                                      byte_a[i] = static_cast<uint8_t>(byte_a[i] & byte_b[i]);
+                                  Benchmark::do_not_optimize(byte_a.data());
+                              }
+                          }));
+
+        Benchmark::report("dynamic_bitset operator&=", size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  bits_a &= bits_b;
+                                  Benchmark::do_not_optimize(bits_a.blocks());
+                              }
+                          }));
+
+        // NOTE: walks the set flags of the sparser set
+        Benchmark::report("vector<uint8_t> visit set flags", size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  size_t sum = 0;
+                                  for (size_t i = 0; i < size; ++i)
+                                      if (byte_b[i] != 0) sum += i;
+                                  Benchmark::do_not_optimize(sum);
+                              }
+                          }));
+
+        Benchmark::report("dynamic_bitset find_first/find_next", size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  size_t sum = 0;
+                                  for (auto i = bits_b.find_first(); i != lw_std::dynamic_bitset::npos; i = bits_b.find_next(i))
+                                      sum += i;
+                                  Benchmark::do_not_optimize(sum);
+                              }
+                          }));
+    }
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "charconv.hpp"
+#include "vector.hpp"
+
+// NOTE: numeric samples to text and back, to_chars/from_chars vs the printf and strto* functions they replace;
+//       "%.17g" is what snprintf needs to round trip every double, to_chars writes the shortest digits that do
+class BenchCharconv {
+   public:
+    static void run(size_t operation_count) {
+        Benchmark::start_group("charconv: to_chars/from_chars vs snprintf/strtol/strtod");
+
+        std::vector<int> integers(1024);
+        std::vector<double> doubles(1024);
+        std::uniform_int_distribution<int> int_dist(-1000000, 1000000);
+        std::uniform_real_distribution<double> double_dist(-1000.0, 1000.0);
+        for (size_t i = 0; i < integers.size(); ++i) {
+            integers[i] = int_dist(Benchmark::rng());
+            doubles[i] = double_dist(Benchmark::rng());
+        }
+
+        char buffer[64];
+        Benchmark::report("snprintf %d", integers.size(), Benchmark::ns_per_op(operation_count, [&] {
+                              for (size_t i = 0; i < operation_count; ++i) {
+                                  snprintf(buffer, sizeof(buffer), "%d", integers[i % integers.size()]);
+                                  Benchmark::do_not_optimize(buffer);
+                              }
+                          }));
+
+        Benchmark::report("to_chars int", integers.size(), Benchmark::ns_per_op(operation_count, [&] {
+                              for (size_t i = 0; i < operation_count; ++i) {
+                                  auto res = lw_std::to_chars(buffer, buffer + sizeof(buffer), integers[i % integers.size()]);
+                                  Benchmark::do_not_optimize(res.ptr);
+                              }
+                          }));
+
+        size_t double_count = operation_count / 4;
+        Benchmark::report("snprintf %.17g", doubles.size(), Benchmark::ns_per_op(double_count, [&] {
+                              for (size_t i = 0; i < double_count; ++i) {
+                                  snprintf(buffer, sizeof(buffer), "%.17g", doubles[i % doubles.size()]);
+                                  Benchmark::do_not_optimize(buffer);
+                              }
+                          }));
+
+        Benchmark::report("to_chars double", doubles.size(), Benchmark::ns_per_op(double_count, [&] {
+                              for (size_t i = 0; i < double_count; ++i) {
+                                  auto res = lw_std::to_chars(buffer, buffer + sizeof(buffer), doubles[i % doubles.size()]);
+                                  Benchmark::do_not_optimize(res.ptr);
+                              }
+                          }));
+
+        // NOTE: one line with all samples, as it is parsed back
+        auto line_of = [](const auto& values) {
+            lw_std::vector<char> line;
+            for (auto value : values) {
+                lw_std::append_chars(line, value);
+                line.push_back(' ');
+            }
+            line.push_back('\0');
+            return line;
+        };
+
+        lw_std::vector<char> int_line = line_of(integers);
+        Benchmark::report("strtol", integers.size(), Benchmark::ns_per_op(operation_count, [&] {
+                              char* last = int_line.data() + int_line.size() - 1;
+                              for (size_t i = 0; i < operation_count;)
+                                  for (char* pos = int_line.data(); pos != last && i < operation_count; ++i) {
+                                      long value = strtol(pos, &pos, 10);
+                                      ++pos;
+                                      Benchmark::do_not_optimize(value);
+                                  }
+                          }));
+
+        Benchmark::report("from_chars int", integers.size(), Benchmark::ns_per_op(operation_count, [&] {
+                              const char* last = int_line.data() + int_line.size() - 1;
+                              for (size_t i = 0; i < operation_count;)
+                                  for (const char* pos = int_line.data(); pos != last && i < operation_count; ++i) {
+                                      int value = 0;
+                                      pos = lw_std::from_chars(pos, last, value).ptr + 1;
+                                      Benchmark::do_not_optimize(value);
+                                  }
+                          }));
+
+        lw_std::vector<char> double_line = line_of(doubles);
+        Benchmark::report("strtod", doubles.size(), Benchmark::ns_per_op(double_count, [&] {
+                              char* last = double_line.data() + double_line.size() - 1;
+                              for (size_t i = 0; i < double_count;)
+                                  for (char* pos = double_line.data(); pos != last && i < double_count; ++i) {
+                                      double value = strtod(pos, &pos);
+                                      ++pos;
+                                      Benchmark::do_not_optimize(value);
+                                  }
+                          }));
+
+        Benchmark::report("from_chars double", doubles.size(), Benchmark::ns_per_op(double_count, [&] {
+                              const char* last = double_line.data() + double_line.size() - 1;
+                              for (size_t i = 0; i < double_count;)
+                                  for (const char* pos = double_line.data(); pos != last && i < double_count; ++i) {
+                                      double value = 0;
+                                      pos = lw_std::from_chars(pos, last, value).ptr + 1;
+                                      Benchmark::do_not_optimize(value);
+                                  }
+                          }));
+    }
+};
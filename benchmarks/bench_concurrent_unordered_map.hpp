@@ -0,0 +1,108 @@
+#pragma once
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "concurrent_unordered_map.hpp"
+#include "unordered_map.hpp"
+
+class BenchConcurrentUnorderedMap {
+   public:
+    static void run_scaling(size_t operation_budget) {
+        Benchmark::start_group("mixed find/update (90%/10%) from n threads on 4096 keys, ns per operation (wall clock)");
+        for (size_t thread_count : {size_t{1}, size_t{2}, size_t{4}, size_t{8}, size_t{16}, size_t{32}}) {
+            run_global_lock(thread_count, operation_budget);
+            run_striped<16>(thread_count, operation_budget);
+            run_striped<64>(thread_count, operation_budget);
+        }
+    }
+
+   private:
+    static constexpr size_t key_count = 4096;
+
+    // NOTE: random keys, consecutive integers would give the single map a collision free table (identity hash)
+    static const std::vector<int>& keys() {
+        static std::vector<int> res = [] {
+            std::vector<int> k(key_count);
+            for (auto& key : k)
+                key = static_cast<int>(Benchmark::rng()() >> 1);
+            return k;
+        }();
+        return res;
+    }
+
+    // NOTE: the same pseudo random sequence of keys and operations for every map, different per thread
+    template <typename Find, typename Update>
+    static double run_threads(size_t thread_count, size_t operation_budget, Find find, Update update) {
+        size_t per_thread = operation_budget / thread_count;
+
+        return Benchmark::ns_per_op(per_thread * thread_count, [&] {
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < thread_count; ++t)
+                threads.emplace_back([&, t] {
+                    unsigned state = static_cast<unsigned>(t) * 2654435761u + 1;
+                    long long sum = 0;
+                    for (size_t i = 0; i < per_thread; ++i) {
+                        state = state * 1664525u + 1013904223u;
+                        int key = keys()[(state >> 8) % key_count];
+                        if ((state >> 22) % 10 != 0)
+                            sum += find(key);
+                        else
+                            update(key);
+                    }
+                    Benchmark::do_not_optimize(sum);
+                });
+
+            for (auto& thread : threads)
+                thread.join();
+        });
+    }
+
+    static void run_global_lock(size_t thread_count, size_t operation_budget) {
+        std::mutex lock;
+        lw_std::unordered_map<int, int> c;
+        // NOTE: about half full, the load factor of both maps is the same
+        c.reserve(2 * key_count);
+        for (int key : keys())
+            c.emplace(key, key);
+
+        double ns = run_threads(
+            thread_count, operation_budget,
+            [&](int key) {
+                std::lock_guard<std::mutex> guard(lock);
+                return c.find(key)->second;
+            },
+            [&](int key) {
+                std::lock_guard<std::mutex> guard(lock);
+                ++c.find(key)->second;
+            });
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "mutex + unordered_map, %zu threads", thread_count);
+        Benchmark::report(label, key_count, ns);
+    }
+
+    template <size_t ShardCount>
+    static void run_striped(size_t thread_count, size_t operation_budget) {
+        lw_std::concurrent_unordered_map<int, int, ShardCount> c;
+        // NOTE: about half full, the load factor of both maps is the same
+        c.reserve(2 * key_count);
+        for (int key : keys())
+            c.insert(key, key);
+
+        double ns = run_threads(
+            thread_count, operation_budget,
+            [&](int key) {
+                int value = 0;
+                c.find(key, value);
+                return value;
+            },
+            [&](int key) { c.update(key, [](int& x) { ++x; }); });
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "concurrent (%zu shards), %zu threads", ShardCount, thread_count);
+        Benchmark::report(label, key_count, ns);
+    }
+};
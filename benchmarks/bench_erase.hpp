@@ -0,0 +1,80 @@
+#pragma once
+
+#include "benchmark.hpp"
+#include "list.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+
+class BenchErase {
+   public:
+    static void run(size_t n) {
+        Benchmark::start_group("erase_if (every other element), ns per element of the input");
+
+        // NOTE: the loop of single erases shifts the whole tail every time, so it is quadratic, keep it small
+        for (size_t size : {size_t{1} << 10, size_t{1} << 14})
+            run_vector_erase_loop(size);
+
+        for (size_t size : {size_t{1} << 10, size_t{1} << 14, n})
+            run_vector_erase_if(size);
+
+        for (size_t size : {size_t{1} << 10, size_t{1} << 14, n})
+            run_list_erase_if(size);
+
+        for (size_t size : {size_t{1} << 10, size_t{1} << 14, n})
+            run_unordered_map_erase_if(size);
+    }
+
+   private:
+    static constexpr auto is_odd = [](int value) { return (value & 1) != 0; };
+
+    static lw_std::vector<int> make_vector(size_t size) {
+        lw_std::vector<int> res;
+        res.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            res.push_back(static_cast<int>(i));
+        return res;
+    }
+
+    static void run_vector_erase_loop(size_t size) {
+        auto c = make_vector(size);
+
+        Benchmark::report("vector<int> loop of erase(pos)", size, Benchmark::ns_per_op(size, [&] {
+                              for (auto it = c.begin(); it != c.end();) {
+                                  if (is_odd(*it))
+                                      it = c.erase(it);
+                                  else
+                                      ++it;
+                              }
+                          }));
+        Benchmark::do_not_optimize(c.size());
+    }
+
+    static void run_vector_erase_if(size_t size) {
+        auto c = make_vector(size);
+
+        Benchmark::report("vector<int> erase_if", size, Benchmark::ns_per_op(size, [&] {
+                              Benchmark::do_not_optimize(lw_std::erase_if(c, is_odd));
+                          }));
+    }
+
+    static void run_list_erase_if(size_t size) {
+        lw_std::list<int> c;
+        for (size_t i = 0; i < size; ++i)
+            c.push_back(static_cast<int>(i));
+
+        Benchmark::report("list<int> erase_if", size, Benchmark::ns_per_op(size, [&] {
+                              Benchmark::do_not_optimize(lw_std::erase_if(c, is_odd));
+                          }));
+    }
+
+    static void run_unordered_map_erase_if(size_t size) {
+        lw_std::unordered_map<int, int> c;
+        c.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            c.emplace(static_cast<int>(i), 0);
+
+        Benchmark::report("unordered_map<int, int> erase_if", size, Benchmark::ns_per_op(size, [&] {
+                              Benchmark::do_not_optimize(lw_std::erase_if(c, [](const lw_std::pair<const int, int>& element) { return is_odd(element.first); }));
+                          }));
+    }
+};
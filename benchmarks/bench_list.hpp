@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+#include "unrolled_list.hpp"
+#include "vector.hpp"
+
+class BenchList {
+   public:
+    static void run_sort(size_t element_budget) {
+        Benchmark::start_group("sort a list, ns per element");
+        for (size_t size : {size_t{1} << 8, size_t{1} << 12, size_t{1} << 16, size_t{1} << 20}) {
+            run_sort_templated<int>("int", size, element_budget);
+            run_sort_templated<Payload>("64 byte payload", size, element_budget);
+        }
+    }
+
+    static void run_unrolled(size_t element_budget) {
+        Benchmark::start_group("iterate over list, unrolled_list and vector of int, ns per element");
+        for (size_t size : {size_t{1} << 10, size_t{1} << 16, size_t{1} << 20}) {
+            run_iteration_templated<lw_std::list<int>>("list", size, element_budget);
+            run_iteration_templated<lw_std::unrolled_list<int>>("unrolled_list", size, element_budget);
+            run_iteration_templated<lw_std::vector<int>>("vector", size, element_budget);
+        }
+
+        Benchmark::start_group("insert into the middle of list, unrolled_list and vector of int, ns per inserted element");
+        for (size_t size : {size_t{1} << 10, size_t{1} << 14, size_t{1} << 17}) {
+            run_insert_templated<lw_std::list<int>>("list", size, element_budget);
+            run_insert_templated<lw_std::unrolled_list<int>>("unrolled_list", size, element_budget);
+            run_insert_templated<lw_std::vector<int>>("vector", size, element_budget);
+        }
+    }
+
+   private:
+    template <typename Container>
+    static Container make_container(size_t size) {
+        Container c;
+        for (size_t i = 0; i < size; ++i)
+            c.push_back(static_cast<int>(i));
+        return c;
+    }
+
+    template <typename Container>
+    static void run_iteration_templated(const char* name, size_t size, size_t element_budget) {
+        // NOTE: built with interleaved allocations, so the nodes of the list are not laid out in order in memory
+        Container c;
+        lw_std::vector<lw_std::vector<int>> noise;
+        for (size_t i = 0; i < size; ++i) {
+            c.push_back(static_cast<int>(i));
+            if (i % 4 == 0) noise.push_back(lw_std::vector<int>(Benchmark::rng()() % 8 + 1, 0));
+        }
+
+        size_t repetitions = element_budget / size + 1;
+        Benchmark::report(name, size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              long long sum = 0;
+                              for (size_t r = 0; r < repetitions; ++r)
+                                  for (int value : c)
+                                      sum += value;
+                              Benchmark::do_not_optimize(sum);
+                          }));
+    }
+
+    template <typename Container>
+    static void run_insert_templated(const char* name, size_t size, size_t element_budget) {
+        // NOTE: a walk to the middle and a batch of inserts there (as an editor buffer would do), erased again
+        //       afterwards so the size stays the same; the walk and the erase are part of the timing of every variant
+        static constexpr size_t batch = 256;
+        size_t repetitions = element_budget / (size + batch) + 1;
+        auto c = make_container<Container>(size);
+
+        Benchmark::report(name, size, Benchmark::ns_per_op(repetitions * batch, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  auto it = c.begin();
+                                  for (size_t i = 0; i < size / 2; ++i)
+                                      ++it;
+
+                                  for (size_t i = 0; i < batch; ++i)
+                                      it = c.insert(it, static_cast<int>(i));
+
+                                  Benchmark::do_not_optimize(*it);
+                                  c.erase(it, lw_std::next(it, static_cast<ptrdiff_t>(batch)));
+                              }
+                          }));
+    }
+
+    struct Payload {
+        int key;
+        int data[15];
+
+        Payload(int k = 0) : key(k), data{} {}
+
+        bool operator<(const Payload& other) const {
+            return key < other.key;
+        }
+    };
+
+    template <typename T>
+    static void run_sort_templated(const char* type_name, size_t size, size_t element_budget) {
+        std::vector<int> keys(size);
+        for (auto& key : keys)
+            key = static_cast<int>(Benchmark::rng()());
+
+        size_t repetitions = element_budget / size + 1;
+        char label[64];
+
+        // NOTE: the list is rebuilt from keys in every repetition of both variants, so that part is timed in both
+        std::snprintf(label, sizeof(label), "%s: copy to vector, sort, rebuild", type_name);
+        Benchmark::report(label, size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  lw_std::list<T> c;
+                                  for (int key : keys)
+                                      c.emplace_back(key);
+
+                                  lw_std::vector<T> sorted(c.begin(), c.end());
+                                  std::sort(sorted.data(), sorted.data() + sorted.size());
+                                  c.clear();
+                                  for (auto& element : sorted)
+                                      c.push_back(lw_std::move(element));
+
+                                  Benchmark::do_not_optimize(c.front());
+                              }
+                          }));
+
+        std::snprintf(label, sizeof(label), "%s: list::sort", type_name);
+        Benchmark::report(label, size, Benchmark::ns_per_op(repetitions * size, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  lw_std::list<T> c;
+                                  for (int key : keys)
+                                      c.emplace_back(key);
+
+                                  c.sort();
+                                  Benchmark::do_not_optimize(c.front());
+                              }
+                          }));
+    }
+};
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "concurrent_unordered_map.hpp"
+#include "read_mostly_map.hpp"
+
+class BenchReadMostlyMap {
+   public:
+    static void run_read_heavy(size_t operation_budget) {
+        Benchmark::start_group("lookups from n reader threads while one writer updates a value per 10000 lookups, ns per lookup (wall clock)");
+        for (size_t thread_count : {size_t{1}, size_t{2}, size_t{4}, size_t{8}, size_t{16}, size_t{32}}) {
+            run_concurrent(thread_count, operation_budget);
+            run_read_mostly(thread_count, operation_budget);
+        }
+    }
+
+   private:
+    static constexpr size_t key_count = 4096;
+    static constexpr size_t lookups_per_write = 10000;
+
+    // NOTE: random keys, the same for both maps
+    static const std::vector<int>& keys() {
+        static std::vector<int> res = [] {
+            std::vector<int> k(key_count);
+            for (auto& key : k)
+                key = static_cast<int>(Benchmark::rng()() >> 1);
+            return k;
+        }();
+        return res;
+    }
+
+    // NOTE: the readers do operation_budget lookups in total, the writer runs until they are done
+    template <typename Find, typename Write>
+    static double run_threads(size_t thread_count, size_t operation_budget, Find find, Write write) {
+        size_t per_thread = operation_budget / thread_count;
+        std::atomic<size_t> remaining_readers{thread_count};
+        std::atomic<size_t> lookups{0};
+
+        return Benchmark::ns_per_op(per_thread * thread_count, [&] {
+            std::thread writer([&] {
+                size_t written = 0;
+                while (remaining_readers.load(std::memory_order_relaxed) != 0) {
+                    if (lookups.load(std::memory_order_relaxed) / lookups_per_write > written) write(keys()[written++ % key_count]);
+                    std::this_thread::yield();
+                }
+            });
+
+            std::vector<std::thread> readers;
+            for (size_t t = 0; t < thread_count; ++t)
+                readers.emplace_back([&, t] {
+                    unsigned state = static_cast<unsigned>(t) * 2654435761u + 1;
+                    long long sum = 0;
+                    for (size_t i = 0; i < per_thread; ++i) {
+                        state = state * 1664525u + 1013904223u;
+                        sum += find(keys()[(state >> 8) % key_count]);
+                        if (i % 1024 == 0) lookups.fetch_add(1024, std::memory_order_relaxed);
+                    }
+                    Benchmark::do_not_optimize(sum);
+                    remaining_readers.fetch_sub(1);
+                });
+
+            for (auto& reader : readers)
+                reader.join();
+            writer.join();
+        });
+    }
+
+    static void run_concurrent(size_t thread_count, size_t operation_budget) {
+        lw_std::concurrent_unordered_map<int, int, 64> c;
+        // NOTE: about half full, like the buckets of the other map
+        c.reserve(2 * key_count);
+        for (int key : keys())
+            c.insert(key, key);
+
+        double ns = run_threads(
+            thread_count, operation_budget,
+            [&](int key) {
+                int value = 0;
+                c.find(key, value);
+                return value;
+            },
+            [&](int key) { c.update(key, [](int& x) { ++x; }); });
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "concurrent (64 shards), %zu threads", thread_count);
+        Benchmark::report(label, key_count, ns);
+    }
+
+    static void run_read_mostly(size_t thread_count, size_t operation_budget) {
+        lw_std::read_mostly_map<int, int> c;
+        c.reserve(2 * key_count);
+        for (int key : keys())
+            c.insert(key, key);
+
+        double ns = run_threads(
+            thread_count, operation_budget,
+            [&](int key) {
+                int value = 0;
+                c.find(key, value);
+                return value;
+            },
+            [&](int key) {
+                int value = 0;
+                c.find(key, value);
+                c.insert_or_assign(key, value + 1);
+            });
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "read_mostly_map, %zu threads", thread_count);
+        Benchmark::report(label, key_count, ns);
+    }
+};
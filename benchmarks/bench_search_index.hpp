@@ -0,0 +1,69 @@
+#pragma once
+
+#include "benchmark.hpp"
+#include "algorithm.hpp"
+#include "static_search_index.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+
+class BenchSearchIndex {
+   public:
+    static void run(size_t lookup_count) {
+        Benchmark::start_group("lookup: sorted vector vs static_search_index vs unordered_map");
+
+        for (size_t n : {size_t{1} << 10, size_t{1} << 16, size_t{1} << 20})
+            run_with_size(n, lookup_count);
+    }
+
+   private:
+    static void run_with_size(size_t n, size_t lookup_count) {
+        // NOTE: odd keys only, so about half of the lookups miss
+        lw_std::vector<uint32_t> keys;
+        lw_std::vector<uint32_t> values;
+        keys.reserve(n);
+        values.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            keys.push_back(static_cast<uint32_t>(2 * i + 1));
+            values.push_back(static_cast<uint32_t>(i));
+        }
+
+        std::uniform_int_distribution<uint32_t> dist(0, static_cast<uint32_t>(2 * n));
+        lw_std::vector<uint32_t> queries;
+        queries.reserve(lookup_count);
+        for (size_t i = 0; i < lookup_count; ++i)
+            queries.push_back(dist(Benchmark::rng()));
+
+        const uint32_t* first = keys.data();
+        const uint32_t* last = keys.data() + keys.size();
+
+        Benchmark::report("lower_bound (sorted vector)", n, Benchmark::ns_per_op(lookup_count, [&] {
+                              for (auto query : queries)
+                                  Benchmark::do_not_optimize(lw_std::lower_bound(first, last, query));
+                          }));
+
+        Benchmark::report("branchless_lower_bound (sorted vector)", n, Benchmark::ns_per_op(lookup_count, [&] {
+                              for (auto query : queries)
+                                  Benchmark::do_not_optimize(lw_std::branchless_lower_bound(first, last, query));
+                          }));
+
+        lw_std::static_search_index<uint32_t, uint32_t> index(keys, values);
+        Benchmark::report("static_search_index::lower_bound", n, Benchmark::ns_per_op(lookup_count, [&] {
+                              for (auto query : queries)
+                                  Benchmark::do_not_optimize(index.lower_bound(query) != index.end());
+                          }));
+
+        Benchmark::report("static_search_index::find", n, Benchmark::ns_per_op(lookup_count, [&] {
+                              for (auto query : queries)
+                                  Benchmark::do_not_optimize(index.contains(query));
+                          }));
+
+        lw_std::unordered_map<uint32_t, uint32_t> map;
+        map.reserve(2 * n);
+        for (size_t i = 0; i < n; ++i)
+            map.emplace(keys[i], values[i]);
+        Benchmark::report("unordered_map::find", n, Benchmark::ns_per_op(lookup_count, [&] {
+                              for (auto query : queries)
+                                  Benchmark::do_not_optimize(map.find(query) != map.end());
+                          }));
+    }
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "intrusive_ptr.hpp"
+#include "memory.hpp"
+
+class BenchSharedPtr {
+   public:
+    // NOTE: a copy and its destruction, one increment and one decrement of the count;
+    //       libstdc++ skips the atomics of std::shared_ptr until the program starts its first thread
+    static void run_copy(size_t copy_count) {
+        Benchmark::start_group("copy + destroy of a shared pointer, one thread");
+
+        run_copies("std::shared_ptr", copy_count, std::make_shared<payload>());
+        run_copies("shared_ptr (atomic_refcount)", copy_count, lw_std::make_shared<payload, lw_std::atomic_refcount>());
+        run_copies("shared_ptr (nonatomic_refcount)", copy_count, lw_std::make_shared<payload, lw_std::nonatomic_refcount>());
+        run_copies("intrusive_ptr (atomic_refcount)", copy_count, lw_std::make_intrusive<counted<lw_std::atomic_refcount>>());
+        run_copies("intrusive_ptr (nonatomic_refcount)", copy_count, lw_std::make_intrusive<counted<lw_std::nonatomic_refcount>>());
+
+        Benchmark::start_group("make_shared + destroy");
+        Benchmark::report("std::make_shared", copy_count / 8, Benchmark::ns_per_op(copy_count / 8, [&] {
+                              for (size_t i = 0; i < copy_count / 8; ++i)
+                                  Benchmark::do_not_optimize(std::make_shared<payload>()->value);
+                          }));
+        Benchmark::report("make_shared (one allocation)", copy_count / 8, Benchmark::ns_per_op(copy_count / 8, [&] {
+                              for (size_t i = 0; i < copy_count / 8; ++i)
+                                  Benchmark::do_not_optimize(lw_std::make_shared<payload>()->value);
+                          }));
+        Benchmark::report("shared_ptr(new T) (two allocations)", copy_count / 8, Benchmark::ns_per_op(copy_count / 8, [&] {
+                              for (size_t i = 0; i < copy_count / 8; ++i)
+                                  Benchmark::do_not_optimize(lw_std::shared_ptr<payload>(new payload())->value);
+                          }));
+        Benchmark::report("make_intrusive", copy_count / 8, Benchmark::ns_per_op(copy_count / 8, [&] {
+                              for (size_t i = 0; i < copy_count / 8; ++i)
+                                  Benchmark::do_not_optimize(lw_std::make_intrusive<counted<lw_std::atomic_refcount>>()->value);
+                          }));
+    }
+
+    // NOTE: n threads copy the same pointer, every copy writes the one cache line of its count
+    static void run_contention(size_t copy_budget) {
+        Benchmark::start_group("copy + destroy of one shared pointer from n threads, ns per copy (wall clock)");
+        for (size_t thread_count : {size_t{1}, size_t{2}, size_t{4}, size_t{8}}) {
+            run_threads("std::shared_ptr", thread_count, copy_budget, std::make_shared<payload>());
+            run_threads("shared_ptr (atomic_refcount)", thread_count, copy_budget, lw_std::make_shared<payload>());
+            run_threads("intrusive_ptr (atomic_refcount)", thread_count, copy_budget, lw_std::make_intrusive<counted<lw_std::atomic_refcount>>());
+        }
+    }
+
+   private:
+    struct payload {
+        int value{1};
+    };
+
+    template <typename RefCount>
+    struct counted : lw_std::intrusive_ref_counter<counted<RefCount>, RefCount> {
+        int value{1};
+    };
+
+    template <typename Ptr>
+    static void run_copies(const char* name, size_t copy_count, const Ptr& ptr) {
+        Benchmark::report(name, copy_count, Benchmark::ns_per_op(copy_count, [&] {
+                              for (size_t i = 0; i < copy_count; ++i) {
+                                  Ptr copy = ptr;
+                                  Benchmark::do_not_optimize(copy);
+                              }
+                          }));
+    }
+
+    template <typename Ptr>
+    static void run_threads(const char* name, size_t thread_count, size_t copy_budget, const Ptr& ptr) {
+        size_t per_thread = copy_budget / thread_count;
+
+        double ns = Benchmark::ns_per_op(per_thread * thread_count, [&] {
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < thread_count; ++t)
+                threads.emplace_back([&] {
+                    for (size_t i = 0; i < per_thread; ++i) {
+                        Ptr copy = ptr;
+                        Benchmark::do_not_optimize(copy);
+                    }
+                });
+
+            for (auto& thread : threads)
+                thread.join();
+        });
+
+        Benchmark::report(name, thread_count, ns);
+    }
+};
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <string>
+
+#include "benchmark.hpp"
+#include "string.hpp"
+#include "string_view.hpp"
+#include "vector.hpp"
+
+// NOTE: std::string is the hosted backend lw_std::string replaced; Arduino's String, the other one, can't run here
+class BenchString {
+   public:
+    static void run(size_t operation_count) {
+        Benchmark::start_group("string: std::string vs lw_std::string");
+
+        for (size_t length : {size_t{8}, size_t{15}, size_t{64}}) {
+            run_construct<std::string>("std::string construct + copy", length, operation_count);
+            run_construct<lw_std::string>("lw_std::string construct + copy", length, operation_count);
+        }
+
+        run_append<std::string>("std::string push_back", operation_count);
+        run_append<lw_std::string>("lw_std::string push_back", operation_count);
+
+        run_find<std::string>("std::string find", operation_count);
+        run_find<lw_std::string>("lw_std::string find", operation_count);
+    }
+
+    // NOTE: the fields of a line, copied into strings with substr vs views from tokenize
+    static void run_parse(size_t operation_count) {
+        Benchmark::start_group("parse fields: lw_std::string substr vs string_view tokenize");
+
+        lw_std::string line;
+        for (size_t i = 0; i < 32; ++i)
+            line.append(i % 2 == 0 ? "sensor.temperature.celsius " : "23.5 ");
+
+        size_t rounds = operation_count / 32;
+
+        Benchmark::report("string::substr (copies)", 32, Benchmark::ns_per_op(rounds * 32, [&] {
+                              for (size_t round = 0; round < rounds; ++round)
+                                  for (size_t pos = 0, next; pos < line.size(); pos = next + 1) {
+                                      next = line.find(' ', pos);
+                                      lw_std::string field = line.substr(pos, next - pos);
+                                      Benchmark::do_not_optimize(field.data());
+                                  }
+                          }));
+
+        Benchmark::report("tokenize (views)", 32, Benchmark::ns_per_op(rounds * 32, [&] {
+                              for (size_t round = 0; round < rounds; ++round)
+                                  for (lw_std::string_view field : lw_std::tokenize(line, " "))
+                                      Benchmark::do_not_optimize(field.data());
+                          }));
+    }
+
+   private:
+    // NOTE: short strings are the common case (names, keys, tokens), up to 15 chars both are free of allocations
+    template <typename String>
+    static void run_construct(const char* name, size_t length, size_t operation_count) {
+        lw_std::vector<char> text(length, 'a');
+        text.push_back('\0');
+        const char* source = text.data();
+
+        Benchmark::report(name, length, Benchmark::ns_per_op(operation_count, [&] {
+                              for (size_t i = 0; i < operation_count; ++i) {
+                                  String s(source);
+                                  String copy(s);
+                                  Benchmark::do_not_optimize(copy.data());
+                              }
+                          }));
+    }
+
+    template <typename String>
+    static void run_append(const char* name, size_t operation_count) {
+        static constexpr size_t length = 1000;
+        size_t rounds = operation_count / length;
+
+        Benchmark::report(name, length, Benchmark::ns_per_op(rounds * length, [&] {
+                              for (size_t round = 0; round < rounds; ++round) {
+                                  String s;
+                                  for (size_t i = 0; i < length; ++i)
+                                      s.push_back(static_cast<char>('a' + i % 26));
+                                  Benchmark::do_not_optimize(s.data());
+                              }
+                          }));
+    }
+
+    template <typename String>
+    static void run_find(const char* name, size_t operation_count) {
+        static constexpr size_t length = 4096;
+
+        String haystack;
+        std::uniform_int_distribution<int> dist('a', 'z');
+        for (size_t i = 0; i < length; ++i)
+            haystack.push_back(static_cast<char>(dist(Benchmark::rng())));
+        haystack.append("needle");
+
+        size_t rounds = operation_count / 100;
+        Benchmark::report(name, length, Benchmark::ns_per_op(rounds, [&] {
+                              for (size_t round = 0; round < rounds; ++round)
+                                  Benchmark::do_not_optimize(haystack.find("needle"));
+                          }));
+    }
+};
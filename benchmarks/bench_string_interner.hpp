@@ -0,0 +1,66 @@
+#pragma once
+
+#include "benchmark.hpp"
+#include "string.hpp"
+#include "string_interner.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+
+class BenchStringInterner {
+   public:
+    // NOTE: a stream of telemetry samples whose keys repeat, counted per key
+    static void run_counting(size_t sample_count) {
+        Benchmark::start_group("count samples per key: unordered_map<string> vs interned keys");
+
+        for (size_t key_count : {size_t{64}, size_t{4096}})
+            run_with_keys(key_count, sample_count);
+    }
+
+   private:
+    static void run_with_keys(size_t key_count, size_t sample_count) {
+        lw_std::vector<lw_std::string> keys;
+        for (size_t i = 0; i < key_count; ++i)
+            keys.push_back(lw_std::string("device.") + lw_std::to_string(i * 7919) + ".sensor.temperature");
+
+        std::uniform_int_distribution<size_t> dist(0, key_count - 1);
+        lw_std::vector<lw_std::string_view> samples;
+        samples.reserve(sample_count);
+        for (size_t i = 0; i < sample_count; ++i)
+            samples.push_back(keys[dist(Benchmark::rng())]);
+
+        Benchmark::report("unordered_map<string>", key_count, Benchmark::ns_per_op(sample_count, [&] {
+                              lw_std::unordered_map<lw_std::string, unsigned> counts;
+                              for (auto sample : samples) {
+                                  lw_std::string key(sample);
+                                  auto it = counts.find(key);
+                                  if (it == counts.end())
+                                      counts.insert({lw_std::move(key), 1u});
+                                  else
+                                      ++it->second;
+                              }
+                              Benchmark::do_not_optimize(counts.size());
+                          }));
+
+        Benchmark::report("intern + unordered_map<interned_string>", key_count, Benchmark::ns_per_op(sample_count, [&] {
+                              lw_std::string_interner interner;
+                              lw_std::unordered_map<lw_std::interned_string, unsigned> counts;
+                              for (auto sample : samples)
+                                  ++counts[interner.intern(sample)];
+                              Benchmark::do_not_optimize(counts.size());
+                          }));
+
+        // NOTE: the keys are interned where the samples are produced, counting only touches handles
+        lw_std::string_interner interner;
+        lw_std::vector<lw_std::interned_string> handles;
+        handles.reserve(sample_count);
+        for (auto sample : samples)
+            handles.push_back(interner.intern(sample));
+
+        Benchmark::report("unordered_map<interned_string>", key_count, Benchmark::ns_per_op(sample_count, [&] {
+                              lw_std::unordered_map<lw_std::interned_string, unsigned> counts;
+                              for (auto handle : handles)
+                                  ++counts[handle];
+                              Benchmark::do_not_optimize(counts.size());
+                          }));
+    }
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "benchmark.hpp"
+#include "unordered_map.hpp"
+
+class BenchUnorderedMap {
+   public:
+    static void run_iteration(size_t element_budget) {
+        Benchmark::start_group("iterate over an unordered_map<int, int> after erasing most of it, ns per full iteration");
+        for (size_t size : {size_t{1} << 10, size_t{1} << 17})
+            for (size_t live : {size_t{10}, size / 2, size})
+                run_iteration_templated(size, live, element_budget);
+    }
+
+   private:
+    static void run_iteration_templated(size_t size, size_t live, size_t element_budget) {
+        lw_std::unordered_map<int, int> c;
+        c.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            c.emplace(static_cast<int>(i), 0);
+
+        // NOTE: the buckets stay allocated, so a few live entries are spread over the whole table
+        size_t stride = size / live;
+        for (size_t i = 0; i < size; ++i)
+            if (i % stride != 0 || i / stride >= live) c.erase(static_cast<int>(i));
+
+        size_t repetitions = element_budget / size + 1;
+        char label[64];
+        std::snprintf(label, sizeof(label), "%zu live entries", c.size());
+
+        Benchmark::report(label, size, Benchmark::ns_per_op(repetitions, [&] {
+                              long long sum = 0;
+                              for (size_t r = 0; r < repetitions; ++r)
+                                  for (const auto& element : c)
+                                      sum += element.first;
+                              Benchmark::do_not_optimize(sum);
+                          }));
+
+        std::snprintf(label, sizeof(label), "begin(), %zu live entries", c.size());
+        Benchmark::report(label, size, Benchmark::ns_per_op(repetitions, [&] {
+                              for (size_t r = 0; r < repetitions; ++r)
+                                  Benchmark::do_not_optimize(c.begin()->first);
+                          }));
+    }
+};
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "benchmark.hpp"
+#include "vector.hpp"
+
+class BenchVector {
+   public:
+    static void run_bulk_insert(size_t element_budget) {
+        Benchmark::start_group("insert a batch in the middle of a vector<int>, ns per inserted element");
+        for (size_t size : {size_t{1} << 10, size_t{1} << 16})
+            for (size_t batch : {size_t{16}, size_t{1024}})
+                run_bulk_insert_templated(size, batch, element_budget);
+    }
+
+    static void run_resize(size_t byte_budget) {
+        Benchmark::start_group("grow a fresh vector<uint8_t> receive buffer, ns per resize");
+        for (size_t size : {size_t{1} << 10, size_t{1} << 16, size_t{1} << 20})
+            run_resize_templated(size, byte_budget);
+    }
+
+   private:
+    static void run_resize_templated(size_t size, size_t byte_budget) {
+        size_t repetitions = byte_budget / size + 1;
+
+        // NOTE: what resize did before, one emplace per element into exactly sized storage
+        Benchmark::report_throughput("reserve + emplace_back(0) loop", size, size, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t r = 0; r < repetitions; ++r) {
+                                             lw_std::vector<uint8_t> c;
+                                             c.reserve(size);
+                                             for (size_t i = 0; i < size; ++i)
+                                                 c.emplace_back(uint8_t{0});
+                                             Benchmark::do_not_optimize(c.data());
+                                         }
+                                     }));
+
+        Benchmark::report_throughput("resize(n)", size, size, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t r = 0; r < repetitions; ++r) {
+                                             lw_std::vector<uint8_t> c;
+                                             c.resize(size);
+                                             Benchmark::do_not_optimize(c.data());
+                                         }
+                                     }));
+
+        Benchmark::report_throughput("resize(n, value)", size, size, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t r = 0; r < repetitions; ++r) {
+                                             lw_std::vector<uint8_t> c;
+                                             c.resize(size, uint8_t{0xff});
+                                             Benchmark::do_not_optimize(c.data());
+                                         }
+                                     }));
+
+        Benchmark::report_throughput("resize_for_overwrite(n)", size, size, Benchmark::ns_per_op(repetitions, [&] {
+                                         for (size_t r = 0; r < repetitions; ++r) {
+                                             lw_std::vector<uint8_t> c;
+                                             c.resize_for_overwrite(size);
+                                             Benchmark::do_not_optimize(c.data());
+                                         }
+                                     }));
+    }
+
+    static void run_bulk_insert_templated(size_t size, size_t batch, size_t element_budget) {
+        lw_std::vector<int> base;
+        base.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            base.push_back(static_cast<int>(i));
+
+        lw_std::vector<int> range(batch, 7);
+
+        // NOTE: every repetition starts from a fresh copy of base, so the copy is part of the timing of every variant
+        size_t repetitions = element_budget / (size + batch) + 1;
+        char label[64];
+
+        std::snprintf(label, sizeof(label), "loop of insert(pos, value), batch %zu", batch);
+        Benchmark::report(label, size, Benchmark::ns_per_op(repetitions * batch, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  auto c = base;
+                                  auto pos = c.begin() + static_cast<int>(size / 2);
+                                  for (size_t i = 0; i < batch; ++i)
+                                      pos = c.insert(pos, range[i]) + 1;
+                                  Benchmark::do_not_optimize(c.data());
+                              }
+                          }));
+
+        std::snprintf(label, sizeof(label), "insert(pos, first, last), batch %zu", batch);
+        Benchmark::report(label, size, Benchmark::ns_per_op(repetitions * batch, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  auto c = base;
+                                  c.insert(c.begin() + static_cast<int>(size / 2), range.begin(), range.end());
+                                  Benchmark::do_not_optimize(c.data());
+                              }
+                          }));
+
+        std::snprintf(label, sizeof(label), "insert(pos, count, value), batch %zu", batch);
+        Benchmark::report(label, size, Benchmark::ns_per_op(repetitions * batch, [&] {
+                              for (size_t r = 0; r < repetitions; ++r) {
+                                  auto c = base;
+                                  c.insert(c.begin() + static_cast<int>(size / 2), batch, 7);
+                                  Benchmark::do_not_optimize(c.data());
+                              }
+                          }));
+    }
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace Benchmark {
+
+// NOTE: keeps the compiler from removing a computation whose result is otherwise unused
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    __asm__ __volatile__("" : : "r,m"(value) : "memory");
+}
+
+template <typename Func>
+[[nodiscard]] inline double ns_per_op(size_t operation_count, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(operation_count);
+}
+
+inline void start_group(const char* name) {
+    std::printf("\n%s\n", name);
+}
+
+inline void report(const char* name, size_t n, double ns) {
+    std::printf("    %-40s n=%-9zu %10.2f ns/op\n", name, n, ns);
+}
+
+inline void report_throughput(const char* name, size_t n, size_t bytes_per_op, double ns) {
+    std::printf("    %-40s n=%-9zu %10.2f ns/op %8.2f GB/s\n", name, n, ns, static_cast<double>(bytes_per_op) / ns);
+}
+
+// NOTE: fixed seed, so runs are comparable
+inline std::mt19937& rng() {
+    static std::mt19937 generator(42);
+    return generator;
+}
+
+}  // namespace Benchmark
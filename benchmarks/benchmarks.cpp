@@ -0,0 +1,38 @@
+#include "bench_algorithm.hpp"
+#include "bench_bitset.hpp"
+#include "bench_charconv.hpp"
+#include "bench_concurrent_unordered_map.hpp"
+#include "bench_erase.hpp"
+#include "bench_list.hpp"
+#include "bench_read_mostly_map.hpp"
+#include "bench_search_index.hpp"
+#include "bench_shared_ptr.hpp"
+#include "bench_string.hpp"
+#include "bench_string_interner.hpp"
+#include "bench_unordered_map.hpp"
+#include "bench_vector.hpp"
+
+int main() {
+    static constexpr size_t num_operations = 1000000;
+
+    BenchAlgorithm::run_vectorized(64 * num_operations);
+    BenchAlgorithm::run_comparison(16 * num_operations);
+    BenchBitset::run(64 * num_operations);
+    BenchCharconv::run(4 * num_operations);
+    BenchConcurrentUnorderedMap::run_scaling(4 * num_operations);
+    BenchErase::run(num_operations);
+    BenchList::run_sort(4 * num_operations);
+    BenchList::run_unrolled(16 * num_operations);
+    BenchReadMostlyMap::run_read_heavy(4 * num_operations);
+    BenchSearchIndex::run(num_operations);
+    BenchSharedPtr::run_copy(16 * num_operations);
+    BenchSharedPtr::run_contention(8 * num_operations);
+    BenchString::run(4 * num_operations);
+    BenchString::run_parse(4 * num_operations);
+    BenchStringInterner::run_counting(num_operations);
+    BenchUnorderedMap::run_iteration(16 * num_operations);
+    BenchVector::run_bulk_insert(16 * num_operations);
+    BenchVector::run_resize(256 * num_operations);
+
+    return 0;
+}
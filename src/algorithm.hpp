@@ -1,6 +1,10 @@
 // algorithm header https://en.cppreference.com/w/cpp/header/algorithm
 #pragma once
 
+#include "compare.hpp"
+#include "impl/vectorized_algorithms.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
 #include "utility.hpp"
 
 namespace lw_std {
@@ -50,6 +54,11 @@ template <typename T, typename U>
 // find (1) https://en.cppreference.com/w/cpp/algorithm/find
 template <typename InputIt, typename T>
 [[nodiscard]] constexpr InputIt find(InputIt first, InputIt last, const T& value) {
+    if constexpr (is_vectorizable_search_v<InputIt, T>) {
+        if (!is_constant_evaluated())
+            return first + (vectorized_find<T>(first, last, value) - first);
+    }
+
     for (; first != last; ++first)
         if (*first == value)
             return first;
@@ -83,44 +92,189 @@ template <typename InputIt, typename UnaryPredicate>
 
 // FIXME: find_if_not (6) https://en.cppreference.com/w/cpp/algorithm/find
 
+// count (1) https://en.cppreference.com/w/cpp/algorithm/count
+// FIXME: should return iterator_traits<InputIt>::difference_type
+template <typename InputIt, typename T>
+[[nodiscard]] constexpr ptrdiff_t count(InputIt first, InputIt last, const T& value) {
+    if constexpr (is_vectorizable_search_v<InputIt, T>) {
+        if (!is_constant_evaluated())
+            return vectorized_count<T>(first, last, value);
+    }
+
+    ptrdiff_t res = 0;
+    for (; first != last; ++first)
+        if (*first == value)
+            ++res;
+
+    return res;
+}
+
+// FIXME: count (2) https://en.cppreference.com/w/cpp/algorithm/count
+
+// count_if (3) https://en.cppreference.com/w/cpp/algorithm/count
+// FIXME: should return iterator_traits<InputIt>::difference_type
+template <typename InputIt, typename UnaryPredicate>
+[[nodiscard]] constexpr ptrdiff_t count_if(InputIt first, InputIt last, UnaryPredicate p) {
+    ptrdiff_t res = 0;
+    for (; first != last; ++first)
+        if (p(*first))
+            ++res;
+
+    return res;
+}
+
+// FIXME: count_if (4) https://en.cppreference.com/w/cpp/algorithm/count
+
 /*
     Modifying sequence operations
 */
 
+// remove_if (2) https://en.cppreference.com/w/cpp/algorithm/remove
+template <typename ForwardIt, typename UnaryPredicate>
+constexpr ForwardIt remove_if(ForwardIt first, ForwardIt last, UnaryPredicate p) {
+    first = lw_std::find_if(first, last, p);
+    if (first != last)
+        for (ForwardIt i = first; ++i != last;)
+            if (!p(*i))
+                *first++ = lw_std::move(*i);
+    return first;
+}
+
+// remove (1) https://en.cppreference.com/w/cpp/algorithm/remove
+template <typename ForwardIt, typename T>
+constexpr ForwardIt remove(ForwardIt first, ForwardIt last, const T& value) {
+    return lw_std::remove_if(
+        first, last, [&value](const auto& element) constexpr { return element == value; });
+}
+
 // common erase (specialization (1) reference for vector: https://en.cppreference.com/w/cpp/container/vector/erase2)
+// NOTE: vector and list have their own overloads, this is the fallback for other sequence containers
 template <typename T, typename U>
 constexpr typename T::size_type erase(T& c, const U& value) {
-    auto old_size = c.size();
-    remove(c.begin(), c.end(), value);
-    return old_size - c.size();
+    auto it = lw_std::remove(c.begin(), c.end(), value);
+    auto res = static_cast<typename T::size_type>(lw_std::distance(it, c.end()));
+    c.erase(it, c.end());
+    return res;
 }
 
 // common erase_if (specialization (2) reference for vector: https://en.cppreference.com/w/cpp/container/vector/erase2)
 template <typename T, typename Pred>
 constexpr typename T::size_type erase_if(T& c, Pred pred) {
-    auto old_size = c.size();
-    remove(c.begin(), c.end(), pred);
-    return old_size - c.size();
+    auto it = lw_std::remove_if(c.begin(), c.end(), pred);
+    auto res = static_cast<typename T::size_type>(lw_std::distance(it, c.end()));
+    c.erase(it, c.end());
+    return res;
 }
 
-// remove (1) https://en.cppreference.com/w/cpp/algorithm/remove
+/*
+    Binary search operations (on sorted ranges)
+*/
+
+// lower_bound (2) https://en.cppreference.com/w/cpp/algorithm/lower_bound
+template <typename ForwardIt, typename T, typename Compare>
+[[nodiscard]] constexpr ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp) {
+    auto count = lw_std::distance(first, last);
+
+    while (count > 0) {
+        auto step = count / 2;
+        auto it = lw_std::next(first, step);
+
+        if (comp(*it, value)) {
+            first = ++it;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+// lower_bound (1) https://en.cppreference.com/w/cpp/algorithm/lower_bound
 template <typename ForwardIt, typename T>
-constexpr ForwardIt remove(ForwardIt first, ForwardIt last, const T& value) {
-    return remove_if(
-        first, last, [value](const typename ForwardIt::reference compare_value) constexpr { return value == compare_value; });
+[[nodiscard]] constexpr ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T& value) {
+    return lw_std::lower_bound(
+        first, last, value, [](const auto& a, const auto& b) constexpr { return a < b; });
 }
 
-// remove_if (2) https://en.cppreference.com/w/cpp/algorithm/remove
-template <typename ForwardIt, typename UnaryPredicate>
-ForwardIt remove_if(ForwardIt first, ForwardIt last, UnaryPredicate p) {
-    first = find_if(first, last, p);
-    if (first != last)
-        for (ForwardIt i = first; ++i != last;)
-            if (!p(*i))
-                *first++ = lw_std::move(*i);
+// upper_bound (2) https://en.cppreference.com/w/cpp/algorithm/upper_bound
+template <typename ForwardIt, typename T, typename Compare>
+[[nodiscard]] constexpr ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp) {
+    auto count = lw_std::distance(first, last);
+
+    while (count > 0) {
+        auto step = count / 2;
+        auto it = lw_std::next(first, step);
+
+        if (!comp(value, *it)) {
+            first = ++it;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+
     return first;
 }
 
+// upper_bound (1) https://en.cppreference.com/w/cpp/algorithm/upper_bound
+template <typename ForwardIt, typename T>
+[[nodiscard]] constexpr ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T& value) {
+    return lw_std::upper_bound(
+        first, last, value, [](const auto& a, const auto& b) constexpr { return a < b; });
+}
+
+// binary_search (2) https://en.cppreference.com/w/cpp/algorithm/binary_search
+template <typename ForwardIt, typename T, typename Compare>
+[[nodiscard]] constexpr bool binary_search(ForwardIt first, ForwardIt last, const T& value, Compare comp) {
+    first = lw_std::lower_bound(first, last, value, comp);
+    return first != last && !comp(value, *first);
+}
+
+// binary_search (1) https://en.cppreference.com/w/cpp/algorithm/binary_search
+template <typename ForwardIt, typename T>
+[[nodiscard]] constexpr bool binary_search(ForwardIt first, ForwardIt last, const T& value) {
+    return lw_std::binary_search(
+        first, last, value, [](const auto& a, const auto& b) constexpr { return a < b; });
+}
+
+// equal_range (2) https://en.cppreference.com/w/cpp/algorithm/equal_range
+template <typename ForwardIt, typename T, typename Compare>
+[[nodiscard]] constexpr pair<ForwardIt, ForwardIt> equal_range(ForwardIt first, ForwardIt last, const T& value, Compare comp) {
+    first = lw_std::lower_bound(first, last, value, comp);
+    return {first, lw_std::upper_bound(first, last, value, comp)};
+}
+
+// equal_range (1) https://en.cppreference.com/w/cpp/algorithm/equal_range
+template <typename ForwardIt, typename T>
+[[nodiscard]] constexpr pair<ForwardIt, ForwardIt> equal_range(ForwardIt first, ForwardIt last, const T& value) {
+    return lw_std::equal_range(
+        first, last, value, [](const auto& a, const auto& b) constexpr { return a < b; });
+}
+
+// NOTE: non-standard, same result as lower_bound, but the loop has no data dependent branch:
+//       the compare result only selects the next base (cmov), so there are no mispredictions;
+//       only worth it for random access iterators
+template <typename RandomIt, typename T, typename Compare>
+[[nodiscard]] constexpr RandomIt branchless_lower_bound(RandomIt first, RandomIt last, const T& value, Compare comp) {
+    auto count = lw_std::distance(first, last);
+    if (count == 0) return first;
+
+    while (count > 1) {
+        auto half = count / 2;
+        first = comp(*lw_std::next(first, half), value) ? lw_std::next(first, half) : first;
+        count -= half;
+    }
+
+    return comp(*first, value) ? lw_std::next(first) : first;
+}
+
+template <typename RandomIt, typename T>
+[[nodiscard]] constexpr RandomIt branchless_lower_bound(RandomIt first, RandomIt last, const T& value) {
+    return lw_std::branchless_lower_bound(
+        first, last, value, [](const auto& a, const auto& b) constexpr { return a < b; });
+}
+
 /*
     Minimum/maximum operations
 */
@@ -178,9 +332,17 @@ template <typename T, typename Compare>
 // equal (1) https://en.cppreference.com/w/cpp/algorithm/equal
 template <typename InputIt1, typename InputIt2>
 [[nodiscard]] constexpr bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
-    return equal(
-        first1, last1, first2,
-        [](typename InputIt1::value_type x, typename InputIt2::value_type y) constexpr { return x == y; });
+    if constexpr (is_vectorizable_compare_v<InputIt1, InputIt2>) {
+        if (!is_constant_evaluated())
+            return vectorized_equal(first1, first2, static_cast<size_t>(last1 - first1));
+    }
+
+    for (; first1 != last1; ++first1, ++first2) {
+        if (!(*first1 == *first2))
+            return false;
+    }
+
+    return true;
 }
 
 // FIXME: equal (2) https://en.cppreference.com/w/cpp/algorithm/equal
@@ -201,9 +363,17 @@ template <typename InputIt1, typename InputIt2, typename BinaryPredicate>
 // equal (5) https://en.cppreference.com/w/cpp/algorithm/equal
 template <typename InputIt1, typename InputIt2>
 [[nodiscard]] constexpr bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2) {
-    return equal(
-        first1, last1, first2, last2,
-        [](const typename InputIt1::reference a, const typename InputIt2::reference b) constexpr { return a == b; });
+    if constexpr (is_vectorizable_compare_v<InputIt1, InputIt2>) {
+        if (!is_constant_evaluated())
+            return last1 - first1 == last2 - first2 && vectorized_equal(first1, first2, static_cast<size_t>(last1 - first1));
+    }
+
+    for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+        if (!(*first1 == *first2))
+            return false;
+    }
+
+    return first1 == last1 && first2 == last2;
 }
 
 // FIXME: equal (6) https://en.cppreference.com/w/cpp/algorithm/equal
@@ -216,34 +386,69 @@ template <typename InputIt1, typename InputIt2, typename BinaryPredicate>
             return false;
     }
 
-    return true;
+    // NOTE: ranges of different length are never equal
+    return first1 == last1 && first2 == last2;
 }
 
 // FIXME: equal (8) https://en.cppreference.com/w/cpp/algorithm/equal
 
+// lexicographical_compare (3) https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare
+template <typename InputIt1, typename InputIt2, typename Compare>
+[[nodiscard]] constexpr bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Compare comp) {
+    // NOTE: only comp is known, so an equivalent pair of elements takes two calls, use
+    //       lexicographical_compare_three_way to compare every pair once
+    for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+        if (comp(*first1, *first2))
+            return true;
+        if (comp(*first2, *first1))
+            return false;
+    }
+
+    return first1 == last1 && first2 != last2;
+}
+
 // lexicographical_compare (1) https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare
 template <typename InputIt1, typename InputIt2>
 [[nodiscard]] constexpr bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2) {
-    return lexicographical_compare(
-        first1, last1, first2, last2,
-        [](const typename InputIt1::reference a, const typename InputIt1::reference b) constexpr { return a < b; });
+    if constexpr (is_vectorizable_compare_v<InputIt1, InputIt2>) {
+        if (!is_constant_evaluated()) {
+            // NOTE: only the first mismatch decides, find it a block at a time
+            return vectorized_compare_three_way(first1, static_cast<size_t>(last1 - first1), first2, static_cast<size_t>(last2 - first2)) < 0;
+        }
+    }
+
+    return lw_std::lexicographical_compare(
+        first1, last1, first2, last2, [](const auto& a, const auto& b) constexpr { return a < b; });
 }
 
 // FIXME: lexicographical_compare (2) https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare
 
-// lexicographical_compare (3) https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare
-template <typename InputIt1, typename InputIt2, typename Compare>
-[[nodiscard]] constexpr bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Compare comp) {
+// FIXME: lexicographical_compare (4) https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare
+
+// lexicographical_compare_three_way (1) https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare_three_way
+// NOTE: comp returns an int (see compare.hpp)
+template <typename InputIt1, typename InputIt2, typename Cmp>
+[[nodiscard]] constexpr auto lexicographical_compare_three_way(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Cmp comp)
+    -> decltype(comp(*first1, *first2)) {
     for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
-        bool comp_1_2 = comp(*first1, *first2);
-        bool comp_2_1 = comp(*first2, *first1);
-        if (!comp_1_2 && !comp_2_1)
-            return comp_1_2;
+        if (auto res = comp(*first1, *first2); res != 0)
+            return res;
     }
 
-    return first1 == last1 && first2 != last2;
+    if (first1 != last1) return 1;
+    if (first2 != last2) return -1;
+    return 0;
 }
 
-// FIXME: lexicographical_compare (4) https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare
+// lexicographical_compare_three_way (2) https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare_three_way
+template <typename InputIt1, typename InputIt2>
+[[nodiscard]] constexpr int lexicographical_compare_three_way(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2) {
+    if constexpr (is_vectorizable_compare_v<InputIt1, InputIt2>) {
+        if (!is_constant_evaluated())
+            return vectorized_compare_three_way(first1, static_cast<size_t>(last1 - first1), first2, static_cast<size_t>(last2 - first2));
+    }
+
+    return lw_std::lexicographical_compare_three_way(first1, last1, first2, last2, compare_three_way());
+}
 
 }  // namespace lw_std
\ No newline at end of file
@@ -0,0 +1,580 @@
+// arena_list header (non-standard)
+#pragma once
+
+#ifdef ARDUINO
+#    include <assert.h>
+#else
+#    include <cassert>
+#endif
+
+#include "algorithm.hpp"
+#include "impl/iterator.hpp"
+#include "impl/member_types.hpp"
+#include "iterator.hpp"
+#include "limits.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace lw_std {
+
+// NOTE: non-standard, the smallest unsigned type that can index MaxSize nodes and still has a value left for 'no node'
+template <size_t MaxSize>
+using arena_list_index_t = conditional_t<(MaxSize < numeric_limits<uint16_t>::max()), uint16_t, uint32_t>;
+
+// NOTE: non-standard, the default MaxSize, the most nodes the widest index_type can link (2^32 - 2),
+//       fewer where size_t is narrower than that (65534 with the 16-bit size_t of AVR, which then links by uint16_t)
+inline constexpr size_t arena_list_max_size = numeric_limits<size_t>::max() < numeric_limits<uint32_t>::max() ? numeric_limits<size_t>::max() - 1 : numeric_limits<uint32_t>::max() - 1;
+
+// NOTE: non-standard, a doubly linked list whose nodes all live in one growable vector (the arena) and link by index,
+//       for targets where a pointer per link is expensive and a heap allocation per node fragments the heap;
+//       the links are uint16_t if at most MaxSize < 65535 nodes are needed (uint32_t otherwise), so a list<int> node
+//       of 24 bytes on a 64-bit target shrinks to 8 bytes; erased nodes go to a free list inside the arena and are
+//       reused before it grows; iterators hold an index, so they stay valid when the arena grows (references don't,
+//       the elements are moved into the new arena)
+template <typename T, size_t MaxSize = arena_list_max_size, typename Allocator = allocator<T>>
+class arena_list {
+   public:
+    using index_type = arena_list_index_t<MaxSize>;
+
+   private:
+    static_assert(MaxSize < numeric_limits<index_type>::max(), "arena_list supports at most 2^32 - 2 nodes");
+
+    // NOTE: 'no node', the end of a chain
+    static constexpr index_type npos = numeric_limits<index_type>::max();
+
+   protected:
+    // NOTE: storage is constructed for linked nodes only, free nodes use next for the free list
+    struct node {
+        index_type prev;
+        index_type next;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        [[nodiscard]] T* value() {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        [[nodiscard]] const T* value() const {
+            return reinterpret_cast<const T*>(storage);
+        }
+    };
+
+    typedef typename Allocator::template rebind<node>::other node_allocator_t;
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+    struct iterator_data_t {
+        arena_list* owner;
+        index_type index;
+    };
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    LWSTD_COMMON_VALUE_TYPES(T)
+
+    using allocator_type = Allocator;
+    using iterator = iterator_impl<iterator_def<T, iterator_data_t>, iterator_def<T, iterator_data_t>>;
+    using const_iterator = iterator_impl<iterator_def<const T, iterator_data_t>, iterator>;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    constexpr arena_list() = default;
+
+    constexpr arena_list(const arena_list& other) {
+        operator=(other);
+    }
+
+    constexpr arena_list(arena_list&& other) {
+        operator=(lw_std::move(other));
+    }
+
+    ~arena_list() {
+        destroy_elements();
+    }
+
+    constexpr arena_list& operator=(const arena_list& other) {
+        if (&other != this) {
+            clear();
+            reserve(other.size());
+            for (const auto& item : other)
+                push_back(item);
+        }
+
+        return *this;
+    }
+
+    constexpr arena_list& operator=(arena_list&& other) {
+        if (&other != this) {
+            lw_std::swap(m_nodes, other.m_nodes);
+            lw_std::swap(m_front, other.m_front);
+            lw_std::swap(m_back, other.m_back);
+            lw_std::swap(m_free, other.m_free);
+            lw_std::swap(m_size, other.m_size);
+        }
+        return *this;
+    }
+
+    constexpr void assign(size_type count, const_reference value) {
+        clear();
+        reserve(count);
+        for (size_type i = 0; i < count; ++i)
+            push_back(value);
+    }
+
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr void assign(InputIt first, InputIt last) {
+        clear();
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return m_element_allocator;
+    }
+
+    /*
+        Element access
+    */
+
+    [[nodiscard]] constexpr reference front() {
+        return *m_nodes[m_front].value();
+    }
+
+    [[nodiscard]] constexpr const_reference front() const {
+        return *m_nodes[m_front].value();
+    }
+
+    [[nodiscard]] constexpr reference back() {
+        return *m_nodes[m_back].value();
+    }
+
+    [[nodiscard]] constexpr const_reference back() const {
+        return *m_nodes[m_back].value();
+    }
+
+    /*
+        Iterators
+    */
+
+    [[nodiscard]] constexpr iterator begin() noexcept {
+        return iterator_at(m_front);
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return iterator_at(m_front);
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return iterator_at(m_front);
+    }
+
+    [[nodiscard]] constexpr iterator end() noexcept {
+        return iterator_at(npos);
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return iterator_at(npos);
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return iterator_at(npos);
+    }
+
+    /*
+        Capacity
+    */
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return m_size;
+    }
+
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return MaxSize;
+    }
+
+    // NOTE: the number of nodes in the arena, linked or free
+    [[nodiscard]] constexpr size_type capacity() const noexcept {
+        return m_nodes.size();
+    }
+
+    constexpr void reserve(size_type new_cap) {
+        if (new_cap > capacity()) grow_to(min_of(new_cap, max_size()));
+    }
+
+    /*
+        Modifiers
+    */
+
+    // NOTE: keeps the arena, all its nodes are free afterwards
+    constexpr void clear() noexcept {
+        destroy_elements();
+
+        m_front = m_back = npos;
+        m_free = npos;
+        m_size = 0;
+        push_free_nodes(0, capacity());
+    }
+
+    constexpr iterator insert(const_iterator pos, const_reference value) {
+        // NOTE: value might be an element of this list, which is moved if the arena grows
+        if (m_free == npos) {
+            T copy(value);
+            return emplace(pos, lw_std::move(copy));
+        }
+
+        return emplace(pos, value);
+    }
+
+    constexpr iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, lw_std::move(value));
+    }
+
+    constexpr iterator insert(const_iterator pos, size_type count, const_reference value) {
+        T copy(value);
+
+        // NOTE: inserting in front of the previously inserted element, so the returned iterator is the first one
+        iterator res = to_non_const_iterator(pos);
+        for (size_type i = 0; i < count; ++i)
+            res = emplace(res, copy);
+
+        return res;
+    }
+
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        iterator res = to_non_const_iterator(pos);
+
+        for (bool first_inserted = true; first != last; ++first) {
+            auto inserted = emplace(pos, *first);
+            if (first_inserted) res = inserted;
+            first_inserted = false;
+        }
+
+        return res;
+    }
+
+    // NOTE: args must not refer to elements of this list, insert takes care of that for values;
+    //       inserts nothing and returns end() if the list already holds max_size() elements
+    template <typename... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        index_type index = acquire_node();
+        if (index == npos) return end();
+
+        m_element_allocator.construct(m_nodes[index].value(), lw_std::forward<Args>(args)...);
+        link_before(index_of(pos), index);
+        m_size++;
+
+        return iterator_at(index);
+    }
+
+    constexpr iterator erase(const_iterator pos) {
+        index_type index = index_of(pos);
+        index_type next = m_nodes[index].next;
+
+        unlink(index);
+        m_element_allocator.destroy(m_nodes[index].value());
+        release_node(index);
+        m_size--;
+
+        return iterator_at(next);
+    }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        while (first != last)
+            first = erase(first);
+
+        return to_non_const_iterator(first);
+    }
+
+    constexpr void push_back(const_reference value) {
+        insert(cend(), value);
+    }
+
+    // NOTE: as insert, push_back and push_front do nothing if the list already holds max_size() elements
+    constexpr void push_back(T&& value) {
+        emplace(cend(), lw_std::move(value));
+    }
+
+    // NOTE: the list must hold less than max_size() elements (asserted), there would be no element to refer to;
+    //       use emplace, which returns end() then, if the list may be full
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        assert(size() < max_size());
+        return *emplace(cend(), lw_std::forward<Args>(args)...);
+    }
+
+    constexpr void pop_back() {
+        if (!empty()) erase(iterator_at(m_back));
+    }
+
+    constexpr void push_front(const_reference value) {
+        insert(cbegin(), value);
+    }
+
+    constexpr void push_front(T&& value) {
+        emplace(cbegin(), lw_std::move(value));
+    }
+
+    // NOTE: the list must hold less than max_size() elements (asserted), as with emplace_back
+    template <typename... Args>
+    constexpr reference emplace_front(Args&&... args) {
+        assert(size() < max_size());
+        return *emplace(cbegin(), lw_std::forward<Args>(args)...);
+    }
+
+    constexpr void pop_front() {
+        if (!empty()) erase(iterator_at(m_front));
+    }
+
+    constexpr void swap(arena_list& other) {
+        lw_std::swap(*this, other);
+    }
+
+    /*
+        Operations
+    */
+
+    constexpr size_type remove(const T& value) {
+        // NOTE: value might be an element of this list, so the node holding it is erased last
+        index_type deferred = npos;
+        auto old_size = m_size;
+
+        for (index_type current = m_front; current != npos;) {
+            index_type next = m_nodes[current].next;
+            if (*m_nodes[current].value() == value) {
+                if (m_nodes[current].value() == &value)
+                    deferred = current;
+                else
+                    erase(iterator_at(current));
+            }
+            current = next;
+        }
+
+        if (deferred != npos) erase(iterator_at(deferred));
+        return old_size - m_size;
+    }
+
+    template <typename UnaryPredicate>
+    constexpr size_type remove_if(UnaryPredicate p) {
+        auto old_size = m_size;
+
+        for (index_type current = m_front; current != npos;) {
+            index_type next = m_nodes[current].next;
+            if (p(*m_nodes[current].value()))
+                erase(iterator_at(current));
+            current = next;
+        }
+
+        return old_size - m_size;
+    }
+
+    constexpr void reverse() noexcept {
+        for (index_type current = m_front; current != npos; current = m_nodes[current].prev)
+            lw_std::swap(m_nodes[current].prev, m_nodes[current].next);
+
+        lw_std::swap(m_front, m_back);
+    }
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def {
+        friend arena_list;
+
+       protected:
+        typedef P value_type;
+        typedef IT_P data_type;
+        typedef bidirectional_iterator_tag iterator_category;
+
+        constexpr iterator_def() = default;
+
+        constexpr iterator_def(const IT_P& data)
+            : m_data(data) {}
+
+        template <typename Q, typename IT_Q>
+        constexpr iterator_def(const iterator_def<Q, IT_Q>& other)
+            : m_data(other.m_data) {}
+
+        constexpr iterator_def(const iterator_def& other) {
+            operator=(other);
+        }
+
+        constexpr iterator_def(iterator_def&& other) {
+            operator=(lw_std::move(other));
+        }
+
+        constexpr iterator_def& operator=(const iterator_def& other) {
+            m_data = other.m_data;
+            return *this;
+        }
+
+        constexpr iterator_def& operator=(iterator_def&& other) {
+            m_data = lw_std::move(other.m_data);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
+            return m_data.index == other.m_data.index;
+        }
+
+        [[nodiscard]] constexpr P* get() {
+            return m_data.owner->m_nodes[m_data.index].value();
+        }
+
+        [[nodiscard]] constexpr const P* get() const {
+            return m_data.owner->m_nodes[m_data.index].value();
+        }
+
+        constexpr void advance(ptrdiff_t n) {
+            for (; n > 0 && m_data.index != npos; --n)
+                m_data.index = m_data.owner->m_nodes[m_data.index].next;
+
+            for (; n < 0; ++n)
+                m_data.index = m_data.index != npos ? m_data.owner->m_nodes[m_data.index].prev : m_data.owner->m_back;
+        }
+
+       private:
+        IT_P m_data{nullptr, npos};
+    };
+
+    vector<node, node_allocator_t> m_nodes{};
+    allocator_type m_element_allocator{};
+
+    index_type m_front = npos;
+    index_type m_back = npos;
+    index_type m_free = npos;
+
+    size_type m_size = 0;
+
+    // NOTE: a const list hands out const_iterators only, which never write through the owner
+    [[nodiscard]] constexpr iterator iterator_at(index_type index) const {
+        return iterator(iterator_data_t{const_cast<arena_list*>(this), index});
+    }
+
+    [[nodiscard]] static index_type index_of(const const_iterator& pos) {
+        return static_cast<const typename const_iterator::underlying_type&>(pos).m_data.index;
+    }
+
+    static iterator to_non_const_iterator(const const_iterator& pos) {
+        return iterator(static_cast<const typename const_iterator::underlying_type&>(pos).m_data);
+    }
+
+    // NOTE: a free node, growing the arena if there is none left, or npos if the arena is at max_size()
+    constexpr index_type acquire_node() {
+        if (m_free == npos && capacity() < max_size())
+            grow_to(min_of(max_of(capacity() * 2, size_type{4}), max_size()));
+
+        index_type index = m_free;
+        if (index != npos) m_free = m_nodes[index].next;
+
+        return index;
+    }
+
+    constexpr void release_node(index_type index) noexcept {
+        m_nodes[index].next = m_free;
+        m_free = index;
+    }
+
+    // NOTE: pushed back to front, so the free list hands out the nodes in order of their index
+    constexpr void push_free_nodes(size_type first, size_type last) noexcept {
+        for (size_type i = last; i > first; --i)
+            release_node(static_cast<index_type>(i - 1));
+    }
+
+    // NOTE: a new arena, the nodes keep their indices, so the links and the free list are copied as they are and
+    //       the linked elements are moved over; a vector reallocation could not be used as it would copy the raw
+    //       storage of the nodes
+    constexpr void grow_to(size_type new_cap) {
+        vector<node, node_allocator_t> nodes;
+        nodes.resize(new_cap);
+
+        for (size_type i = 0; i < capacity(); ++i) {
+            nodes[i].prev = m_nodes[i].prev;
+            nodes[i].next = m_nodes[i].next;
+        }
+
+        for (index_type current = m_front; current != npos; current = m_nodes[current].next) {
+            m_element_allocator.construct(nodes[current].value(), lw_std::move(*m_nodes[current].value()));
+            m_element_allocator.destroy(m_nodes[current].value());
+        }
+
+        size_type old_cap = capacity();
+        m_nodes = lw_std::move(nodes);
+        push_free_nodes(old_cap, new_cap);
+    }
+
+    constexpr void destroy_elements() noexcept {
+        for (index_type current = m_front; current != npos; current = m_nodes[current].next)
+            m_element_allocator.destroy(m_nodes[current].value());
+    }
+
+    // NOTE: links the node at index in before next (npos is the end)
+    constexpr void link_before(index_type next, index_type index) noexcept {
+        index_type prev = next != npos ? m_nodes[next].prev : m_back;
+
+        m_nodes[index].prev = prev;
+        m_nodes[index].next = next;
+
+        if (prev != npos)
+            m_nodes[prev].next = index;
+        else
+            m_front = index;
+
+        if (next != npos)
+            m_nodes[next].prev = index;
+        else
+            m_back = index;
+    }
+
+    constexpr void unlink(index_type index) noexcept {
+        index_type prev = m_nodes[index].prev;
+        index_type next = m_nodes[index].next;
+
+        if (prev != npos)
+            m_nodes[prev].next = next;
+        else
+            m_front = next;
+
+        if (next != npos)
+            m_nodes[next].prev = prev;
+        else
+            m_back = prev;
+    }
+};
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+template <typename T, size_t MaxSize, typename Allocator>
+[[nodiscard]] constexpr bool operator==(const arena_list<T, MaxSize, Allocator>& lhs, const arena_list<T, MaxSize, Allocator>& rhs) {
+    return lhs.size() == rhs.size() && lw_std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, size_t MaxSize, typename Allocator>
+[[nodiscard]] constexpr bool operator!=(const arena_list<T, MaxSize, Allocator>& lhs, const arena_list<T, MaxSize, Allocator>& rhs) {
+    return !operator==(lhs, rhs);
+}
+
+template <typename T, size_t MaxSize, typename Allocator, typename U>
+constexpr typename arena_list<T, MaxSize, Allocator>::size_type erase(arena_list<T, MaxSize, Allocator>& c, const U& value) {
+    return c.remove_if([&value](const T& element) { return element == value; });
+}
+
+template <typename T, size_t MaxSize, typename Allocator, typename Pred>
+constexpr typename arena_list<T, MaxSize, Allocator>::size_type erase_if(arena_list<T, MaxSize, Allocator>& c, Pred pred) {
+    return c.remove_if(pred);
+}
+
+}  // namespace lw_std
\ No newline at end of file
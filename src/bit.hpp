@@ -0,0 +1,69 @@
+// bit header https://en.cppreference.com/w/cpp/header/bit
+#pragma once
+
+#include "utility.hpp"
+
+namespace lw_std {
+
+/*
+    FUNCTIONS
+*/
+
+// countr_zero https://en.cppreference.com/w/cpp/numeric/countr_zero
+template <typename T>
+[[nodiscard]] constexpr int countr_zero(T x) noexcept {
+    if (x == 0) return static_cast<int>(sizeof(T) * 8);
+
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (sizeof(T) <= sizeof(unsigned))
+        return __builtin_ctz(x);
+    else if constexpr (sizeof(T) <= sizeof(unsigned long))
+        return __builtin_ctzl(x);
+    else
+        return __builtin_ctzll(x);
+#else
+    int n = 0;
+    for (; (x & 1) == 0; x >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
+// countr_one https://en.cppreference.com/w/cpp/numeric/countr_one
+template <typename T>
+[[nodiscard]] constexpr int countr_one(T x) noexcept {
+    // NOTE: ~x is promoted to int for types narrower than int
+    if constexpr (sizeof(T) < sizeof(int))
+        return countr_zero(static_cast<T>(~x));
+    else
+        return countr_zero(~x);
+}
+
+// popcount https://en.cppreference.com/w/cpp/numeric/popcount
+template <typename T>
+[[nodiscard]] constexpr int popcount(T x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (sizeof(T) <= sizeof(unsigned))
+        return __builtin_popcount(x);
+    else if constexpr (sizeof(T) <= sizeof(unsigned long))
+        return __builtin_popcountl(x);
+    else
+        return __builtin_popcountll(x);
+#else
+    int n = 0;
+    for (; x != 0; x &= x - 1)
+        ++n;
+    return n;
+#endif
+}
+
+// bit_ceil https://en.cppreference.com/w/cpp/numeric/bit_ceil
+template <typename T>
+[[nodiscard]] constexpr T bit_ceil(T x) noexcept {
+    T res = 1;
+    while (res < x)
+        res = static_cast<T>(res << 1);
+    return res;
+}
+
+}  // namespace lw_std
@@ -0,0 +1,969 @@
+// charconv header https://en.cppreference.com/w/cpp/header/charconv
+#pragma once
+
+#ifdef ARDUINO
+#    include <stdlib.h>
+#    include <string.h>
+#else
+#    include <cstdlib>
+#    include <cstring>
+#endif
+
+#include "algorithm.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace lw_std {
+
+/*
+    CLASSES
+*/
+
+// errc https://en.cppreference.com/w/cpp/error/errc
+// NOTE: only the codes reported by the functions of this header, with the values std::errc has on Linux,
+//       success is errc{} like in std
+enum class errc {
+    invalid_argument = 22,
+    result_out_of_range = 34,
+    value_too_large = 75,
+};
+
+// to_chars_result https://en.cppreference.com/w/cpp/utility/to_chars_result
+struct to_chars_result {
+    char* ptr;
+    errc ec;
+};
+
+// from_chars_result https://en.cppreference.com/w/cpp/utility/from_chars_result
+struct from_chars_result {
+    const char* ptr;
+    errc ec;
+};
+
+// FIXME: chars_format https://en.cppreference.com/w/cpp/utility/chars_format
+
+namespace impl {
+
+/*
+    Integers
+*/
+
+inline constexpr char digit_pairs[] =
+    "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+    "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+inline constexpr char digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// NOTE: the types narrower than unsigned int are converted in unsigned int
+template <typename T>
+using to_chars_unsigned_t = conditional_t<sizeof(T) <= sizeof(unsigned), unsigned, make_unsigned_t<T>>;
+
+// NOTE: the number of decimal digits of value, at least 1
+template <typename U>
+[[nodiscard]] constexpr int decimal_digits(U value) noexcept {
+    for (int digits = 1;; digits += 4) {
+        if (value < 10u) return digits;
+        if (value < 100u) return digits + 1;
+        if (value < 1000u) return digits + 2;
+        if (value < 10000u) return digits + 3;
+        value /= 10000u;
+    }
+}
+
+// NOTE: writes the digits of value back to front ending at last, two at a time from a table
+template <typename U>
+constexpr void write_decimal(char* last, U value) noexcept {
+    while (value >= 100u) {
+        auto pair = static_cast<unsigned>(value % 100u) * 2;
+        value /= 100u;
+        *--last = digit_pairs[pair + 1];
+        *--last = digit_pairs[pair];
+    }
+
+    if (value >= 10u) {
+        auto pair = static_cast<unsigned>(value) * 2;
+        *--last = digit_pairs[pair + 1];
+        *--last = digit_pairs[pair];
+    } else {
+        *--last = static_cast<char>('0' + value);
+    }
+}
+
+// NOTE: the value of a digit in any base up to 36, 36 for anything else
+[[nodiscard]] constexpr unsigned digit_value(char ch) noexcept {
+    auto c = static_cast<unsigned char>(ch);
+    if (c - unsigned{'0'} < 10u) return c - unsigned{'0'};
+
+    c |= 0x20;  // NOTE: lowercase for letters
+    if (c - unsigned{'a'} < 26u) return c - unsigned{'a'} + 10u;
+    return 36;
+}
+
+/*
+    Floating point
+*/
+
+// NOTE: picked by size, so a double of 32 bits (e.g. on AVR) is handled like a float
+template <typename Float>
+struct float_layout {
+    static_assert(sizeof(Float) == 4 || sizeof(Float) == 8, "float_layout: only 32 and 64 bit floating point types");
+
+    using bits_type = conditional_t<sizeof(Float) == 4, uint32_t, uint64_t>;
+
+    static constexpr int significand_bits = sizeof(Float) == 4 ? 23 : 52;
+    static constexpr int exponent_bits = sizeof(Float) == 4 ? 8 : 11;
+
+    // NOTE: for the significand as an integer, value = significand * 2^(biased exponent - exponent_bias)
+    static constexpr int exponent_bias = (1 << (exponent_bits - 1)) - 1 + significand_bits;
+
+    static constexpr bits_type sign_mask = bits_type{1} << (significand_bits + exponent_bits);
+    static constexpr bits_type exponent_mask = ((bits_type{1} << exponent_bits) - 1) << significand_bits;
+    static constexpr bits_type significand_mask = (bits_type{1} << significand_bits) - 1;
+
+    // NOTE: powers of ten up to this are exact, just like integers up to 2^(significand_bits + 1)
+    static constexpr int max_exact_power_of_ten = sizeof(Float) == 4 ? 10 : 22;
+
+    // NOTE: a halfway point between two neighbouring values has at most 767 (float 112) significant digits,
+    //       so the digits behind these only decide the rounding by whether any of them is nonzero
+    static constexpr int max_significant_digits = sizeof(Float) == 4 ? 114 : 768;
+};
+
+template <typename Float>
+[[nodiscard]] inline typename float_layout<Float>::bits_type float_to_bits(Float value) noexcept {
+    typename float_layout<Float>::bits_type bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+template <typename Float>
+[[nodiscard]] inline Float float_from_bits(typename float_layout<Float>::bits_type bits) noexcept {
+    Float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// NOTE: "do it yourself floating point" of Grisu, f * 2^e with a 64-bit significand
+struct diy_fp {
+    uint64_t f;
+    int e;
+};
+
+// NOTE: the upper 64 bits of the 128-bit product, rounded
+[[nodiscard]] inline diy_fp diy_multiply(diy_fp x, diy_fp y) noexcept {
+    const uint64_t mask = 0xFFFFFFFFu;
+    uint64_t a = x.f >> 32, b = x.f & mask, c = y.f >> 32, d = y.f & mask;
+    uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t middle = (bd >> 32) + (ad & mask) + (bc & mask) + (uint64_t{1} << 31);
+    return {ac + (ad >> 32) + (bc >> 32) + (middle >> 32), x.e + y.e + 64};
+}
+
+// NOTE: f has to be non-zero
+[[nodiscard]] inline diy_fp diy_normalize(diy_fp v) noexcept {
+    while ((v.f >> 54) == 0) {
+        v.f <<= 10;
+        v.e -= 10;
+    }
+    while ((v.f >> 63) == 0) {
+        v.f <<= 1;
+        --v.e;
+    }
+    return v;
+}
+
+struct cached_power {
+    uint64_t f;
+    int16_t e;
+};
+
+// NOTE: 10^-348, 10^-340, ..., 10^340 normalized to 64 bits (870 bytes)
+inline constexpr cached_power cached_powers[] = {
+    {0xfa8fd5a0081c0288ULL, -1220}, {0xbaaee17fa23ebf76ULL, -1193}, {0x8b16fb203055ac76ULL, -1166},
+    {0xcf42894a5dce35eaULL, -1140}, {0x9a6bb0aa55653b2dULL, -1113}, {0xe61acf033d1a45dfULL, -1087},
+    {0xab70fe17c79ac6caULL, -1060}, {0xff77b1fcbebcdc4fULL, -1034}, {0xbe5691ef416bd60cULL, -1007},
+    {0x8dd01fad907ffc3cULL, -980}, {0xd3515c2831559a83ULL, -954}, {0x9d71ac8fada6c9b5ULL, -927},
+    {0xea9c227723ee8bcbULL, -901}, {0xaecc49914078536dULL, -874}, {0x823c12795db6ce57ULL, -847},
+    {0xc21094364dfb5637ULL, -821}, {0x9096ea6f3848984fULL, -794}, {0xd77485cb25823ac7ULL, -768},
+    {0xa086cfcd97bf97f4ULL, -741}, {0xef340a98172aace5ULL, -715}, {0xb23867fb2a35b28eULL, -688},
+    {0x84c8d4dfd2c63f3bULL, -661}, {0xc5dd44271ad3cdbaULL, -635}, {0x936b9fcebb25c996ULL, -608},
+    {0xdbac6c247d62a584ULL, -582}, {0xa3ab66580d5fdaf6ULL, -555}, {0xf3e2f893dec3f126ULL, -529},
+    {0xb5b5ada8aaff80b8ULL, -502}, {0x87625f056c7c4a8bULL, -475}, {0xc9bcff6034c13053ULL, -449},
+    {0x964e858c91ba2655ULL, -422}, {0xdff9772470297ebdULL, -396}, {0xa6dfbd9fb8e5b88fULL, -369},
+    {0xf8a95fcf88747d94ULL, -343}, {0xb94470938fa89bcfULL, -316}, {0x8a08f0f8bf0f156bULL, -289},
+    {0xcdb02555653131b6ULL, -263}, {0x993fe2c6d07b7facULL, -236}, {0xe45c10c42a2b3b06ULL, -210},
+    {0xaa242499697392d3ULL, -183}, {0xfd87b5f28300ca0eULL, -157}, {0xbce5086492111aebULL, -130},
+    {0x8cbccc096f5088ccULL, -103}, {0xd1b71758e219652cULL, -77}, {0x9c40000000000000ULL, -50},
+    {0xe8d4a51000000000ULL, -24}, {0xad78ebc5ac620000ULL, 3}, {0x813f3978f8940984ULL, 30},
+    {0xc097ce7bc90715b3ULL, 56}, {0x8f7e32ce7bea5c70ULL, 83}, {0xd5d238a4abe98068ULL, 109},
+    {0x9f4f2726179a2245ULL, 136}, {0xed63a231d4c4fb27ULL, 162}, {0xb0de65388cc8ada8ULL, 189},
+    {0x83c7088e1aab65dbULL, 216}, {0xc45d1df942711d9aULL, 242}, {0x924d692ca61be758ULL, 269},
+    {0xda01ee641a708deaULL, 295}, {0xa26da3999aef774aULL, 322}, {0xf209787bb47d6b85ULL, 348},
+    {0xb454e4a179dd1877ULL, 375}, {0x865b86925b9bc5c2ULL, 402}, {0xc83553c5c8965d3dULL, 428},
+    {0x952ab45cfa97a0b3ULL, 455}, {0xde469fbd99a05fe3ULL, 481}, {0xa59bc234db398c25ULL, 508},
+    {0xf6c69a72a3989f5cULL, 534}, {0xb7dcbf5354e9beceULL, 561}, {0x88fcf317f22241e2ULL, 588},
+    {0xcc20ce9bd35c78a5ULL, 614}, {0x98165af37b2153dfULL, 641}, {0xe2a0b5dc971f303aULL, 667},
+    {0xa8d9d1535ce3b396ULL, 694}, {0xfb9b7cd9a4a7443cULL, 720}, {0xbb764c4ca7a44410ULL, 747},
+    {0x8bab8eefb6409c1aULL, 774}, {0xd01fef10a657842cULL, 800}, {0x9b10a4e5e9913129ULL, 827},
+    {0xe7109bfba19c0c9dULL, 853}, {0xac2820d9623bf429ULL, 880}, {0x80444b5e7aa7cf85ULL, 907},
+    {0xbf21e44003acdd2dULL, 933}, {0x8e679c2f5e44ff8fULL, 960}, {0xd433179d9c8cb841ULL, 986},
+    {0x9e19db92b4e31ba9ULL, 1013}, {0xeb96bf6ebadf77d9ULL, 1039}, {0xaf87023b9bf0ee6bULL, 1066}
+};
+
+// NOTE: the cached power c = 10^-k for which the product with a normalized w of exponent e has an exponent
+//       in [-60, -32]; ceil((-61 - e) * log10(2)) in integers, log10(2) * 2^32 rounded down
+[[nodiscard]] inline diy_fp cached_power_for(int e, int& k) noexcept {
+    int64_t scaled = int64_t{-61 - e} * 1292913986;
+    int ceiled = static_cast<int>(scaled >> 32) + ((scaled & 0xFFFFFFFF) != 0 ? 1 : 0);
+    int index = ((ceiled + 347) >> 3) + 1;
+
+    k = 348 - index * 8;
+    return {cached_powers[index].f, cached_powers[index].e};
+}
+
+inline constexpr uint32_t powers_of_ten_32[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+// NOTE: Grisu3's round_weed, moves the last digit down while that brings the digits closer to w, then checks that
+//       they are the closest ones and certainly inside the interval despite the products being off by up to a unit
+[[nodiscard]] inline bool grisu_round_weed(char* digits, int length, uint64_t distance, uint64_t delta, uint64_t rest, uint64_t ten_kappa,
+                                           uint64_t unit) noexcept {
+    const uint64_t small_distance = distance - unit;
+    const uint64_t big_distance = distance + unit;
+
+    while (rest < small_distance && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < small_distance || small_distance - rest >= rest + ten_kappa - small_distance)) {
+        --digits[length - 1];
+        rest += ten_kappa;
+    }
+
+    if (rest < big_distance && delta - rest >= ten_kappa && (rest + ten_kappa < big_distance || big_distance - rest > rest + ten_kappa - big_distance))
+        return false;
+
+    return 2 * unit <= rest && rest <= delta - 4 * unit;
+}
+
+// NOTE: generates the digits of upper until they are inside the interval of width delta below it, false if the
+//       digits may not be the shortest and closest ones
+[[nodiscard]] inline bool grisu_digits(diy_fp w, diy_fp upper, uint64_t delta, char* digits, int& length, int& k) noexcept {
+    const int shift = -upper.e;
+    const uint64_t one = uint64_t{1} << shift;
+    const uint64_t distance = upper.f - w.f;
+
+    auto integral = static_cast<uint32_t>(upper.f >> shift);
+    uint64_t fraction = upper.f & (one - 1);
+    int kappa = decimal_digits(integral);
+    length = 0;
+
+    while (kappa > 0) {
+        uint32_t divisor = powers_of_ten_32[kappa - 1];
+        uint32_t digit = integral / divisor;
+        integral %= divisor;
+        if (digit != 0 || length != 0) digits[length++] = static_cast<char>('0' + digit);
+        --kappa;
+
+        uint64_t rest = (uint64_t{integral} << shift) + fraction;
+        if (rest < delta) {
+            k += kappa;
+            return grisu_round_weed(digits, length, distance, delta, rest, uint64_t{powers_of_ten_32[kappa]} << shift, 1);
+        }
+    }
+
+    for (uint64_t unit = 1;;) {
+        fraction *= 10;
+        delta *= 10;
+        unit *= 10;
+        auto digit = static_cast<char>(fraction >> shift);
+        if (digit != 0 || length != 0) digits[length++] = static_cast<char>('0' + digit);
+        fraction &= one - 1;
+        --kappa;
+
+        if (fraction < delta) {
+            k += kappa;
+            return grisu_round_weed(digits, length, distance * unit, delta, fraction, one, unit);
+        }
+    }
+}
+
+// NOTE: Grisu3 of Florian Loitsch, the digits of a finite positive value (given by its bits) and their exponent:
+//       value is about digits * 10^k; false for the about 0.5% of the values for which the 64-bit products can't
+//       tell whether the digits are the shortest and closest ones; no tables beyond the cached powers
+template <typename Float>
+[[nodiscard]] inline bool grisu3(typename float_layout<Float>::bits_type bits, char* digits, int& length, int& k) noexcept {
+    using layout = float_layout<Float>;
+
+    const uint64_t hidden_bit = uint64_t{1} << layout::significand_bits;
+    const auto biased_exponent = static_cast<int>(bits >> layout::significand_bits);
+    const uint64_t significand = bits & layout::significand_mask;
+
+    diy_fp v = biased_exponent != 0 ? diy_fp{significand | hidden_bit, biased_exponent - layout::exponent_bias}
+                                    : diy_fp{significand, 1 - layout::exponent_bias};
+
+    // NOTE: the boundaries halfway to the neighbours, the lower neighbour is closer above a power of two
+    diy_fp upper = diy_normalize({(v.f << 1) + 1, v.e - 1});
+    diy_fp lower = v.f == hidden_bit && biased_exponent > 1 ? diy_fp{(v.f << 2) - 1, v.e - 2} : diy_fp{(v.f << 1) - 1, v.e - 1};
+    lower.f <<= lower.e - upper.e;
+    lower.e = upper.e;
+
+    diy_fp c = cached_power_for(upper.e, k);
+    diy_fp w = diy_multiply(diy_normalize(v), c);
+    diy_fp w_upper = diy_multiply(upper, c);
+    diy_fp w_lower = diy_multiply(lower, c);
+
+    // NOTE: one unit outwards on both sides, the products may be off by one; round_weed checks the digits against
+    //       the interval one unit inwards
+    --w_lower.f;
+    ++w_upper.f;
+
+    return grisu_digits(w, w_upper, w_upper.f - w_lower.f, digits, length, k);
+}
+
+// NOTE: an unsigned integer of up to 40 32-bit limbs (least significant first), enough for the exact fallback of
+//       the shortest digits: the largest numbers there are about 2^1080, the smallest subnormal double is 2^-1074
+struct big_uint {
+    uint32_t limbs[40];
+    int size;
+};
+
+inline void big_trim(big_uint& x) noexcept {
+    while (x.size > 0 && x.limbs[x.size - 1] == 0)
+        --x.size;
+}
+
+inline void big_assign(big_uint& x, uint64_t value) noexcept {
+    x.limbs[0] = static_cast<uint32_t>(value);
+    x.limbs[1] = static_cast<uint32_t>(value >> 32);
+    x.size = 2;
+    big_trim(x);
+}
+
+inline void big_multiply(big_uint& x, uint32_t factor) noexcept {
+    uint64_t carry = 0;
+    for (int i = 0; i < x.size; ++i) {
+        uint64_t product = uint64_t{x.limbs[i]} * factor + carry;
+        x.limbs[i] = static_cast<uint32_t>(product);
+        carry = product >> 32;
+    }
+    if (carry != 0) x.limbs[x.size++] = static_cast<uint32_t>(carry);
+}
+
+inline void big_multiply_pow10(big_uint& x, int exponent) noexcept {
+    for (; exponent >= 9; exponent -= 9)
+        big_multiply(x, powers_of_ten_32[9]);
+    big_multiply(x, powers_of_ten_32[exponent]);
+}
+
+inline void big_shift_left(big_uint& x, int shift) noexcept {
+    const int limbs = shift / 32;
+    const int bits = shift % 32;
+
+    // NOTE: from the top down, so every limb is read before it is overwritten
+    x.limbs[x.size + limbs] = 0;
+    for (int i = x.size - 1; i >= 0; --i) {
+        if (bits != 0) x.limbs[i + limbs + 1] |= x.limbs[i] >> (32 - bits);
+        x.limbs[i + limbs] = x.limbs[i] << bits;
+    }
+    for (int i = 0; i < limbs; ++i)
+        x.limbs[i] = 0;
+
+    x.size += limbs + 1;
+    big_trim(x);
+}
+
+inline void big_add(big_uint& x, const big_uint& y) noexcept {
+    const int size = max_of(x.size, y.size);
+    uint64_t carry = 0;
+    for (int i = 0; i < size; ++i) {
+        uint64_t sum = uint64_t{i < x.size ? x.limbs[i] : 0u} + (i < y.size ? y.limbs[i] : 0u) + carry;
+        x.limbs[i] = static_cast<uint32_t>(sum);
+        carry = sum >> 32;
+    }
+    x.size = size;
+    if (carry != 0) x.limbs[x.size++] = static_cast<uint32_t>(carry);
+}
+
+// NOTE: x has to be at least y
+inline void big_subtract(big_uint& x, const big_uint& y) noexcept {
+    uint64_t borrow = 0;
+    for (int i = 0; i < x.size; ++i) {
+        uint64_t difference = uint64_t{x.limbs[i]} - (i < y.size ? y.limbs[i] : 0u) - borrow;
+        x.limbs[i] = static_cast<uint32_t>(difference);
+        borrow = difference >> 63;
+    }
+    big_trim(x);
+}
+
+[[nodiscard]] inline int big_compare(const big_uint& x, const big_uint& y) noexcept {
+    if (x.size != y.size) return x.size < y.size ? -1 : 1;
+    for (int i = x.size - 1; i >= 0; --i)
+        if (x.limbs[i] != y.limbs[i]) return x.limbs[i] < y.limbs[i] ? -1 : 1;
+    return 0;
+}
+
+// NOTE: the compare of x + y to z
+[[nodiscard]] inline int big_compare_sum(const big_uint& x, const big_uint& y, const big_uint& z) noexcept {
+    big_uint sum = x;
+    big_add(sum, y);
+    return big_compare(sum, z);
+}
+
+// NOTE: the exact fallback of grisu3 (free-format Dragon4 of Steele & White), same interface: value = r / s and the
+//       interval to its neighbours [r - m_minus, r + m_plus] / s in big integers, scaled by 10^-k into [0.1, 1);
+//       the digits of r / s up to the first that can end inside the interval, then the closer of that digit and
+//       the next one up, the even one on a tie; the interval includes its bounds for an even significand, which
+//       parse back to value as ties round to even; a few microseconds, but only the values Grisu3 rejects get here
+template <typename Float>
+[[nodiscard]] inline int dragon4(typename float_layout<Float>::bits_type bits, char* digits, int& k) noexcept {
+    using layout = float_layout<Float>;
+
+    const uint64_t hidden_bit = uint64_t{1} << layout::significand_bits;
+    const auto biased_exponent = static_cast<int>(bits >> layout::significand_bits);
+    const uint64_t significand = bits & layout::significand_mask;
+    const uint64_t f = biased_exponent != 0 ? significand | hidden_bit : significand;
+    const int e = biased_exponent != 0 ? biased_exponent - layout::exponent_bias : 1 - layout::exponent_bias;
+    const bool inclusive = (f & 1) == 0;
+
+    // NOTE: value = 2 * f / 2, halfway to the neighbours is 1 / 2 away; above a power of two the lower neighbour
+    //       is closer, there value = 4 * f / 4 with 2 / 4 up and 1 / 4 down
+    const int scale = significand == 0 && biased_exponent > 1 ? 2 : 1;
+    big_uint r, s, m_plus, m_minus;
+    big_assign(r, f << scale);
+    big_assign(s, uint64_t{1} << scale);
+    big_assign(m_plus, uint64_t{1} << (scale - 1));
+    big_assign(m_minus, 1);
+    if (e >= 0) {
+        big_shift_left(r, e);
+        big_shift_left(m_plus, e);
+        big_shift_left(m_minus, e);
+    } else {
+        big_shift_left(s, -e);
+    }
+
+    // NOTE: ceil(log2(value) * log10(2)) as in cached_power_for, value * 10^-k is in [0.1, 1) or the upper bound
+    //       may reach 1, then one more power
+    int64_t scaled = int64_t{diy_normalize({f, e}).e + 63} * 1292913986;
+    k = static_cast<int>(scaled >> 32) + ((scaled & 0xFFFFFFFF) != 0 ? 1 : 0);
+    if (k >= 0) {
+        big_multiply_pow10(s, k);
+    } else {
+        big_multiply_pow10(r, -k);
+        big_multiply_pow10(m_plus, -k);
+        big_multiply_pow10(m_minus, -k);
+    }
+
+    const int upper = big_compare_sum(r, m_plus, s);
+    if (inclusive ? upper >= 0 : upper > 0) {
+        big_multiply(s, 10);
+        ++k;
+    }
+
+    int length = 0;
+    for (;;) {
+        big_multiply(r, 10);
+        big_multiply(m_plus, 10);
+        big_multiply(m_minus, 10);
+
+        char digit = '0';
+        for (; big_compare(r, s) >= 0; ++digit)
+            big_subtract(r, s);
+
+        const int low = big_compare(r, m_minus);
+        const int high = big_compare_sum(r, m_plus, s);
+        const bool low_inside = inclusive ? low <= 0 : low < 0;
+        const bool high_inside = inclusive ? high >= 0 : high > 0;
+
+        if (low_inside && high_inside) {
+            const int half = big_compare_sum(r, r, s);
+            if (half > 0 || (half == 0 && (digit & 1) != 0)) ++digit;
+        } else if (high_inside) {
+            ++digit;
+        }
+
+        digits[length++] = digit;
+        if (low_inside || high_inside) break;
+    }
+
+    k -= length;
+    return length;
+}
+
+// NOTE: the shortest digits that parse back to a finite positive value (given by its bits), the closest of them
+//       and the even one on a tie, as std::to_chars; value is about digits * 10^k
+template <typename Float>
+[[nodiscard]] inline int shortest_digits(typename float_layout<Float>::bits_type bits, char* digits, int& k) noexcept {
+    int length = 0;
+    if (!grisu3<Float>(bits, digits, length, k)) length = dragon4<Float>(bits, digits, k);
+
+    while (length > 1 && digits[length - 1] == '0') {
+        --length;
+        ++k;
+    }
+    return length;
+}
+
+// NOTE: the lengths of digits * 10^k in plain ("%f" like) and in exponent ("%e" like, at least two exponent digits)
+//       notation, std::to_chars without a format picks the shorter one, plain on a tie
+[[nodiscard]] constexpr int plain_notation_length(int length, int k) noexcept {
+    return k >= 0 ? length + k : (length + k > 0 ? length + 1 : 2 - (length + k) + length);
+}
+
+[[nodiscard]] constexpr int exponent_notation_length(int length, int k) noexcept {
+    const int exponent = length + k - 1;
+    return length + (length > 1 ? 1 : 0) + (exponent >= 100 || exponent <= -100 ? 5 : 4);
+}
+
+// NOTE: writes digits * 10^k in the shorter notation, returns the end of the output
+inline char* write_shortest(char* out, const char* digits, int length, int k) noexcept {
+    const int point = length + k;
+    const int exponent = point - 1;
+    const int abs_exponent = exponent < 0 ? -exponent : exponent;
+    const int plain_length = plain_notation_length(length, k);
+
+    if (plain_length <= exponent_notation_length(length, k)) {
+        if (k >= 0) {
+            memcpy(out, digits, static_cast<size_t>(length));
+            memset(out + length, '0', static_cast<size_t>(k));
+        } else if (point > 0) {
+            memcpy(out, digits, static_cast<size_t>(point));
+            out[point] = '.';
+            memcpy(out + point + 1, digits + point, static_cast<size_t>(-k));
+        } else {
+            out[0] = '0';
+            out[1] = '.';
+            memset(out + 2, '0', static_cast<size_t>(-point));
+            memcpy(out + 2 - point, digits, static_cast<size_t>(length));
+        }
+        return out + plain_length;
+    }
+
+    *out++ = digits[0];
+    if (length > 1) {
+        *out++ = '.';
+        memcpy(out, digits + 1, static_cast<size_t>(length - 1));
+        out += length - 1;
+    }
+
+    *out++ = 'e';
+    *out++ = exponent < 0 ? '-' : '+';
+    if (abs_exponent >= 100) *out++ = static_cast<char>('0' + abs_exponent / 100);
+    *out++ = digit_pairs[abs_exponent % 100 * 2];
+    *out++ = digit_pairs[abs_exponent % 100 * 2 + 1];
+    return out;
+}
+
+// NOTE: the exact digits of an integral value (given by its bits), which std::to_chars prints in plain notation
+//       rather than the shortest digits padded with zeros (e.g. 76252852958605088, not 76252852958605090);
+//       doubled digit by digit, only values below 10^24 get here
+template <typename Float>
+[[nodiscard]] inline int exact_integer_digits(typename float_layout<Float>::bits_type bits, char* digits) noexcept {
+    using layout = float_layout<Float>;
+
+    const auto biased_exponent = static_cast<int>(bits >> layout::significand_bits);
+    uint64_t significand = (bits & layout::significand_mask) | (uint64_t{1} << layout::significand_bits);
+    int exponent = biased_exponent - layout::exponent_bias;
+    if (exponent < 0) {
+        significand >>= -exponent;
+        exponent = 0;
+    }
+
+    // NOTE: least significant digit first
+    uint8_t reversed[32];
+    int length = 0;
+    for (; significand != 0; significand /= 10)
+        reversed[length++] = static_cast<uint8_t>(significand % 10);
+
+    for (; exponent > 0; --exponent) {
+        unsigned carry = 0;
+        for (int i = 0; i < length; ++i) {
+            unsigned doubled = 2u * reversed[i] + carry;
+            carry = doubled >= 10 ? 1 : 0;
+            reversed[i] = static_cast<uint8_t>(doubled - 10 * carry);
+        }
+        if (carry != 0) reversed[length++] = 1;
+    }
+
+    for (int i = 0; i < length; ++i)
+        digits[i] = static_cast<char>('0' + reversed[length - 1 - i]);
+    return length;
+}
+
+template <typename Float>
+[[nodiscard]] inline to_chars_result float_to_chars(char* first, char* last, Float value) noexcept {
+    using layout = float_layout<Float>;
+
+    // NOTE: enough for a sign, 17 digits, a point and a three digit exponent
+    char buffer[32];
+    char* out = buffer;
+
+    auto bits = float_to_bits(value);
+    if ((bits & layout::sign_mask) != 0) *out++ = '-';
+    bits &= ~layout::sign_mask;
+
+    if ((bits & layout::exponent_mask) == layout::exponent_mask) {
+        memcpy(out, (bits & layout::significand_mask) != 0 ? "nan" : "inf", 3);
+        out += 3;
+    } else if (bits == 0) {
+        *out++ = '0';
+    } else {
+        char digits[32];
+        int k = 0;
+        int length = shortest_digits<Float>(bits, digits, k);
+        if (k > 0 && plain_notation_length(length, k) <= exponent_notation_length(length, k)) {
+            length = exact_integer_digits<Float>(bits, digits);
+            k = 0;
+        }
+        out = write_shortest(out, digits, length, k);
+    }
+
+    auto count = out - buffer;
+    if (last - first < count) return {last, errc::value_too_large};
+
+    memcpy(first, buffer, static_cast<size_t>(count));
+    return {first + count, errc{}};
+}
+
+template <typename Float>
+inline constexpr Float exact_powers_of_ten[] = {Float{1e0}, Float{1e1}, Float{1e2}, Float{1e3}, Float{1e4}, Float{1e5}, Float{1e6}, Float{1e7},
+                                                Float{1e8}, Float{1e9}, Float{1e10}, Float{1e11}, Float{1e12}, Float{1e13}, Float{1e14}, Float{1e15},
+                                                Float{1e16}, Float{1e17}, Float{1e18}, Float{1e19}, Float{1e20}, Float{1e21}, Float{1e22}};
+
+// NOTE: significand * 10^exponent with the cached powers of Grisu: the 64-bit product is off by at most 7 units
+//       in its last place, which decides the rounding to the bits of Float unless the product is that close to
+//       a halfway point (about 1 in 120 for double); false then, and for subnormal or out of range results
+template <typename Float>
+[[nodiscard]] inline bool approximate_from_decimal(uint64_t significand, int exponent, typename float_layout<Float>::bits_type& bits) noexcept {
+    using layout = float_layout<Float>;
+    using bits_type = typename float_layout<Float>::bits_type;
+
+    if (exponent < -348 || exponent >= 348) return false;
+
+    // NOTE: 10^exponent as a cached power times an exact power of ten below 10^8
+    const int index = (exponent + 348) >> 3;
+    const int remainder = exponent + 348 - (index << 3);
+
+    diy_fp w = diy_normalize({significand, 0});
+    if (remainder != 0) w = diy_multiply(w, diy_normalize({powers_of_ten_32[remainder], 0}));
+    w = diy_normalize(diy_multiply(w, {cached_powers[index].f, cached_powers[index].e}));
+
+    constexpr int excess_bits = 64 - (layout::significand_bits + 1);
+    constexpr uint64_t half = uint64_t{1} << (excess_bits - 1);
+    const uint64_t low = w.f & ((half << 1) - 1);
+    if (low + 8 >= half && low <= half + 8) return false;
+
+    uint64_t rounded = (w.f >> excess_bits) + (low > half ? 1 : 0);
+    int binary_exponent = w.e + excess_bits;
+    if ((rounded >> (layout::significand_bits + 1)) != 0) {
+        rounded >>= 1;
+        ++binary_exponent;
+    }
+
+    const int biased_exponent = binary_exponent + layout::exponent_bias;
+    if (biased_exponent <= 0 || biased_exponent >= (1 << layout::exponent_bits) - 1) return false;
+
+    bits = static_cast<bits_type>((static_cast<uint64_t>(biased_exponent) << layout::significand_bits) | (rounded & layout::significand_mask));
+    return true;
+}
+
+// NOTE: advances pos past word if the characters match it case insensitively
+inline bool match_lowercase(const char*& pos, const char* last, const char* word) noexcept {
+    const char* p = pos;
+    for (; *word != '\0'; ++word, ++p)
+        if (p == last || (*p | 0x20) != *word) return false;
+
+    pos = p;
+    return true;
+}
+
+template <typename Float>
+[[nodiscard]] inline from_chars_result float_from_chars(const char* first, const char* last, Float& value) {
+    using layout = float_layout<Float>;
+    using bits_type = typename layout::bits_type;
+
+    const char* pos = first;
+    const bool negative = pos != last && *pos == '-';
+    if (negative) ++pos;
+    const bits_type sign = negative ? layout::sign_mask : 0;
+
+    if (pos != last && ((*pos | 0x20) == 'i' || (*pos | 0x20) == 'n')) {
+        if (match_lowercase(pos, last, "inf")) {
+            match_lowercase(pos, last, "inity");
+            value = float_from_bits<Float>(sign | layout::exponent_mask);
+            return {pos, errc{}};
+        }
+
+        if (match_lowercase(pos, last, "nan")) {
+            // NOTE: "nan(chars)" with letters, digits and underscores, the chars are ignored
+            if (pos != last && *pos == '(') {
+                const char* p = pos + 1;
+                while (p != last && (digit_value(*p) < 36 || *p == '_'))
+                    ++p;
+                if (p != last && *p == ')') pos = p + 1;
+            }
+            value = float_from_bits<Float>(sign | layout::exponent_mask | (bits_type{1} << (layout::significand_bits - 1)));
+            return {pos, errc{}};
+        }
+
+        return {first, errc::invalid_argument};
+    }
+
+    // NOTE: the first 19 significant digits, the others only count for the exponent
+    uint64_t significand = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    bool truncated = false;
+
+    const char* digits_begin = pos;
+    for (; pos != last && digit_value(*pos) < 10; ++pos) {
+        auto digit = digit_value(*pos);
+        if (significant_digits < 19) {
+            significand = significand * 10 + digit;
+            if (significand != 0) ++significant_digits;
+        } else {
+            ++exponent;
+            truncated |= digit != 0;
+        }
+    }
+    bool has_digits = pos != digits_begin;
+
+    if (pos != last && *pos == '.') {
+        const char* fraction_begin = ++pos;
+        for (; pos != last && digit_value(*pos) < 10; ++pos) {
+            auto digit = digit_value(*pos);
+            if (significant_digits < 19) {
+                significand = significand * 10 + digit;
+                if (significand != 0) ++significant_digits;
+                --exponent;
+            } else {
+                truncated |= digit != 0;
+            }
+        }
+        has_digits |= pos != fraction_begin;
+    }
+
+    if (!has_digits) return {first, errc::invalid_argument};
+    const char* digits_end = pos;
+
+    // NOTE: the exponent only belongs to the number if it has digits
+    int explicit_exponent = 0;
+    if (pos != last && (*pos | 0x20) == 'e') {
+        const char* p = pos + 1;
+        const bool negative_exponent = p != last && *p == '-';
+        if (p != last && (*p == '-' || *p == '+')) ++p;
+
+        if (p != last && digit_value(*p) < 10) {
+            for (; p != last && digit_value(*p) < 10; ++p)
+                if (explicit_exponent < 100000) explicit_exponent = explicit_exponent * 10 + static_cast<int>(digit_value(*p));
+
+            if (negative_exponent) explicit_exponent = -explicit_exponent;
+            exponent += explicit_exponent;
+            pos = p;
+        }
+    }
+
+    if (significand == 0) {
+        value = float_from_bits<Float>(sign);
+        return {pos, errc{}};
+    }
+
+    // NOTE: Clinger's fast path, an exact significand times or divided by an exact power of ten is rounded once
+    if (!truncated && significand <= (uint64_t{1} << (layout::significand_bits + 1)) && exponent >= -layout::max_exact_power_of_ten &&
+        exponent <= layout::max_exact_power_of_ten) {
+        auto result = static_cast<Float>(significand);
+        result = exponent < 0 ? result / exact_powers_of_ten<Float>[-exponent] : result * exact_powers_of_ten<Float>[exponent];
+        value = negative ? -result : result;
+        return {pos, errc{}};
+    }
+
+    typename layout::bits_type bits = 0;
+    if (!truncated && approximate_from_decimal<Float>(significand, exponent, bits)) {
+        value = float_from_bits<Float>(sign | bits);
+        return {pos, errc{}};
+    }
+
+    // NOTE: anything else is correctly rounded by strtod (strtof) on a null terminated copy on the stack, written as
+    //       significant digits and an exponent: past max_significant_digits a single nonzero digit stands for all the
+    //       digits cut off, which rounds the same, so the copy fits whatever the length of the input
+    char buffer[layout::max_significant_digits + 16];
+    char* out = buffer;
+    if (negative) *out++ = '-';
+
+    int kept_digits = 0;
+    int buffer_exponent = explicit_exponent;
+    bool in_fraction = false, cut_nonzero = false;
+    for (const char* p = digits_begin; p != digits_end; ++p) {
+        if (*p == '.') {
+            in_fraction = true;
+        } else if (kept_digits < layout::max_significant_digits && (kept_digits != 0 || *p != '0')) {
+            *out++ = *p;
+            ++kept_digits;
+            if (in_fraction) --buffer_exponent;
+        } else if (kept_digits == 0) {
+            if (in_fraction) --buffer_exponent;
+        } else {
+            cut_nonzero |= *p != '0';
+            if (!in_fraction) ++buffer_exponent;
+        }
+    }
+    if (cut_nonzero) {
+        *out++ = '1';
+        --buffer_exponent;
+    }
+
+    *out++ = 'e';
+    if (buffer_exponent < 0) *out++ = '-';
+    auto exponent_magnitude = static_cast<unsigned>(buffer_exponent < 0 ? -buffer_exponent : buffer_exponent);
+    out += decimal_digits(exponent_magnitude);
+    write_decimal(out, exponent_magnitude);
+    *out = '\0';
+
+#ifdef ARDUINO
+    auto result = static_cast<Float>(strtod(buffer, nullptr));
+#else
+    Float result;
+    if constexpr (is_same_v<Float, float>)
+        result = strtof(buffer, nullptr);
+    else
+        result = strtod(buffer, nullptr);
+#endif
+
+    // NOTE: the significand is not zero, so zero is an underflow and infinity an overflow
+    auto result_bits = float_to_bits(result) & ~layout::sign_mask;
+    if (result_bits == 0 || result_bits == layout::exponent_mask) return {pos, errc::result_out_of_range};
+
+    value = result;
+    return {pos, errc{}};
+}
+
+}  // namespace impl
+
+/*
+    FUNCTIONS
+*/
+
+// to_chars (1) https://en.cppreference.com/w/cpp/utility/to_chars
+// NOTE: base 10 is written two digits at a time from a table, the other bases (2 to 36) one digit at a time
+//       with lowercase letters; on error ptr is last and the characters in [first, last) are unspecified
+template <typename T, typename = enable_if_t<is_integral_v<T> && !is_same_v<remove_cv_t<T>, bool>>>
+constexpr to_chars_result to_chars(char* first, char* last, T value, int base = 10) noexcept {
+    using unsigned_type = impl::to_chars_unsigned_t<T>;
+
+    auto bits = static_cast<make_unsigned_t<T>>(value);
+    if constexpr (is_signed_v<T>) {
+        if (value < 0) {
+            if (first == last) return {last, errc::value_too_large};
+            *first++ = '-';
+            bits = static_cast<make_unsigned_t<T>>(0 - bits);
+        }
+    }
+    unsigned_type magnitude = bits;
+
+    if (base == 10) {
+        int digits = impl::decimal_digits(magnitude);
+        if (last - first < digits) return {last, errc::value_too_large};
+
+        impl::write_decimal(first + digits, magnitude);
+        return {first + digits, errc{}};
+    }
+
+    const auto ubase = static_cast<unsigned_type>(base);
+    int digits = 1;
+    for (unsigned_type rest = magnitude / ubase; rest != 0; rest /= ubase)
+        ++digits;
+    if (last - first < digits) return {last, errc::value_too_large};
+
+    char* pos = first + digits;
+    do {
+        *--pos = impl::digit_chars[magnitude % ubase];
+        magnitude /= ubase;
+    } while (magnitude != 0);
+
+    return {first + digits, errc{}};
+}
+
+// to_chars (2) https://en.cppreference.com/w/cpp/utility/to_chars
+// NOTE: the shortest representation that parses back to value (the closest of them, the even one on a tie),
+//       in plain or exponent notation, whichever is shorter; "inf" and "nan" with their sign
+inline to_chars_result to_chars(char* first, char* last, float value) noexcept {
+    return impl::float_to_chars(first, last, value);
+}
+
+// to_chars (2) https://en.cppreference.com/w/cpp/utility/to_chars
+inline to_chars_result to_chars(char* first, char* last, double value) noexcept {
+    return impl::float_to_chars(first, last, value);
+}
+
+// FIXME: to_chars (2) for long double https://en.cppreference.com/w/cpp/utility/to_chars
+// FIXME: to_chars (3) and (4) with a chars_format and a precision https://en.cppreference.com/w/cpp/utility/to_chars
+
+// from_chars (1) https://en.cppreference.com/w/cpp/utility/from_chars
+// NOTE: like std, a '-' only for signed types, no '+', no whitespace, no "0x" prefix, letters in either case
+//       for bases above 10; on error value is not changed
+template <typename T, typename = enable_if_t<is_integral_v<T> && !is_same_v<remove_cv_t<T>, bool>>>
+constexpr from_chars_result from_chars(const char* first, const char* last, T& value, int base = 10) noexcept {
+    using unsigned_type = make_unsigned_t<T>;
+
+    const char* pos = first;
+    bool negative = false;
+    if constexpr (is_signed_v<T>) {
+        negative = pos != last && *pos == '-';
+        if (negative) ++pos;
+    }
+
+    // NOTE: the magnitude of the smallest signed value is one more than the largest one
+    const auto all_ones = static_cast<unsigned_type>(~unsigned_type{0});
+    const auto max_magnitude = static_cast<unsigned_type>(is_signed_v<T> ? (all_ones >> 1) + (negative ? 1u : 0u) : all_ones);
+    const auto ubase = static_cast<unsigned_type>(base);
+    const auto max_before_digit = static_cast<unsigned_type>(max_magnitude / ubase);
+    const auto max_last_digit = static_cast<unsigned>(max_magnitude % ubase);
+
+    unsigned_type magnitude = 0;
+    bool overflow = false;
+    const char* digits_begin = pos;
+    for (; pos != last; ++pos) {
+        unsigned digit = impl::digit_value(*pos);
+        if (digit >= static_cast<unsigned>(base)) break;
+
+        if (magnitude > max_before_digit || (magnitude == max_before_digit && digit > max_last_digit))
+            overflow = true;
+        else
+            magnitude = static_cast<unsigned_type>(magnitude * ubase + digit);
+    }
+
+    if (pos == digits_begin) return {first, errc::invalid_argument};
+    if (overflow) return {pos, errc::result_out_of_range};
+
+    value = static_cast<T>(negative ? static_cast<unsigned_type>(0 - magnitude) : magnitude);
+    return {pos, errc{}};
+}
+
+// from_chars (2) https://en.cppreference.com/w/cpp/utility/from_chars
+// NOTE: the chars_format::general syntax of std: [-]digits[.digits][(e|E)[+|-]digits], "inf", "infinity", "nan"
+//       and "nan(chars)" in any case; digits up to 2^53 (float 2^24) with a decimal exponent of at most 22 (float 10)
+//       are exact with one multiplication or division, up to 19 significant digits are almost always rounded
+//       through the 64-bit cached powers of Grisu, the rest goes through strtod (strtof) on a copy on the stack,
+//       which needs the "C" locale; digits past the 768th (float 114th) significant one are cut off in that copy
+//       (without changing the rounding), so inputs of any length are parsed; on Arduino a float is rounded from a double
+inline from_chars_result from_chars(const char* first, const char* last, float& value) {
+    return impl::float_from_chars(first, last, value);
+}
+
+// from_chars (2) https://en.cppreference.com/w/cpp/utility/from_chars
+inline from_chars_result from_chars(const char* first, const char* last, double& value) {
+    return impl::float_from_chars(first, last, value);
+}
+
+// FIXME: from_chars (2) for long double and with a chars_format https://en.cppreference.com/w/cpp/utility/from_chars
+
+// NOTE: non-standard, appends the characters of value (as written by to_chars) to out without a temporary,
+//       e.g. for a line of samples serialized into one buffer
+template <typename T, typename = enable_if_t<!is_same_v<remove_cv_t<T>, bool>>>
+inline void append_chars(vector<char>& out, T value) {
+    constexpr size_t max_chars = is_integral_v<T> ? 3 * sizeof(T) + 2 : 32;
+
+    // NOTE: reserve allocates exactly what is asked for, growing geometrically keeps many appends amortized O(1)
+    size_t old_size = out.size();
+    if (old_size + max_chars > out.capacity()) out.reserve(max_of(old_size + max_chars, 2 * out.capacity()));
+    out.resize_for_overwrite(old_size + max_chars);
+    auto res = to_chars(out.data() + old_size, out.data() + out.size(), value);
+    out.resize(static_cast<size_t>(res.ptr - out.data()));
+}
+
+}  // namespace lw_std
\ No newline at end of file
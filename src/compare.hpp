@@ -0,0 +1,39 @@
+// compare header https://en.cppreference.com/w/cpp/header/compare
+#pragma once
+
+// NOTE: C++17 has no operator<=> and no ordering types, so three-way results are plain ints here:
+//       less than 0 (less), 0 (equivalent) or greater than 0 (greater)
+
+namespace lw_std {
+
+/*
+    FUNCTIONS
+*/
+
+/*
+    Non-standard
+*/
+
+// NOTE: three-way comparison in terms of operator<, like the exposition only synth-three-way:
+//       https://en.cppreference.com/w/cpp/standard_library/synth-three-way;
+//       containers overload this so nested containers are compared element by element only once
+template <typename T, typename U>
+[[nodiscard]] constexpr int synthesized_cmp_three_way(const T& t, const U& u) {
+    if (t < u) return -1;
+    if (u < t) return 1;
+    return 0;
+}
+
+/*
+    CLASSES
+*/
+
+// compare_three_way https://en.cppreference.com/w/cpp/utility/compare/compare_three_way
+struct compare_three_way {
+    template <typename T, typename U>
+    [[nodiscard]] constexpr int operator()(const T& t, const U& u) const {
+        return synthesized_cmp_three_way(t, u);
+    }
+};
+
+}  // namespace lw_std
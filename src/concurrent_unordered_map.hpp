@@ -0,0 +1,201 @@
+// concurrent_unordered_map header (non-standard)
+#pragma once
+
+// NOTE: needs a hosted platform for std::mutex, not available on Arduino
+#include <mutex>
+
+#include "bit.hpp"
+#include "unordered_map.hpp"
+
+namespace lw_std {
+
+// NOTE: non-standard, an unordered_map for many threads, split into ShardCount independently locked unordered_maps
+//       (striped locking), so threads that work on keys of different shards don't wait for each other;
+//       the shard is taken from the high bits of the multiplicatively mixed hash, the shard map itself indexes
+//       with the low bits, so the keys of one shard still spread over its buckets;
+//       no iterator or reference ever leaves a lock: values are copied out (find), changed in place by a function
+//       called under the lock (update) or visited under the lock (for_each)
+template <typename Key, typename T, size_t ShardCount = 16, typename Hash = hash<Key>, typename Equal = equal_to<Key>, typename Allocator = allocator<pair<const Key, T>>, typename Mutex = std::mutex>
+class concurrent_unordered_map {
+    static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0, "ShardCount has to be a power of two");
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = pair<const Key, T>;
+    using size_type = size_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+    using allocator_type = Allocator;
+    using map_type = unordered_map<Key, T, Hash, Equal, Allocator>;
+
+    static constexpr size_type shard_count = ShardCount;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    concurrent_unordered_map() = default;
+
+    // NOTE: the locks can't be copied or moved, neither can the map
+    concurrent_unordered_map(const concurrent_unordered_map&) = delete;
+    concurrent_unordered_map& operator=(const concurrent_unordered_map&) = delete;
+
+    /*
+        Capacity
+    */
+
+    // NOTE: locks one shard after the other, so the result is only exact if no other thread changes the map
+    [[nodiscard]] size_type size() const {
+        size_type res = 0;
+        for (const auto& s : m_shards) {
+            std::lock_guard<Mutex> guard(s.lock);
+            res += s.map.size();
+        }
+        return res;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return size() == 0;
+    }
+
+    // NOTE: spreads count over the shards, assuming the hash does the same with the keys
+    void reserve(size_type count) {
+        for (auto& s : m_shards) {
+            std::lock_guard<Mutex> guard(s.lock);
+            s.map.reserve(count / ShardCount + 1);
+        }
+    }
+
+    /*
+        Modifiers
+    */
+
+    void clear() {
+        for (auto& s : m_shards) {
+            std::lock_guard<Mutex> guard(s.lock);
+            s.map.clear();
+        }
+    }
+
+    // NOTE: returns whether the value was inserted, false if the key was already there (its value is kept)
+    bool insert(const key_type& key, const mapped_type& value) {
+        return emplace(key, value);
+    }
+
+    bool insert(const key_type& key, mapped_type&& value) {
+        return emplace(key, lw_std::move(value));
+    }
+
+    template <typename... Args>
+    bool emplace(const key_type& key, Args&&... args) {
+        auto& s = shard_of(key);
+        std::lock_guard<Mutex> guard(s.lock);
+        return s.map.emplace(key, mapped_type(lw_std::forward<Args>(args)...)).second;
+    }
+
+    // NOTE: returns the number of erased elements (0 or 1)
+    size_type erase(const key_type& key) {
+        auto& s = shard_of(key);
+        std::lock_guard<Mutex> guard(s.lock);
+        return s.map.erase(key);
+    }
+
+    // NOTE: calls fn(mapped_type&) under the lock of the key's shard, returns whether the key was found;
+    //       fn must not call back into this map (the shard's lock is not recursive)
+    template <typename Function>
+    bool update(const key_type& key, Function fn) {
+        auto& s = shard_of(key);
+        std::lock_guard<Mutex> guard(s.lock);
+
+        auto it = s.map.find(key);
+        if (it == s.map.end()) return false;
+
+        fn(it->second);
+        return true;
+    }
+
+    // NOTE: updates the value of key with fn, or inserts value if the key is not there yet, in one locked step
+    //       (e.g. counters: update_or_insert(key, 1, [](auto& count) { ++count; }))
+    template <typename Function>
+    void update_or_insert(const key_type& key, const mapped_type& value, Function fn) {
+        auto& s = shard_of(key);
+        std::lock_guard<Mutex> guard(s.lock);
+
+        auto it = s.map.find(key);
+        if (it == s.map.end())
+            s.map.emplace(key, value);
+        else
+            fn(it->second);
+    }
+
+    /*
+        Lookup
+    */
+
+    // NOTE: copies the value of key into value, returns whether the key was found
+    bool find(const key_type& key, mapped_type& value) const {
+        const auto& s = shard_of(key);
+        std::lock_guard<Mutex> guard(s.lock);
+
+        auto it = s.map.find(key);
+        if (it == s.map.end()) return false;
+
+        value = it->second;
+        return true;
+    }
+
+    [[nodiscard]] bool contains(const key_type& key) const {
+        const auto& s = shard_of(key);
+        std::lock_guard<Mutex> guard(s.lock);
+        return s.map.contains(key);
+    }
+
+    // NOTE: calls fn(const value_type&) for every element, one shard at a time under its lock, so it sees each shard
+    //       consistently but not the map as a whole
+    template <typename Function>
+    void for_each(Function fn) const {
+        for (const auto& s : m_shards) {
+            std::lock_guard<Mutex> guard(s.lock);
+            for (const auto& element : s.map)
+                fn(element);
+        }
+    }
+
+    // NOTE: which shard key belongs to
+    [[nodiscard]] static size_type shard_index(const key_type& key) {
+        if constexpr (ShardCount == 1) {
+            return 0;
+        } else {
+            // NOTE: Fibonacci hashing, the multiplication moves the entropy of all bits of the hash into the high bits,
+            //       which matters for hashes like the identity hash of integers
+            constexpr size_t multiplier = sizeof(size_t) == 8 ? static_cast<size_t>(0x9E3779B97F4A7C15ull) : static_cast<size_t>(0x9E3779B9u);
+            constexpr int shard_bits = countr_zero(ShardCount);
+
+            return (Hash{}(key)*multiplier) >> (sizeof(size_t) * 8 - shard_bits);
+        }
+    }
+
+   private:
+    // NOTE: a cache line per shard, so the locks of neighbouring shards don't share one
+    struct alignas(64) shard {
+        mutable Mutex lock;
+        map_type map;
+    };
+
+    shard m_shards[ShardCount];
+
+    [[nodiscard]] shard& shard_of(const key_type& key) {
+        return m_shards[shard_index(key)];
+    }
+
+    [[nodiscard]] const shard& shard_of(const key_type& key) const {
+        return m_shards[shard_index(key)];
+    }
+};
+
+}  // namespace lw_std
\ No newline at end of file
@@ -0,0 +1,819 @@
+// dynamic_bitset header (non-standard)
+#pragma once
+
+#ifndef ARDUINO
+#    include <new>
+#endif
+
+#include "bit.hpp"
+#include "impl/iterator.hpp"
+#include "impl/vectorized_algorithms.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace lw_std {
+
+// NOTE: non-standard, a resizable sequence of bits packed into 64-bit blocks (like boost::dynamic_bitset);
+//       set/reset/test touch a single block, count and find_first/find_next work a block at a time with
+//       popcount and countr_zero, the bitwise operators combine whole blocks with the SIMD kernels;
+//       bits past size() in the last block are always zero, so whole blocks can be counted and compared
+class dynamic_bitset {
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+    typedef pair<uint64_t*, size_t> iterator_data_t;
+    typedef pair<const uint64_t*, size_t> const_iterator_data_t;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using block_type = uint64_t;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using value_type = bool;
+
+    static constexpr size_type bits_per_block = sizeof(block_type) * 8;
+
+    // NOTE: returned by find_first/find_next if there is no set bit
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    // NOTE: bits are not addressable, so references to them are proxies that know their block and mask
+    class reference {
+       public:
+        constexpr reference(block_type& block, block_type mask)
+            : m_block(&block), m_mask(mask) {}
+
+        constexpr reference(const reference&) = default;
+
+        constexpr reference& operator=(bool value) {
+            if (value)
+                *m_block |= m_mask;
+            else
+                *m_block &= ~m_mask;
+            return *this;
+        }
+
+        // NOTE: assigns the value of the referenced bit, not the reference itself
+        constexpr reference& operator=(const reference& other) {
+            return operator=(static_cast<bool>(other));
+        }
+
+        constexpr operator bool() const {
+            return (*m_block & m_mask) != 0;
+        }
+
+        [[nodiscard]] constexpr bool operator~() const {
+            return !static_cast<bool>(*this);
+        }
+
+        constexpr reference& flip() {
+            *m_block ^= m_mask;
+            return *this;
+        }
+
+       private:
+        block_type* m_block;
+        block_type m_mask;
+    };
+
+    using const_reference = bool;
+
+    using iterator = iterator_impl<iterator_def<reference, iterator_data_t>, iterator_def<reference, iterator_data_t>>;
+    using const_iterator = iterator_impl<iterator_def<const bool, const_iterator_data_t>, iterator>;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    constexpr dynamic_bitset() = default;
+
+    explicit dynamic_bitset(size_type num_bits, bool value = false) {
+        resize(num_bits, value);
+    }
+
+    /*
+        Element access
+    */
+
+    [[nodiscard]] constexpr reference operator[](size_type pos) {
+        return reference(m_blocks[block_index(pos)], bit_mask(pos));
+    }
+
+    [[nodiscard]] constexpr const_reference operator[](size_type pos) const {
+        return test(pos);
+    }
+
+    [[nodiscard]] constexpr bool test(size_type pos) const {
+        return (m_blocks[block_index(pos)] & bit_mask(pos)) != 0;
+    }
+
+    // NOTE: the blocks, bit i is bit i % bits_per_block of block i / bits_per_block
+    [[nodiscard]] constexpr const block_type* blocks() const {
+        return m_blocks.data();
+    }
+
+    /*
+        Iterators
+    */
+
+    [[nodiscard]] constexpr iterator begin() noexcept {
+        return iterator(iterator_data_t{m_blocks.data(), size_type{0}});
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return const_iterator(const_iterator_data_t{m_blocks.data(), size_type{0}});
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] constexpr iterator end() noexcept {
+        return iterator(iterator_data_t{m_blocks.data(), m_size});
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return const_iterator(const_iterator_data_t{m_blocks.data(), m_size});
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    /*
+        Capacity
+    */
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return m_size;
+    }
+
+    [[nodiscard]] constexpr size_type num_blocks() const noexcept {
+        return m_blocks.size();
+    }
+
+    constexpr void reserve(size_type num_bits) {
+        m_blocks.reserve(blocks_for(num_bits));
+    }
+
+    [[nodiscard]] constexpr size_type capacity() const noexcept {
+        return m_blocks.capacity() * bits_per_block;
+    }
+
+    constexpr void shrink_to_fit() {
+        m_blocks.shrink_to_fit();
+    }
+
+    /*
+        Modifiers
+    */
+
+    constexpr void clear() {
+        m_blocks.clear();
+        m_size = 0;
+    }
+
+    constexpr void resize(size_type num_bits, bool value = false) {
+        auto old_size = m_size;
+
+        // NOTE: new blocks are filled as a whole, only the bits of the old last block are set one block at a time
+        m_blocks.resize(blocks_for(num_bits), value ? ~block_type{0} : block_type{0});
+        m_size = num_bits;
+
+        if (value && num_bits > old_size && old_size % bits_per_block != 0)
+            m_blocks[block_index(old_size)] |= ~block_type{0} << (old_size % bits_per_block);
+
+        clear_unused_bits();
+    }
+
+    constexpr void push_back(bool value) {
+        if (m_size % bits_per_block == 0)
+            m_blocks.push_back(block_type{0});
+
+        m_size++;
+        set(m_size - 1, value);
+    }
+
+    constexpr void pop_back() {
+        if (m_size == 0) return;
+
+        m_size--;
+        if (m_size % bits_per_block == 0)
+            m_blocks.pop_back();
+        else
+            clear_unused_bits();
+    }
+
+    constexpr dynamic_bitset& set() {
+        for (auto& block : m_blocks)
+            block = ~block_type{0};
+
+        clear_unused_bits();
+        return *this;
+    }
+
+    constexpr dynamic_bitset& set(size_type pos, bool value = true) {
+        if (value)
+            m_blocks[block_index(pos)] |= bit_mask(pos);
+        else
+            m_blocks[block_index(pos)] &= ~bit_mask(pos);
+        return *this;
+    }
+
+    constexpr dynamic_bitset& reset() {
+        for (auto& block : m_blocks)
+            block = 0;
+        return *this;
+    }
+
+    constexpr dynamic_bitset& reset(size_type pos) {
+        m_blocks[block_index(pos)] &= ~bit_mask(pos);
+        return *this;
+    }
+
+    constexpr dynamic_bitset& flip() {
+        for (auto& block : m_blocks)
+            block = ~block;
+
+        clear_unused_bits();
+        return *this;
+    }
+
+    constexpr dynamic_bitset& flip(size_type pos) {
+        m_blocks[block_index(pos)] ^= bit_mask(pos);
+        return *this;
+    }
+
+    // NOTE: count bits of value before pos, the bits behind pos are shifted up a whole block at a time
+    constexpr void insert(size_type pos, size_type count, bool value) {
+        if (count == 0) return;
+
+        // NOTE: as with vector::insert the blocks grow geometrically, many inserts at the end stay amortized O(1)
+        auto new_blocks = blocks_for(m_size + count);
+        if (new_blocks > m_blocks.capacity()) m_blocks.reserve(max_of(new_blocks, 2 * m_blocks.capacity()));
+        m_blocks.resize(new_blocks, block_type{0});
+        m_size += count;
+
+        // NOTE: from the last block down, a block is only read by itself and the blocks above it
+        for (auto index = m_blocks.size(); index-- > block_index(pos);) {
+            auto kept = range_mask(index, 0, pos);
+            auto filled = range_mask(index, pos, pos + count);
+            m_blocks[index] = (m_blocks[index] & kept) | (value ? filled : block_type{0}) | (shifted_up(index, count) & ~(kept | filled));
+        }
+    }
+
+    // NOTE: erases the bits in [first, last), the bits behind last are shifted down a whole block at a time
+    constexpr void erase(size_type first, size_type last) {
+        if (first == last) return;
+
+        auto new_size = m_size - (last - first);
+
+        // NOTE: from the first block up, a block is only read by itself and the blocks below it
+        for (auto index = block_index(first); index < blocks_for(new_size); ++index) {
+            auto kept = range_mask(index, 0, first);
+            m_blocks[index] = (m_blocks[index] & kept) | (shifted_down(index, last - first) & ~kept);
+        }
+
+        m_blocks.resize(blocks_for(new_size));
+        m_size = new_size;
+        clear_unused_bits();
+    }
+
+    constexpr void swap(dynamic_bitset& other) {
+        lw_std::swap(m_blocks, other.m_blocks);
+        lw_std::swap(m_size, other.m_size);
+    }
+
+    /*
+        Bit operations
+    */
+
+    // NOTE: the bitwise operators expect both sets to have the same size
+    dynamic_bitset& operator&=(const dynamic_bitset& other) {
+        vectorized_bitwise<bitwise_op::bit_and>(m_blocks.data(), other.m_blocks.data(), common_blocks(other));
+        return *this;
+    }
+
+    dynamic_bitset& operator|=(const dynamic_bitset& other) {
+        vectorized_bitwise<bitwise_op::bit_or>(m_blocks.data(), other.m_blocks.data(), common_blocks(other));
+        clear_unused_bits();
+        return *this;
+    }
+
+    dynamic_bitset& operator^=(const dynamic_bitset& other) {
+        vectorized_bitwise<bitwise_op::bit_xor>(m_blocks.data(), other.m_blocks.data(), common_blocks(other));
+        clear_unused_bits();
+        return *this;
+    }
+
+    [[nodiscard]] dynamic_bitset operator~() const {
+        dynamic_bitset res(*this);
+        res.flip();
+        return res;
+    }
+
+    /*
+        Lookup
+    */
+
+    [[nodiscard]] constexpr size_type count() const noexcept {
+        size_type res = 0;
+        for (auto block : m_blocks)
+            res += static_cast<size_type>(lw_std::popcount(block));
+        return res;
+    }
+
+    [[nodiscard]] constexpr bool any() const noexcept {
+        for (auto block : m_blocks)
+            if (block != 0) return true;
+        return false;
+    }
+
+    [[nodiscard]] constexpr bool none() const noexcept {
+        return !any();
+    }
+
+    [[nodiscard]] constexpr bool all() const noexcept {
+        return count() == m_size;
+    }
+
+    // NOTE: index of the first set bit, npos if there is none
+    [[nodiscard]] constexpr size_type find_first() const noexcept {
+        return find_from_block(0);
+    }
+
+    // NOTE: index of the first set bit after pos, npos if there is none
+    [[nodiscard]] constexpr size_type find_next(size_type pos) const noexcept {
+        if (m_size == 0 || pos >= m_size - 1) return npos;
+
+        auto index = block_index(pos + 1);
+        auto block = m_blocks[index] & (~block_type{0} << ((pos + 1) % bits_per_block));
+        if (block != 0)
+            return index * bits_per_block + static_cast<size_type>(lw_std::countr_zero(block));
+
+        return find_from_block(index + 1);
+    }
+
+    [[nodiscard]] constexpr bool operator==(const dynamic_bitset& other) const {
+        return m_size == other.m_size && lw_std::equal(m_blocks.data(), m_blocks.data() + m_blocks.size(), other.m_blocks.data());
+    }
+
+    [[nodiscard]] constexpr bool operator!=(const dynamic_bitset& other) const {
+        return !operator==(other);
+    }
+
+    // NOTE: lexicographical three-way comparison of the bits (as of a vector<bool>), a block at a time:
+    //       the first bit that differs is the lowest set bit of the xor of two blocks
+    [[nodiscard]] constexpr int compare(const dynamic_bitset& other) const noexcept {
+        auto common = min_of(m_size, other.m_size);
+
+        for (size_type index = 0; index < blocks_for(common); ++index) {
+            auto diff = (m_blocks[index] ^ other.m_blocks[index]) & range_mask(index, 0, common);
+            if (diff != 0) return (m_blocks[index] >> lw_std::countr_zero(diff) & 1) != 0 ? 1 : -1;
+        }
+
+        return m_size < other.m_size ? -1 : (m_size > other.m_size ? 1 : 0);
+    }
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def {
+        friend dynamic_bitset;
+
+       protected:
+        typedef P value_type;
+        typedef IT_P data_type;
+        typedef random_access_iterator_tag iterator_category;
+
+        constexpr iterator_def() = default;
+
+        constexpr iterator_def(const IT_P& data)
+            : m_data(data) {}
+
+        template <typename Q, typename IT_Q>
+        constexpr iterator_def(const iterator_def<Q, IT_Q>& other)
+            : m_data(other.m_data) {}
+
+        constexpr iterator_def(const iterator_def& other) {
+            operator=(other);
+        }
+
+        constexpr iterator_def(iterator_def&& other) {
+            operator=(lw_std::move(other));
+        }
+
+        constexpr iterator_def& operator=(const iterator_def& other) {
+            m_data = other.m_data;
+            return *this;
+        }
+
+        constexpr iterator_def& operator=(iterator_def&& other) {
+            m_data = lw_std::move(other.m_data);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
+            return m_data.second == other.m_data.second;
+        }
+
+        [[nodiscard]] constexpr P* get() {
+            return make_proxy();
+        }
+
+        [[nodiscard]] constexpr const P* get() const {
+            return make_proxy();
+        }
+
+        constexpr void advance(ptrdiff_t n) {
+            m_data.second = static_cast<size_type>(static_cast<ptrdiff_t>(m_data.second) + n);
+        }
+
+        [[nodiscard]] constexpr ptrdiff_t distance_to(const iterator_def& other) const {
+            return static_cast<ptrdiff_t>(other.m_data.second) - static_cast<ptrdiff_t>(m_data.second);
+        }
+
+       private:
+        IT_P m_data{nullptr, size_type{0}};
+
+        // NOTE: as with flat_map, there is nothing in memory to point to, the proxy (or the bool of a const_iterator)
+        //       is built in here on every dereference
+        alignas(P) mutable unsigned char m_proxy[sizeof(P)];
+
+        [[nodiscard]] P* make_proxy() const {
+            auto& block = m_data.first[block_index(m_data.second)];
+
+            if constexpr (is_same_v<P, reference>)
+                return new (m_proxy) P(block, bit_mask(m_data.second));
+            else
+                return new (m_proxy) P((block & bit_mask(m_data.second)) != 0);
+        }
+    };
+
+    vector<block_type> m_blocks{};
+    size_type m_size{0};
+
+    [[nodiscard]] static constexpr size_type block_index(size_type pos) {
+        return pos / bits_per_block;
+    }
+
+    [[nodiscard]] static constexpr block_type bit_mask(size_type pos) {
+        return block_type{1} << (pos % bits_per_block);
+    }
+
+    [[nodiscard]] static constexpr size_type blocks_for(size_type num_bits) {
+        return (num_bits + bits_per_block - 1) / bits_per_block;
+    }
+
+    [[nodiscard]] constexpr size_type common_blocks(const dynamic_bitset& other) const {
+        return min_of(m_blocks.size(), other.m_blocks.size());
+    }
+
+    constexpr void clear_unused_bits() {
+        if (m_size % bits_per_block != 0)
+            m_blocks.back() &= ~(~block_type{0} << (m_size % bits_per_block));
+    }
+
+    // NOTE: the bits of block index at positions in [first, last)
+    [[nodiscard]] static constexpr block_type range_mask(size_type index, size_type first, size_type last) {
+        auto begin = index * bits_per_block;
+        auto low = min_of(max_of(first, begin), begin + bits_per_block) - begin;
+        auto high = min_of(max_of(last, begin), begin + bits_per_block) - begin;
+        if (low >= high) return 0;
+
+        auto below_high = high == bits_per_block ? ~block_type{0} : ~(~block_type{0} << high);
+        return below_high & (~block_type{0} << low);
+    }
+
+    [[nodiscard]] constexpr block_type block_or_zero(size_type index) const {
+        return index < m_blocks.size() ? m_blocks[index] : block_type{0};
+    }
+
+    // NOTE: block index of the set shifted up by count bits, bit i comes from bit i - count
+    [[nodiscard]] constexpr block_type shifted_up(size_type index, size_type count) const {
+        auto blocks = count / bits_per_block, bits = count % bits_per_block;
+        if (index < blocks) return 0;
+
+        auto res = m_blocks[index - blocks] << bits;
+        if (bits != 0 && index > blocks) res |= m_blocks[index - blocks - 1] >> (bits_per_block - bits);
+        return res;
+    }
+
+    // NOTE: block index of the set shifted down by count bits, bit i comes from bit i + count
+    [[nodiscard]] constexpr block_type shifted_down(size_type index, size_type count) const {
+        auto blocks = count / bits_per_block, bits = count % bits_per_block;
+
+        auto res = block_or_zero(index + blocks) >> bits;
+        if (bits != 0) res |= block_or_zero(index + blocks + 1) << (bits_per_block - bits);
+        return res;
+    }
+
+    [[nodiscard]] constexpr size_type find_from_block(size_type index) const {
+        for (; index < m_blocks.size(); ++index)
+            if (m_blocks[index] != 0)
+                return index * bits_per_block + static_cast<size_type>(lw_std::countr_zero(m_blocks[index]));
+
+        return npos;
+    }
+};
+
+// NOTE: non-standard, bitwise operators of dynamic_bitset
+[[nodiscard]] inline dynamic_bitset operator&(const dynamic_bitset& lhs, const dynamic_bitset& rhs) {
+    dynamic_bitset res(lhs);
+    res &= rhs;
+    return res;
+}
+
+[[nodiscard]] inline dynamic_bitset operator|(const dynamic_bitset& lhs, const dynamic_bitset& rhs) {
+    dynamic_bitset res(lhs);
+    res |= rhs;
+    return res;
+}
+
+[[nodiscard]] inline dynamic_bitset operator^(const dynamic_bitset& lhs, const dynamic_bitset& rhs) {
+    dynamic_bitset res(lhs);
+    res ^= rhs;
+    return res;
+}
+
+// vector<bool> https://en.cppreference.com/w/cpp/container/vector_bool
+// NOTE: one bit per element in the blocks of a dynamic_bitset; references are proxies, so there is no data()
+template <typename Allocator>
+class vector<bool, Allocator> : private dynamic_bitset {
+    // NOTE: the blocks live in the vector<uint64_t> of the dynamic_bitset, which has no allocator to rebind
+    static_assert(is_same_v<Allocator, allocator<bool>>, "vector<bool> only supports the default allocator");
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using value_type = bool;
+    using allocator_type = Allocator;
+    using dynamic_bitset::const_iterator;
+    using dynamic_bitset::const_reference;
+    using dynamic_bitset::difference_type;
+    using dynamic_bitset::iterator;
+    using dynamic_bitset::reference;
+    using dynamic_bitset::size_type;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/container/vector/vector
+    constexpr vector() = default;
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/container/vector/vector
+    vector(size_type count, bool value)
+        : dynamic_bitset(count, value) {}
+
+    // (constructor) (4) https://en.cppreference.com/w/cpp/container/vector/vector
+    explicit vector(size_type count)
+        : dynamic_bitset(count) {}
+
+    // (constructor) (5) https://en.cppreference.com/w/cpp/container/vector/vector
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr vector(InputIt first, InputIt last) {
+        assign(first, last);
+    }
+
+    // FIXME: (constructor) (2, 7, 9, 10) https://en.cppreference.com/w/cpp/container/vector/vector
+
+    // assign (1) https://en.cppreference.com/w/cpp/container/vector/assign
+    constexpr void assign(size_type count, bool value) {
+        clear();
+        resize(count, value);
+    }
+
+    // assign (2) https://en.cppreference.com/w/cpp/container/vector/assign
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr void assign(InputIt first, InputIt last) {
+        clear();
+        for (; first != last; ++first)
+            push_back(static_cast<bool>(*first));
+    }
+
+    // get_allocator https://en.cppreference.com/w/cpp/container/vector/get_allocator
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{};
+    }
+
+    /*
+        Element access
+    */
+
+    // at https://en.cppreference.com/w/cpp/container/vector/at
+    [[nodiscard]] constexpr reference at(size_type pos) {
+        // NOTE: as with vector::at, out of range positions give the first element instead of throwing
+        return (*this)[pos < size() ? pos : 0];
+    }
+
+    // at https://en.cppreference.com/w/cpp/container/vector/at
+    [[nodiscard]] constexpr const_reference at(size_type pos) const {
+        return (*this)[pos < size() ? pos : 0];
+    }
+
+    // operator[] https://en.cppreference.com/w/cpp/container/vector/operator_at
+    using dynamic_bitset::operator[];
+
+    // front https://en.cppreference.com/w/cpp/container/vector/front
+    [[nodiscard]] constexpr reference front() {
+        return (*this)[0];
+    }
+
+    // front https://en.cppreference.com/w/cpp/container/vector/front
+    [[nodiscard]] constexpr const_reference front() const {
+        return (*this)[0];
+    }
+
+    // back https://en.cppreference.com/w/cpp/container/vector/back
+    [[nodiscard]] constexpr reference back() {
+        return (*this)[size() - 1];
+    }
+
+    // back https://en.cppreference.com/w/cpp/container/vector/back
+    [[nodiscard]] constexpr const_reference back() const {
+        return (*this)[size() - 1];
+    }
+
+    /*
+        Iterators
+    */
+
+    // begin, cbegin, end, cend https://en.cppreference.com/w/cpp/container/vector/begin
+    using dynamic_bitset::begin;
+    using dynamic_bitset::cbegin;
+    using dynamic_bitset::cend;
+    using dynamic_bitset::end;
+
+    // FIXME: rbegin https://en.cppreference.com/w/cpp/container/vector/rbegin
+    // FIXME: rend https://en.cppreference.com/w/cpp/container/vector/rend
+
+    /*
+        Capacity
+    */
+
+    // empty, size, reserve, capacity, shrink_to_fit https://en.cppreference.com/w/cpp/container/vector
+    using dynamic_bitset::capacity;
+    using dynamic_bitset::empty;
+    using dynamic_bitset::reserve;
+    using dynamic_bitset::shrink_to_fit;
+    using dynamic_bitset::size;
+
+    // max_size https://en.cppreference.com/w/cpp/container/vector/max_size
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return numeric_limits<size_type>::max();
+    }
+
+    /*
+        Modifiers
+    */
+
+    // clear, push_back, pop_back, resize https://en.cppreference.com/w/cpp/container/vector
+    using dynamic_bitset::clear;
+    using dynamic_bitset::pop_back;
+    using dynamic_bitset::push_back;
+    using dynamic_bitset::resize;
+
+    // insert (1) https://en.cppreference.com/w/cpp/container/vector/insert
+    constexpr iterator insert(const_iterator pos, bool value) {
+        return insert(pos, 1, value);
+    }
+
+    // insert (3) https://en.cppreference.com/w/cpp/container/vector/insert
+    constexpr iterator insert(const_iterator pos, size_type count, bool value) {
+        auto index = index_of(pos);
+        dynamic_bitset::insert(index, count, value);
+        return begin() + static_cast<difference_type>(index);
+    }
+
+    // insert (4) https://en.cppreference.com/w/cpp/container/vector/insert
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        auto index = index_of(pos);
+
+        // NOTE: the range is collected first (it may be a single pass input range), so the bits behind pos move only once
+        dynamic_bitset inserted;
+        for (; first != last; ++first)
+            inserted.push_back(static_cast<bool>(*first));
+
+        dynamic_bitset::insert(index, inserted.size(), false);
+        for (size_type i = 0; i < inserted.size(); ++i)
+            set(index + i, inserted[i]);
+        return begin() + static_cast<difference_type>(index);
+    }
+
+    // emplace https://en.cppreference.com/w/cpp/container/vector/emplace
+    template <typename... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        return insert(pos, 1, bool(lw_std::forward<Args>(args)...));
+    }
+
+    // erase (1) https://en.cppreference.com/w/cpp/container/vector/erase
+    constexpr iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    // erase (2) https://en.cppreference.com/w/cpp/container/vector/erase
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        auto index = index_of(first);
+        dynamic_bitset::erase(index, index_of(last));
+        return begin() + static_cast<difference_type>(index);
+    }
+
+    // emplace_back https://en.cppreference.com/w/cpp/container/vector/emplace_back
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        push_back(bool(lw_std::forward<Args>(args)...));
+        return back();
+    }
+
+    // swap https://en.cppreference.com/w/cpp/container/vector/swap
+    constexpr void swap(vector& other) {
+        dynamic_bitset::swap(other);
+    }
+
+    // flip https://en.cppreference.com/w/cpp/container/vector_bool/flip
+    constexpr void flip() {
+        dynamic_bitset::flip();
+    }
+
+    // NOTE: non-standard, the underlying bitset, e.g. for count or find_first
+    [[nodiscard]] constexpr const dynamic_bitset& bits() const noexcept {
+        return *this;
+    }
+
+    // operator== (1) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
+    // NOTE: non-template, so it is picked over the operator== of the primary template
+    [[nodiscard]] friend constexpr bool operator==(const vector& lhs, const vector& rhs) {
+        return lhs.bits() == rhs.bits();
+    }
+
+    // operator== (2) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
+    [[nodiscard]] friend constexpr bool operator!=(const vector& lhs, const vector& rhs) {
+        return !(lhs == rhs);
+    }
+
+    // NOTE: operator<=> (7) https://en.cppreference.com/w/cpp/container/vector/operator_cmp as C++17 overload of
+    //       synthesized_cmp_three_way, the bits are compared a block at a time
+    [[nodiscard]] friend constexpr int synthesized_cmp_three_way(const vector& lhs, const vector& rhs) {
+        return lhs.bits().compare(rhs.bits());
+    }
+
+    // operator< (3) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
+    [[nodiscard]] friend constexpr bool operator<(const vector& lhs, const vector& rhs) {
+        return synthesized_cmp_three_way(lhs, rhs) < 0;
+    }
+
+    // operator<= (4) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
+    [[nodiscard]] friend constexpr bool operator<=(const vector& lhs, const vector& rhs) {
+        return synthesized_cmp_three_way(lhs, rhs) <= 0;
+    }
+
+    // operator> (5) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
+    [[nodiscard]] friend constexpr bool operator>(const vector& lhs, const vector& rhs) {
+        return synthesized_cmp_three_way(lhs, rhs) > 0;
+    }
+
+    // operator>= (6) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
+    [[nodiscard]] friend constexpr bool operator>=(const vector& lhs, const vector& rhs) {
+        return synthesized_cmp_three_way(lhs, rhs) >= 0;
+    }
+
+   private:
+    [[nodiscard]] constexpr size_type index_of(const_iterator it) const {
+        return static_cast<size_type>(it - cbegin());
+    }
+};
+
+// erase_if (2) https://en.cppreference.com/w/cpp/container/vector/erase2
+// NOTE: more specialized than the overload of the primary template, which works on data()
+template <typename Allocator, typename Pred>
+constexpr typename vector<bool, Allocator>::size_type erase_if(vector<bool, Allocator>& c, Pred pred) {
+    // NOTE: one pass moves the kept bits to the front, then the tail is cut off at once
+    typename vector<bool, Allocator>::size_type kept = 0;
+    for (typename vector<bool, Allocator>::size_type i = 0; i < c.size(); ++i) {
+        bool value = c[i];
+        if (!pred(value)) c[kept++] = value;
+    }
+
+    auto count = c.size() - kept;
+    c.resize(kept);
+    return count;
+}
+
+// erase (1) https://en.cppreference.com/w/cpp/container/vector/erase2
+template <typename Allocator, typename U>
+constexpr typename vector<bool, Allocator>::size_type erase(vector<bool, Allocator>& c, const U& value) {
+    return lw_std::erase_if(c, [&value](bool element) { return element == value; });
+}
+
+}  // namespace lw_std
\ No newline at end of file
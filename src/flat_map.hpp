@@ -0,0 +1,469 @@
+// flat_map header https://en.cppreference.com/w/cpp/header/flat_map
+#pragma once
+
+#ifdef ARDUINO
+#    include <assert.h>
+#else
+#    include <cassert>
+#    include <new>
+#endif
+
+#include "algorithm.hpp"
+#include "functional.hpp"
+#include "impl/iterator.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace lw_std {
+
+// flat_map https://en.cppreference.com/w/cpp/container/flat_map
+// NOTE: keys and mapped values are kept in two separate containers sorted by key, so a lookup only touches
+//       the densely packed keys and there is no per element allocation; insert and erase are O(n),
+//       use this for read-mostly tables
+template <typename Key, typename T, typename Compare = less<Key>, typename KeyContainer = vector<Key>, typename MappedContainer = vector<T>>
+class flat_map {
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+    typedef pair<const Key*, T*> iterator_data_t;
+    typedef pair<const Key*, const T*> const_iterator_data_t;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = pair<key_type, mapped_type>;
+    using key_compare = Compare;
+    using reference = pair<const key_type&, mapped_type&>;
+    using const_reference = pair<const key_type&, const mapped_type&>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using iterator = iterator_impl<iterator_def<reference, iterator_data_t>, iterator_def<reference, iterator_data_t>>;
+    using const_iterator = iterator_impl<iterator_def<const_reference, const_iterator_data_t>, iterator>;
+    using key_container_type = KeyContainer;
+    using mapped_container_type = MappedContainer;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/container/flat_map/flat_map
+    constexpr flat_map() = default;
+
+    // FIXME: (constructor) (2-7) https://en.cppreference.com/w/cpp/container/flat_map/flat_map
+
+    // (constructor) (8) https://en.cppreference.com/w/cpp/container/flat_map/flat_map
+    constexpr explicit flat_map(const key_compare& comp)
+        : m_compare(comp) {}
+
+    // (constructor) (10) https://en.cppreference.com/w/cpp/container/flat_map/flat_map
+    template <typename InputIt>
+    constexpr flat_map(InputIt first, InputIt last, const key_compare& comp = key_compare()) : m_compare(comp) {
+        insert(first, last);
+    }
+
+    // FIXME: (constructor) (11-26) https://en.cppreference.com/w/cpp/container/flat_map/flat_map
+
+    /*
+        Element access
+    */
+
+    // at (1) https://en.cppreference.com/w/cpp/container/flat_map/at
+    [[nodiscard]] constexpr mapped_type& at(const key_type& key) {
+        // NOTE: 'at' should throw if the key does not exist, but lw_std works without exceptions;
+        //       the key has to exist, which is asserted (use find to look up keys that may be missing)
+        auto index = find_index(key);
+        assert(index != size());
+        return m_values[index];
+    }
+
+    // at (1) https://en.cppreference.com/w/cpp/container/flat_map/at
+    [[nodiscard]] constexpr const mapped_type& at(const key_type& key) const {
+        auto index = find_index(key);
+        assert(index != size());
+        return m_values[index];
+    }
+
+    // FIXME: at (2) https://en.cppreference.com/w/cpp/container/flat_map/at
+
+    // operator[] (1) https://en.cppreference.com/w/cpp/container/flat_map/operator_at
+    constexpr mapped_type& operator[](const key_type& key) {
+        return try_emplace(key).first->second;
+    }
+
+    // operator[] (2) https://en.cppreference.com/w/cpp/container/flat_map/operator_at
+    constexpr mapped_type& operator[](key_type&& key) {
+        return try_emplace(lw_std::move(key)).first->second;
+    }
+
+    // FIXME: operator[] (3) https://en.cppreference.com/w/cpp/container/flat_map/operator_at
+
+    /*
+        Iterators
+    */
+
+    // begin https://en.cppreference.com/w/cpp/container/flat_map/begin
+    [[nodiscard]] constexpr iterator begin() noexcept {
+        return iterator_at(0);
+    }
+
+    // begin https://en.cppreference.com/w/cpp/container/flat_map/begin
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return iterator_at(0);
+    }
+
+    // cbegin https://en.cppreference.com/w/cpp/container/flat_map/begin
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return iterator_at(0);
+    }
+
+    // end https://en.cppreference.com/w/cpp/container/flat_map/end
+    [[nodiscard]] constexpr iterator end() noexcept {
+        return iterator_at(size());
+    }
+
+    // end https://en.cppreference.com/w/cpp/container/flat_map/end
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return iterator_at(size());
+    }
+
+    // cend https://en.cppreference.com/w/cpp/container/flat_map/end
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return iterator_at(size());
+    }
+
+    // FIXME: rbegin https://en.cppreference.com/w/cpp/container/flat_map/rbegin
+    // FIXME: rend https://en.cppreference.com/w/cpp/container/flat_map/rend
+
+    /*
+        Capacity
+    */
+
+    // empty https://en.cppreference.com/w/cpp/container/flat_map/empty
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_keys.empty();
+    }
+
+    // size https://en.cppreference.com/w/cpp/container/flat_map/size
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return m_keys.size();
+    }
+
+    // max_size https://en.cppreference.com/w/cpp/container/flat_map/max_size
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return m_keys.max_size();
+    }
+
+    // NOTE: non-standard, reserve space in both underlying containers before bulk inserting
+    constexpr void reserve(size_type new_cap) {
+        m_keys.reserve(new_cap);
+        m_values.reserve(new_cap);
+    }
+
+    /*
+        Modifiers
+    */
+
+    // emplace https://en.cppreference.com/w/cpp/container/flat_map/emplace
+    template <typename... Args>
+    constexpr pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(lw_std::forward<Args>(args)...);
+        return try_emplace_impl(lw_std::move(value.first), lw_std::move(value.second));
+    }
+
+    // FIXME: emplace_hint https://en.cppreference.com/w/cpp/container/flat_map/emplace_hint
+
+    // try_emplace (1) https://en.cppreference.com/w/cpp/container/flat_map/try_emplace
+    template <typename... Args>
+    constexpr pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+        return try_emplace_impl(key, lw_std::forward<Args>(args)...);
+    }
+
+    // try_emplace (2) https://en.cppreference.com/w/cpp/container/flat_map/try_emplace
+    template <typename... Args>
+    constexpr pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        return try_emplace_impl(lw_std::move(key), lw_std::forward<Args>(args)...);
+    }
+
+    // FIXME: try_emplace (3-6) https://en.cppreference.com/w/cpp/container/flat_map/try_emplace
+
+    // insert (1) https://en.cppreference.com/w/cpp/container/flat_map/insert
+    constexpr pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace_impl(value.first, value.second);
+    }
+
+    // insert (2) https://en.cppreference.com/w/cpp/container/flat_map/insert
+    constexpr pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace_impl(lw_std::move(value.first), lw_std::move(value.second));
+    }
+
+    // FIXME: insert (3-6) https://en.cppreference.com/w/cpp/container/flat_map/insert
+
+    // insert (7) https://en.cppreference.com/w/cpp/container/flat_map/insert
+    template <typename InputIt>
+    constexpr void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            emplace(*first);
+    }
+
+    // FIXME: insert (8-12) https://en.cppreference.com/w/cpp/container/flat_map/insert
+
+    // FIXME: insert_or_assign https://en.cppreference.com/w/cpp/container/flat_map/insert_or_assign
+
+    // erase (1/2) https://en.cppreference.com/w/cpp/container/flat_map/erase
+    constexpr iterator erase(const_iterator pos) {
+        auto index = index_from_iterator(pos);
+
+        m_keys.erase(m_keys.data() + index);
+        m_values.erase(m_values.data() + index);
+
+        return iterator_at(index);
+    }
+
+    // erase (3) https://en.cppreference.com/w/cpp/container/flat_map/erase
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        auto start_index = index_from_iterator(first);
+        auto end_index = index_from_iterator(last);
+
+        m_keys.erase(m_keys.data() + start_index, m_keys.data() + end_index);
+        m_values.erase(m_values.data() + start_index, m_values.data() + end_index);
+
+        return iterator_at(start_index);
+    }
+
+    // erase (4) https://en.cppreference.com/w/cpp/container/flat_map/erase
+    constexpr size_type erase(const key_type& key) {
+        auto index = lower_bound_index(key);
+        if (index == size() || m_compare(key, m_keys[index])) return 0;
+
+        m_keys.erase(m_keys.data() + index);
+        m_values.erase(m_values.data() + index);
+        return 1;
+    }
+
+    // swap https://en.cppreference.com/w/cpp/container/flat_map/swap
+    constexpr void swap(flat_map& other) {
+        lw_std::swap(*this, other);
+    }
+
+    // clear https://en.cppreference.com/w/cpp/container/flat_map/clear
+    constexpr void clear() {
+        m_keys.clear();
+        m_values.clear();
+    }
+
+    /*
+        Lookup
+    */
+
+    // find (1) https://en.cppreference.com/w/cpp/container/flat_map/find
+    [[nodiscard]] constexpr iterator find(const key_type& key) {
+        return iterator_at(find_index(key));
+    }
+
+    // find (2) https://en.cppreference.com/w/cpp/container/flat_map/find
+    [[nodiscard]] constexpr const_iterator find(const key_type& key) const {
+        return iterator_at(find_index(key));
+    }
+
+    // FIXME: find (3/4) https://en.cppreference.com/w/cpp/container/flat_map/find
+
+    // count (1) https://en.cppreference.com/w/cpp/container/flat_map/count
+    [[nodiscard]] constexpr size_type count(const key_type& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    // contains (1) https://en.cppreference.com/w/cpp/container/flat_map/contains
+    [[nodiscard]] constexpr bool contains(const key_type& key) const {
+        return find_index(key) != size();
+    }
+
+    // equal_range (1) https://en.cppreference.com/w/cpp/container/flat_map/equal_range
+    [[nodiscard]] constexpr pair<iterator, iterator> equal_range(const key_type& key) {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    // equal_range (2) https://en.cppreference.com/w/cpp/container/flat_map/equal_range
+    [[nodiscard]] constexpr pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    // lower_bound (1) https://en.cppreference.com/w/cpp/container/flat_map/lower_bound
+    [[nodiscard]] constexpr iterator lower_bound(const key_type& key) {
+        return iterator_at(lower_bound_index(key));
+    }
+
+    // lower_bound (2) https://en.cppreference.com/w/cpp/container/flat_map/lower_bound
+    [[nodiscard]] constexpr const_iterator lower_bound(const key_type& key) const {
+        return iterator_at(lower_bound_index(key));
+    }
+
+    // upper_bound (1) https://en.cppreference.com/w/cpp/container/flat_map/upper_bound
+    [[nodiscard]] constexpr iterator upper_bound(const key_type& key) {
+        return iterator_at(upper_bound_index(key));
+    }
+
+    // upper_bound (2) https://en.cppreference.com/w/cpp/container/flat_map/upper_bound
+    [[nodiscard]] constexpr const_iterator upper_bound(const key_type& key) const {
+        return iterator_at(upper_bound_index(key));
+    }
+
+    /*
+        Observers
+    */
+
+    // key_comp https://en.cppreference.com/w/cpp/container/flat_map/key_comp
+    [[nodiscard]] constexpr key_compare key_comp() const {
+        return m_compare;
+    }
+
+    // keys https://en.cppreference.com/w/cpp/container/flat_map/keys
+    [[nodiscard]] constexpr const key_container_type& keys() const noexcept {
+        return m_keys;
+    }
+
+    // values https://en.cppreference.com/w/cpp/container/flat_map/values
+    [[nodiscard]] constexpr const mapped_container_type& values() const noexcept {
+        return m_values;
+    }
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def {
+        friend flat_map;
+
+       protected:
+        typedef P value_type;
+        typedef IT_P data_type;
+        typedef random_access_iterator_tag iterator_category;
+
+        constexpr iterator_def() = default;
+
+        constexpr iterator_def(const IT_P& data)
+            : m_data(data) {}
+
+        template <typename Q, typename IT_Q>
+        constexpr iterator_def(const iterator_def<Q, IT_Q>& other)
+            : m_data(other.m_data) {}
+
+        constexpr iterator_def(const iterator_def& other) {
+            operator=(other);
+        }
+
+        constexpr iterator_def(iterator_def&& other) {
+            operator=(lw_std::move(other));
+        }
+
+        constexpr iterator_def& operator=(const iterator_def& other) {
+            m_data = other.m_data;
+            return *this;
+        }
+
+        constexpr iterator_def& operator=(iterator_def&& other) {
+            m_data = lw_std::move(other.m_data);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
+            return m_data.first == other.m_data.first;
+        }
+
+        [[nodiscard]] constexpr P* get() {
+            return new (m_proxy) P{*m_data.first, *m_data.second};
+        }
+
+        [[nodiscard]] constexpr const P* get() const {
+            return new (m_proxy) P{*m_data.first, *m_data.second};
+        }
+
+        constexpr void advance(ptrdiff_t n) {
+            m_data.first += n;
+            m_data.second += n;
+        }
+
+        [[nodiscard]] constexpr ptrdiff_t distance_to(const iterator_def& other) const {
+            return other.m_data.first - m_data.first;
+        }
+
+       private:
+        IT_P m_data{nullptr, nullptr};
+
+        // NOTE: key and value are not stored next to each other, so there is no pair in memory to point to;
+        //       a pair of references is built in here on every dereference instead
+        alignas(P) mutable unsigned char m_proxy[sizeof(P)];
+    };
+
+    key_container_type m_keys{};
+    mapped_container_type m_values{};
+    key_compare m_compare{};
+
+    template <typename K, typename... Args>
+    constexpr pair<iterator, bool> try_emplace_impl(K&& key, Args&&... args) {
+        auto index = lower_bound_index(key);
+        if (index != size() && !m_compare(key, m_keys[index]))
+            return {iterator_at(index), false};
+
+        m_keys.emplace(m_keys.data() + index, lw_std::forward<K>(key));
+        m_values.emplace(m_values.data() + index, lw_std::forward<Args>(args)...);
+
+        return {iterator_at(index), true};
+    }
+
+    [[nodiscard]] constexpr size_type lower_bound_index(const key_type& key) const {
+        // NOTE: search on the raw pointers, they are random access
+        const key_type* first = m_keys.data();
+        return static_cast<size_type>(lw_std::branchless_lower_bound(first, first + size(), key, m_compare) - first);
+    }
+
+    [[nodiscard]] constexpr size_type upper_bound_index(const key_type& key) const {
+        const key_type* first = m_keys.data();
+        return static_cast<size_type>(lw_std::upper_bound(first, first + size(), key, m_compare) - first);
+    }
+
+    [[nodiscard]] constexpr size_type find_index(const key_type& key) const {
+        auto index = lower_bound_index(key);
+        if (index != size() && !m_compare(key, m_keys[index]))
+            return index;
+        return size();
+    }
+
+    [[nodiscard]] constexpr iterator iterator_at(size_type index) {
+        return iterator(iterator_data_t{m_keys.data() + index, m_values.data() + index});
+    }
+
+    [[nodiscard]] constexpr const_iterator iterator_at(size_type index) const {
+        return const_iterator(const_iterator_data_t{m_keys.data() + index, m_values.data() + index});
+    }
+
+    [[nodiscard]] constexpr size_type index_from_iterator(const const_iterator& it) const {
+        return static_cast<size_type>(it.m_data.first - m_keys.data());
+    }
+};
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// operator== https://en.cppreference.com/w/cpp/container/flat_map/operator_cmp
+template <typename Key, typename T, typename Compare, typename KeyContainer, typename MappedContainer>
+[[nodiscard]] constexpr bool operator==(const flat_map<Key, T, Compare, KeyContainer, MappedContainer>& lhs, const flat_map<Key, T, Compare, KeyContainer, MappedContainer>& rhs) {
+    return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+// NOTE: operator!= is synthesized from operator== in C++20, so it is not listed on cppreference
+template <typename Key, typename T, typename Compare, typename KeyContainer, typename MappedContainer>
+[[nodiscard]] constexpr bool operator!=(const flat_map<Key, T, Compare, KeyContainer, MappedContainer>& lhs, const flat_map<Key, T, Compare, KeyContainer, MappedContainer>& rhs) {
+    return !operator==(lhs, rhs);
+}
+
+// FIXME: operator<=> https://en.cppreference.com/w/cpp/container/flat_map/operator_cmp
+
+// NOTE: no extra specialization: swap https://en.cppreference.com/w/cpp/container/flat_map/swap2
+
+// FIXME: erase_if https://en.cppreference.com/w/cpp/container/flat_map/erase_if
+
+}  // namespace lw_std
@@ -0,0 +1,263 @@
+// flat_set header https://en.cppreference.com/w/cpp/header/flat_set
+#pragma once
+
+#include "algorithm.hpp"
+#include "functional.hpp"
+#include "impl/member_types.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace lw_std {
+
+// flat_set https://en.cppreference.com/w/cpp/container/flat_set
+// NOTE: keys are kept sorted in one contiguous container, so lookup is a binary search without pointer chasing
+//       and there is no per element allocation; insert and erase are O(n), use this for read-mostly tables
+template <typename Key, typename Compare = less<Key>, typename KeyContainer = vector<Key>>
+class flat_set {
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    LWSTD_COMMON_VALUE_TYPES(Key)
+
+    using key_type = Key;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using container_type = KeyContainer;
+
+    // NOTE: elements of a set are immutable, so both iterator types are constant
+    using iterator = typename container_type::const_iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/container/flat_set/flat_set
+    constexpr flat_set() = default;
+
+    // FIXME: (constructor) (2-7) https://en.cppreference.com/w/cpp/container/flat_set/flat_set
+
+    // (constructor) (8) https://en.cppreference.com/w/cpp/container/flat_set/flat_set
+    constexpr explicit flat_set(const key_compare& comp)
+        : m_compare(comp) {}
+
+    // (constructor) (10) https://en.cppreference.com/w/cpp/container/flat_set/flat_set
+    template <typename InputIt>
+    constexpr flat_set(InputIt first, InputIt last, const key_compare& comp = key_compare()) : m_compare(comp) {
+        insert(first, last);
+    }
+
+    // FIXME: (constructor) (11-26) https://en.cppreference.com/w/cpp/container/flat_set/flat_set
+
+    /*
+        Iterators
+    */
+
+    // begin https://en.cppreference.com/w/cpp/container/flat_set/begin
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return m_keys.begin();
+    }
+
+    // cbegin https://en.cppreference.com/w/cpp/container/flat_set/begin
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return m_keys.cbegin();
+    }
+
+    // end https://en.cppreference.com/w/cpp/container/flat_set/end
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return m_keys.end();
+    }
+
+    // cend https://en.cppreference.com/w/cpp/container/flat_set/end
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return m_keys.cend();
+    }
+
+    // FIXME: rbegin https://en.cppreference.com/w/cpp/container/flat_set/rbegin
+    // FIXME: rend https://en.cppreference.com/w/cpp/container/flat_set/rend
+
+    /*
+        Capacity
+    */
+
+    // empty https://en.cppreference.com/w/cpp/container/flat_set/empty
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_keys.empty();
+    }
+
+    // size https://en.cppreference.com/w/cpp/container/flat_set/size
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return m_keys.size();
+    }
+
+    // max_size https://en.cppreference.com/w/cpp/container/flat_set/max_size
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return m_keys.max_size();
+    }
+
+    // NOTE: non-standard, reserve space in the underlying container before bulk inserting
+    constexpr void reserve(size_type new_cap) {
+        m_keys.reserve(new_cap);
+    }
+
+    /*
+        Modifiers
+    */
+
+    // emplace https://en.cppreference.com/w/cpp/container/flat_set/emplace
+    template <typename... Args>
+    constexpr pair<iterator, bool> emplace(Args&&... args) {
+        return insert(value_type(lw_std::forward<Args>(args)...));
+    }
+
+    // FIXME: emplace_hint https://en.cppreference.com/w/cpp/container/flat_set/emplace_hint
+
+    // insert (1) https://en.cppreference.com/w/cpp/container/flat_set/insert
+    constexpr pair<iterator, bool> insert(const value_type& value) {
+        return insert_impl(value);
+    }
+
+    // insert (2) https://en.cppreference.com/w/cpp/container/flat_set/insert
+    constexpr pair<iterator, bool> insert(value_type&& value) {
+        return insert_impl(lw_std::move(value));
+    }
+
+    // FIXME: insert (3-4) https://en.cppreference.com/w/cpp/container/flat_set/insert
+
+    // insert (6) https://en.cppreference.com/w/cpp/container/flat_set/insert
+    template <typename InputIt>
+    constexpr void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            insert_impl(*first);
+    }
+
+    // FIXME: insert (7-10) https://en.cppreference.com/w/cpp/container/flat_set/insert
+
+    // extract https://en.cppreference.com/w/cpp/container/flat_set/extract
+    [[nodiscard]] constexpr container_type extract() && {
+        return lw_std::move(m_keys);
+    }
+
+    // FIXME: replace https://en.cppreference.com/w/cpp/container/flat_set/replace
+
+    // erase (1/2) https://en.cppreference.com/w/cpp/container/flat_set/erase
+    constexpr iterator erase(const_iterator pos) {
+        return m_keys.erase(pos);
+    }
+
+    // erase (3) https://en.cppreference.com/w/cpp/container/flat_set/erase
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        return m_keys.erase(first, last);
+    }
+
+    // erase (4) https://en.cppreference.com/w/cpp/container/flat_set/erase
+    constexpr size_type erase(const key_type& key) {
+        const_iterator res = find(key);
+        if (res == end()) return 0;
+        erase(res);
+        return 1;
+    }
+
+    // swap https://en.cppreference.com/w/cpp/container/flat_set/swap
+    constexpr void swap(flat_set& other) {
+        lw_std::swap(*this, other);
+    }
+
+    // clear https://en.cppreference.com/w/cpp/container/flat_set/clear
+    constexpr void clear() {
+        m_keys.clear();
+    }
+
+    /*
+        Lookup
+    */
+
+    // find (1/2) https://en.cppreference.com/w/cpp/container/flat_set/find
+    [[nodiscard]] constexpr const_iterator find(const key_type& key) const {
+        const_iterator res = lower_bound(key);
+        if (res != end() && !m_compare(key, *res))
+            return res;
+        return end();
+    }
+
+    // FIXME: find (3/4) https://en.cppreference.com/w/cpp/container/flat_set/find
+
+    // count (1) https://en.cppreference.com/w/cpp/container/flat_set/count
+    [[nodiscard]] constexpr size_type count(const key_type& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    // contains (1) https://en.cppreference.com/w/cpp/container/flat_set/contains
+    [[nodiscard]] constexpr bool contains(const key_type& key) const {
+        return find(key) != end();
+    }
+
+    // equal_range (1/2) https://en.cppreference.com/w/cpp/container/flat_set/equal_range
+    [[nodiscard]] constexpr pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    // lower_bound (1/2) https://en.cppreference.com/w/cpp/container/flat_set/lower_bound
+    [[nodiscard]] constexpr const_iterator lower_bound(const key_type& key) const {
+        // NOTE: search on the raw pointers, they are random access
+        return lw_std::branchless_lower_bound(m_keys.data(), m_keys.data() + m_keys.size(), key, m_compare);
+    }
+
+    // upper_bound (1/2) https://en.cppreference.com/w/cpp/container/flat_set/upper_bound
+    [[nodiscard]] constexpr const_iterator upper_bound(const key_type& key) const {
+        return lw_std::upper_bound(m_keys.data(), m_keys.data() + m_keys.size(), key, m_compare);
+    }
+
+    /*
+        Observers
+    */
+
+    // key_comp https://en.cppreference.com/w/cpp/container/flat_set/key_comp
+    [[nodiscard]] constexpr key_compare key_comp() const {
+        return m_compare;
+    }
+
+    // value_comp https://en.cppreference.com/w/cpp/container/flat_set/value_comp
+    [[nodiscard]] constexpr value_compare value_comp() const {
+        return m_compare;
+    }
+
+   private:
+    container_type m_keys{};
+    key_compare m_compare{};
+
+    template <typename V>
+    constexpr pair<iterator, bool> insert_impl(V&& value) {
+        const_iterator res = lower_bound(value);
+        if (res != end() && !m_compare(value, *res))
+            return {res, false};
+
+        return {m_keys.emplace(res, lw_std::forward<V>(value)), true};
+    }
+};
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// operator== https://en.cppreference.com/w/cpp/container/flat_set/operator_cmp
+template <typename Key, typename Compare, typename KeyContainer>
+[[nodiscard]] constexpr bool operator==(const flat_set<Key, Compare, KeyContainer>& lhs, const flat_set<Key, Compare, KeyContainer>& rhs) {
+    return lhs.size() == rhs.size() && lw_std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+// NOTE: operator!= is synthesized from operator== in C++20, so it is not listed on cppreference
+template <typename Key, typename Compare, typename KeyContainer>
+[[nodiscard]] constexpr bool operator!=(const flat_set<Key, Compare, KeyContainer>& lhs, const flat_set<Key, Compare, KeyContainer>& rhs) {
+    return !operator==(lhs, rhs);
+}
+
+// FIXME: operator<=> https://en.cppreference.com/w/cpp/container/flat_set/operator_cmp
+
+// NOTE: no extra specialization: swap https://en.cppreference.com/w/cpp/container/flat_set/swap2
+
+// FIXME: erase_if https://en.cppreference.com/w/cpp/container/flat_set/erase_if
+
+}  // namespace lw_std
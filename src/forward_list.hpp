@@ -0,0 +1,653 @@
+// forward_list header https://en.cppreference.com/w/cpp/header/forward_list
+#pragma once
+
+#include "algorithm.hpp"
+#include "functional.hpp"
+#include "impl/iterator.hpp"
+#include "impl/member_types.hpp"
+#include "iterator.hpp"
+#include "limits.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+// forward_list https://en.cppreference.com/w/cpp/container/forward_list
+// NOTE: a node is one pointer smaller than a list node and the list itself is one pointer (no back node and, as in
+//       std::forward_list, no size), for lists that are only pushed at the front and iterated forward
+template <typename T, typename Allocator = allocator<T>>
+class forward_list {
+   protected:
+    // NOTE: the head in front of the first node (before_begin()) is a node_base only, it holds no element
+    struct node_base {
+        node_base* next{nullptr};
+    };
+
+    struct node : node_base {
+        template <typename... U>
+        constexpr node(node_base* next_node, U&&... v)
+            : node_base{next_node}, value(lw_std::forward<U>(v)...) {}
+
+        T value;
+    };
+
+    typedef typename Allocator::template rebind<node>::other node_allocator_t;
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    LWSTD_COMMON_VALUE_TYPES(T)
+
+    using allocator_type = Allocator;
+    using iterator = iterator_impl<iterator_def<T, node_base*>, iterator_def<T, node_base*>>;
+    using const_iterator = iterator_impl<iterator_def<const T, node_base*>, iterator>;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/container/forward_list/forward_list
+    constexpr forward_list() = default;
+
+    // FIXME: (constructor) (2) https://en.cppreference.com/w/cpp/container/forward_list/forward_list
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/container/forward_list/forward_list
+    constexpr forward_list(size_type count, const_reference value) {
+        assign(count, value);
+    }
+
+    // (constructor) (5) https://en.cppreference.com/w/cpp/container/forward_list/forward_list
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr forward_list(InputIt first, InputIt last) {
+        assign(first, last);
+    }
+
+    // (constructor) (6) https://en.cppreference.com/w/cpp/container/forward_list/forward_list
+    constexpr forward_list(const forward_list& other) {
+        operator=(other);
+    }
+
+    // (constructor) (8) https://en.cppreference.com/w/cpp/container/forward_list/forward_list
+    constexpr forward_list(forward_list&& other) {
+        operator=(lw_std::move(other));
+    }
+
+    // (destructor) https://en.cppreference.com/w/cpp/container/forward_list/~forward_list
+    ~forward_list() {
+        clear();
+    }
+
+    // operator= (1) https://en.cppreference.com/w/cpp/container/forward_list/operator%3D
+    constexpr forward_list& operator=(const forward_list& other) {
+        if (&other != this)
+            assign(other.begin(), other.end());
+
+        return *this;
+    }
+
+    // operator= (2) https://en.cppreference.com/w/cpp/container/forward_list/operator%3D
+    constexpr forward_list& operator=(forward_list&& other) {
+        if (&other != this)
+            lw_std::swap(m_head.next, other.m_head.next);
+
+        return *this;
+    }
+
+    // FIXME: operator= (3) https://en.cppreference.com/w/cpp/container/forward_list/operator%3D
+
+    // assign (1) https://en.cppreference.com/w/cpp/container/forward_list/assign
+    constexpr void assign(size_type count, const_reference value) {
+        clear();
+        insert_after(cbefore_begin(), count, value);
+    }
+
+    // assign (2) https://en.cppreference.com/w/cpp/container/forward_list/assign
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr void assign(InputIt first, InputIt last) {
+        clear();
+        insert_after(cbefore_begin(), first, last);
+    }
+
+    // FIXME: assign (3) https://en.cppreference.com/w/cpp/container/forward_list/assign
+
+    // get_allocator https://en.cppreference.com/w/cpp/container/forward_list/get_allocator
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return m_allocator;
+    }
+
+    /*
+        Element access
+    */
+
+    // front https://en.cppreference.com/w/cpp/container/forward_list/front
+    [[nodiscard]] constexpr reference front() {
+        return value_of(m_head.next);
+    }
+
+    // front https://en.cppreference.com/w/cpp/container/forward_list/front
+    [[nodiscard]] constexpr const_reference front() const {
+        return value_of(m_head.next);
+    }
+
+    /*
+        Iterators
+    */
+
+    // before_begin https://en.cppreference.com/w/cpp/container/forward_list/before_begin
+    [[nodiscard]] constexpr iterator before_begin() noexcept {
+        return iterator(&m_head);
+    }
+
+    // before_begin https://en.cppreference.com/w/cpp/container/forward_list/before_begin
+    [[nodiscard]] constexpr const_iterator before_begin() const noexcept {
+        return const_iterator(&m_head);
+    }
+
+    // before_begin https://en.cppreference.com/w/cpp/container/forward_list/before_begin
+    [[nodiscard]] constexpr const_iterator cbefore_begin() const noexcept {
+        return const_iterator(&m_head);
+    }
+
+    // begin https://en.cppreference.com/w/cpp/container/forward_list/begin
+    [[nodiscard]] constexpr iterator begin() noexcept {
+        return iterator(m_head.next);
+    }
+
+    // begin https://en.cppreference.com/w/cpp/container/forward_list/begin
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return const_iterator(m_head.next);
+    }
+
+    // begin https://en.cppreference.com/w/cpp/container/forward_list/begin
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return const_iterator(m_head.next);
+    }
+
+    // end https://en.cppreference.com/w/cpp/container/forward_list/end
+    [[nodiscard]] constexpr iterator end() noexcept {
+        return iterator(nullptr);
+    }
+
+    // end https://en.cppreference.com/w/cpp/container/forward_list/end
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return const_iterator(nullptr);
+    }
+
+    // end https://en.cppreference.com/w/cpp/container/forward_list/end
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return const_iterator(nullptr);
+    }
+
+    /*
+        Capacity
+    */
+
+    // empty https://en.cppreference.com/w/cpp/container/forward_list/empty
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_head.next == nullptr;
+    }
+
+    // max_size https://en.cppreference.com/w/cpp/container/forward_list/max_size
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return numeric_limits<size_type>::max();
+    }
+
+    /*
+        Modifiers
+    */
+
+    // clear https://en.cppreference.com/w/cpp/container/forward_list/clear
+    constexpr void clear() noexcept {
+        erase_after(cbefore_begin(), cend());
+    }
+
+    // insert_after (1) https://en.cppreference.com/w/cpp/container/forward_list/insert_after
+    constexpr iterator insert_after(const_iterator pos, const_reference value) {
+        return emplace_after(pos, value);
+    }
+
+    // insert_after (2) https://en.cppreference.com/w/cpp/container/forward_list/insert_after
+    constexpr iterator insert_after(const_iterator pos, T&& value) {
+        return emplace_after(pos, lw_std::move(value));
+    }
+
+    // insert_after (3) https://en.cppreference.com/w/cpp/container/forward_list/insert_after
+    // NOTE: returns the last inserted element, or pos if count is 0
+    constexpr iterator insert_after(const_iterator pos, size_type count, const_reference value) {
+        for (size_type i = 0; i < count; ++i)
+            pos = emplace_after(pos, value);
+
+        return to_non_const_iterator(pos);
+    }
+
+    // insert_after (4) https://en.cppreference.com/w/cpp/container/forward_list/insert_after
+    // NOTE: returns the last inserted element, or pos if first == last
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr iterator insert_after(const_iterator pos, InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            pos = emplace_after(pos, *first);
+
+        return to_non_const_iterator(pos);
+    }
+
+    // FIXME: insert_after (5) https://en.cppreference.com/w/cpp/container/forward_list/insert_after
+
+    // emplace_after https://en.cppreference.com/w/cpp/container/forward_list/emplace_after
+    template <typename... Args>
+    constexpr iterator emplace_after(const_iterator pos, Args&&... args) {
+        node_base* prev = node_of(pos);
+
+        node* new_node = m_allocator.allocate(1);
+        m_allocator.construct(new_node, prev->next, lw_std::forward<Args>(args)...);
+        prev->next = new_node;
+
+        return iterator(new_node);
+    }
+
+    // erase_after (1) https://en.cppreference.com/w/cpp/container/forward_list/erase_after
+    constexpr iterator erase_after(const_iterator pos) {
+        node_base* prev = node_of(pos);
+        auto* erased = static_cast<node*>(prev->next);
+
+        prev->next = erased->next;
+        free_node(erased);
+
+        return iterator(prev->next);
+    }
+
+    // erase_after (2) https://en.cppreference.com/w/cpp/container/forward_list/erase_after
+    constexpr iterator erase_after(const_iterator first, const_iterator last) {
+        node_base* prev = node_of(first);
+        node_base* end_node = node_of(last);
+
+        while (prev->next != end_node) {
+            auto* erased = static_cast<node*>(prev->next);
+            prev->next = erased->next;
+            free_node(erased);
+        }
+
+        return iterator(end_node);
+    }
+
+    // push_front (1) https://en.cppreference.com/w/cpp/container/forward_list/push_front
+    constexpr void push_front(const_reference value) {
+        emplace_front(value);
+    }
+
+    // push_front (2) https://en.cppreference.com/w/cpp/container/forward_list/push_front
+    constexpr void push_front(T&& value) {
+        emplace_front(lw_std::move(value));
+    }
+
+    // emplace_front https://en.cppreference.com/w/cpp/container/forward_list/emplace_front
+    template <typename... Args>
+    constexpr reference emplace_front(Args&&... args) {
+        return *emplace_after(cbefore_begin(), lw_std::forward<Args>(args)...);
+    }
+
+    // pop_front https://en.cppreference.com/w/cpp/container/forward_list/pop_front
+    constexpr void pop_front() {
+        if (!empty()) erase_after(cbefore_begin());
+    }
+
+    // FIXME: resize (1) https://en.cppreference.com/w/cpp/container/forward_list/resize
+    // FIXME: resize (2) https://en.cppreference.com/w/cpp/container/forward_list/resize
+
+    // swap https://en.cppreference.com/w/cpp/container/forward_list/swap
+    constexpr void swap(forward_list& other) noexcept {
+        lw_std::swap(m_head.next, other.m_head.next);
+    }
+
+    /*
+        Operations
+    */
+
+    // merge (1) https://en.cppreference.com/w/cpp/container/forward_list/merge
+    constexpr void merge(forward_list& other) {
+        merge(other, less<T>());
+    }
+
+    // merge (1) https://en.cppreference.com/w/cpp/container/forward_list/merge
+    constexpr void merge(forward_list&& other) {
+        merge(other, less<T>());
+    }
+
+    // merge (2) https://en.cppreference.com/w/cpp/container/forward_list/merge
+    // NOTE: the nodes of other are relinked into this list, no element is allocated, copied or moved
+    template <typename Compare>
+    constexpr void merge(forward_list& other, Compare comp) {
+        if (&other == this) return;
+
+        m_head.next = merge_chains(m_head.next, other.m_head.next, comp);
+        other.m_head.next = nullptr;
+    }
+
+    // merge (2) https://en.cppreference.com/w/cpp/container/forward_list/merge
+    template <typename Compare>
+    constexpr void merge(forward_list&& other, Compare comp) {
+        merge(other, comp);
+    }
+
+    // splice_after (1) https://en.cppreference.com/w/cpp/container/forward_list/splice_after
+    // NOTE: O(n) in the size of other, its last node has to be found
+    constexpr void splice_after(const_iterator pos, forward_list& other) {
+        if (&other == this || other.empty()) return;
+
+        node_base* last = &other.m_head;
+        while (last->next != nullptr)
+            last = last->next;
+
+        link_after(node_of(pos), other.m_head.next, last);
+        other.m_head.next = nullptr;
+    }
+
+    // splice_after (1) https://en.cppreference.com/w/cpp/container/forward_list/splice_after
+    constexpr void splice_after(const_iterator pos, forward_list&& other) {
+        splice_after(pos, other);
+    }
+
+    // splice_after (2) https://en.cppreference.com/w/cpp/container/forward_list/splice_after
+    // NOTE: moves the element after it
+    constexpr void splice_after(const_iterator pos, forward_list&, const_iterator it) {
+        node_base* prev = node_of(pos);
+        node_base* before_moved = node_of(it);
+        node_base* moved = before_moved->next;
+        if (prev == before_moved || prev == moved) return;
+
+        before_moved->next = moved->next;
+        link_after(prev, moved, moved);
+    }
+
+    // splice_after (2) https://en.cppreference.com/w/cpp/container/forward_list/splice_after
+    constexpr void splice_after(const_iterator pos, forward_list&& other, const_iterator it) {
+        splice_after(pos, other, it);
+    }
+
+    // splice_after (3) https://en.cppreference.com/w/cpp/container/forward_list/splice_after
+    // NOTE: moves the elements in (first, last), O(n) in their count to find the last one
+    constexpr void splice_after(const_iterator pos, forward_list&, const_iterator first, const_iterator last) {
+        node_base* before_first = node_of(first);
+        node_base* end_node = node_of(last);
+        if (before_first->next == end_node) return;
+
+        node_base* last_moved = before_first->next;
+        while (last_moved->next != end_node)
+            last_moved = last_moved->next;
+
+        node_base* first_moved = before_first->next;
+        before_first->next = end_node;
+        link_after(node_of(pos), first_moved, last_moved);
+    }
+
+    // splice_after (3) https://en.cppreference.com/w/cpp/container/forward_list/splice_after
+    constexpr void splice_after(const_iterator pos, forward_list&& other, const_iterator first, const_iterator last) {
+        splice_after(pos, other, first, last);
+    }
+
+    // remove (1) https://en.cppreference.com/w/cpp/container/forward_list/remove
+    constexpr size_type remove(const T& value) {
+        // NOTE: value might be an element of this list, so the node holding it is erased last
+        node_base* before_deferred = nullptr;
+        size_type res = 0;
+
+        for (node_base* prev = &m_head; prev->next != nullptr;) {
+            if (value_of(prev->next) == value) {
+                if (&value_of(prev->next) == &value) {
+                    before_deferred = prev;
+                    prev = prev->next;
+                } else {
+                    erase_after(const_iterator(prev));
+                }
+                ++res;
+            } else {
+                prev = prev->next;
+            }
+        }
+
+        if (before_deferred != nullptr) erase_after(const_iterator(before_deferred));
+        return res;
+    }
+
+    // remove_if (2) https://en.cppreference.com/w/cpp/container/forward_list/remove
+    template <typename UnaryPredicate>
+    constexpr size_type remove_if(UnaryPredicate p) {
+        size_type res = 0;
+
+        for (node_base* prev = &m_head; prev->next != nullptr;) {
+            if (p(value_of(prev->next))) {
+                erase_after(const_iterator(prev));
+                ++res;
+            } else {
+                prev = prev->next;
+            }
+        }
+
+        return res;
+    }
+
+    // reverse https://en.cppreference.com/w/cpp/container/forward_list/reverse
+    constexpr void reverse() noexcept {
+        node_base* reversed = nullptr;
+        for (node_base* current = m_head.next; current != nullptr;) {
+            node_base* next = current->next;
+            current->next = reversed;
+            reversed = current;
+            current = next;
+        }
+
+        m_head.next = reversed;
+    }
+
+    // unique (1) https://en.cppreference.com/w/cpp/container/forward_list/unique
+    constexpr size_type unique() {
+        return unique(equal_to<T>());
+    }
+
+    // unique (2) https://en.cppreference.com/w/cpp/container/forward_list/unique
+    template <typename BinaryPredicate>
+    constexpr size_type unique(BinaryPredicate p) {
+        size_type res = 0;
+
+        // NOTE: every element is compared to the first one of its group, as std::forward_list does
+        for (node_base* current = m_head.next; current != nullptr && current->next != nullptr;) {
+            if (p(value_of(current), value_of(current->next))) {
+                erase_after(const_iterator(current));
+                ++res;
+            } else {
+                current = current->next;
+            }
+        }
+
+        return res;
+    }
+
+    // sort (1) https://en.cppreference.com/w/cpp/container/forward_list/sort
+    constexpr void sort() {
+        sort(less<T>());
+    }
+
+    // sort (2) https://en.cppreference.com/w/cpp/container/forward_list/sort
+    // NOTE: the same bottom-up merge sort as list::sort, bins[i] holds a sorted chain of 2^i nodes; stable,
+    //       O(n log n), no allocation and no element is moved
+    template <typename Compare>
+    constexpr void sort(Compare comp) {
+        if (m_head.next == nullptr || m_head.next->next == nullptr) return;
+
+        node_base* bins[sizeof(size_type) * 8] = {};
+        size_type bin_count = 0;
+
+        for (node_base* rest = m_head.next; rest != nullptr;) {
+            node_base* carry = rest;
+            rest = rest->next;
+            carry->next = nullptr;
+
+            // NOTE: the chains in the bins hold earlier nodes than carry, so they go first to keep the sort stable
+            size_type i = 0;
+            for (; i < bin_count && bins[i] != nullptr; ++i) {
+                carry = merge_chains(bins[i], carry, comp);
+                bins[i] = nullptr;
+            }
+
+            bins[i] = carry;
+            if (i == bin_count) ++bin_count;
+        }
+
+        node_base* sorted = nullptr;
+        for (size_type i = 0; i < bin_count; ++i)
+            if (bins[i] != nullptr)
+                sorted = merge_chains(bins[i], sorted, comp);
+
+        m_head.next = sorted;
+    }
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def {
+        friend forward_list;
+
+       protected:
+        typedef P value_type;
+        typedef IT_P data_type;
+        typedef forward_iterator_tag iterator_category;
+
+        constexpr iterator_def() = default;
+
+        constexpr iterator_def(const IT_P& data)
+            : m_data(data) {}
+
+        template <typename Q, typename IT_Q>
+        constexpr iterator_def(const iterator_def<Q, IT_Q>& other)
+            : m_data(other.m_data) {}
+
+        constexpr iterator_def(const iterator_def& other) {
+            operator=(other);
+        }
+
+        constexpr iterator_def(iterator_def&& other) {
+            operator=(lw_std::move(other));
+        }
+
+        constexpr iterator_def& operator=(const iterator_def& other) {
+            m_data = other.m_data;
+            return *this;
+        }
+
+        constexpr iterator_def& operator=(iterator_def&& other) {
+            m_data = lw_std::move(other.m_data);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
+            return m_data == other.m_data;
+        }
+
+        [[nodiscard]] constexpr P* get() {
+            return &value_of(m_data);
+        }
+
+        [[nodiscard]] constexpr const P* get() const {
+            return &value_of(m_data);
+        }
+
+        constexpr void advance(ptrdiff_t n) {
+            for (; n > 0 && m_data; --n)
+                m_data = m_data->next;
+        }
+
+       private:
+        IT_P m_data{nullptr};
+    };
+
+    node_allocator_t m_allocator;
+
+    // NOTE: before_begin() of a const list still is an iterator to the head
+    mutable node_base m_head{};
+
+    [[nodiscard]] static constexpr T& value_of(node_base* n) noexcept {
+        return static_cast<node*>(n)->value;
+    }
+
+    [[nodiscard]] static node_base* node_of(const const_iterator& pos) {
+        return static_cast<const typename const_iterator::underlying_type&>(pos).m_data;
+    }
+
+    static iterator to_non_const_iterator(const const_iterator& pos) {
+        return iterator(node_of(pos));
+    }
+
+    constexpr void free_node(node* n) {
+        m_allocator.destroy(n);
+        m_allocator.deallocate(n, 1);
+    }
+
+    // NOTE: links the chain first..last (inclusive) in after prev
+    static constexpr void link_after(node_base* prev, node_base* first, node_base* last) noexcept {
+        last->next = prev->next;
+        prev->next = first;
+    }
+
+    // NOTE: merges two sorted, nullptr terminated chains, a wins ties (stable)
+    template <typename Compare>
+    [[nodiscard]] static constexpr node_base* merge_chains(node_base* a, node_base* b, Compare& comp) {
+        node_base* head = nullptr;
+        node_base** link = &head;
+
+        while (a != nullptr && b != nullptr) {
+            if (comp(value_of(b), value_of(a))) {
+                *link = b;
+                b = b->next;
+            } else {
+                *link = a;
+                a = a->next;
+            }
+            link = &(*link)->next;
+        }
+
+        *link = a != nullptr ? a : b;
+        return head;
+    }
+};
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// operator== (1) https://en.cppreference.com/w/cpp/container/forward_list/operator_cmp
+template <typename T, typename Allocator>
+[[nodiscard]] constexpr bool operator==(const forward_list<T, Allocator>& lhs, const forward_list<T, Allocator>& rhs) {
+    auto lhs_it = lhs.begin();
+    auto rhs_it = rhs.begin();
+    for (; lhs_it != lhs.end() && rhs_it != rhs.end(); ++lhs_it, ++rhs_it)
+        if (!(*lhs_it == *rhs_it)) return false;
+
+    return lhs_it == lhs.end() && rhs_it == rhs.end();
+}
+
+// operator== (2) https://en.cppreference.com/w/cpp/container/forward_list/operator_cmp
+template <typename T, typename Allocator>
+[[nodiscard]] constexpr bool operator!=(const forward_list<T, Allocator>& lhs, const forward_list<T, Allocator>& rhs) {
+    return !operator==(lhs, rhs);
+}
+
+// NOTE: no extra specialization: swap https://en.cppreference.com/w/cpp/container/forward_list/swap2
+
+// erase (1) https://en.cppreference.com/w/cpp/container/forward_list/erase2
+template <typename T, typename Allocator, typename U>
+constexpr typename forward_list<T, Allocator>::size_type erase(forward_list<T, Allocator>& c, const U& value) {
+    return c.remove_if([&value](const T& element) { return element == value; });
+}
+
+// erase_if (2) https://en.cppreference.com/w/cpp/container/forward_list/erase2
+template <typename T, typename Allocator, typename Pred>
+constexpr typename forward_list<T, Allocator>::size_type erase_if(forward_list<T, Allocator>& c, Pred pred) {
+    return c.remove_if(pred);
+}
+
+}  // namespace lw_std
\ No newline at end of file
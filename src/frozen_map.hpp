@@ -0,0 +1,144 @@
+// frozen_map header (non-standard)
+#pragma once
+
+#include "functional.hpp"
+#include "impl/perfect_hash.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+// NOTE: non-standard, an immutable map of N entries that are known at compile time, for tables like
+//       command name -> handler: declared constexpr it is built by the compiler, including a perfect hash of its keys,
+//       and lives in read-only memory, nothing is allocated or hashed at startup;
+//       a lookup hashes the key once and compares it once, the entries keep the order they were given in;
+//       Hash and Equal have to be usable in constant expressions (lw_std::hash is for integers, enums and string_view,
+//       so e.g. make_frozen_map<string_view, int>({{"start", 1}, ...}) is built by the compiler),
+//       duplicate keys and keys whose hashes collide completely are compile errors
+template <typename Key, typename T, size_t N, typename Hash = hash<Key>, typename Equal = equal_to<Key>>
+class frozen_map {
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = pair<Key, T>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+
+    // NOTE: the entries are one contiguous array that can't change, so both iterator types are constant pointers
+    using iterator = const value_type*;
+    using const_iterator = const value_type*;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // NOTE: Key and T have to be default constructible, the entries are copied into a value initialized array
+    constexpr explicit frozen_map(const value_type (&entries)[N])
+        : m_entries(copy_entries(entries)), m_index(hashes_of(m_entries.data).data, [this](size_t i, size_t j) { return Equal{}(m_entries.data[i].first, m_entries.data[j].first); }) {}
+
+    /*
+        Iterators
+    */
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return m_entries.data;
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return m_entries.data + N;
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    /*
+        Capacity
+    */
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return false;
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return N;
+    }
+
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return N;
+    }
+
+    /*
+        Lookup
+    */
+
+    [[nodiscard]] constexpr const_iterator find(const key_type& key) const {
+        const value_type& candidate = m_entries.data[m_index(Hash{}(key))];
+        return Equal{}(candidate.first, key) ? &candidate : end();
+    }
+
+    [[nodiscard]] constexpr size_type count(const key_type& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    [[nodiscard]] constexpr bool contains(const key_type& key) const {
+        return find(key) != end();
+    }
+
+    // NOTE: no exceptions, the value of key or fallback if the key is not in the map
+    [[nodiscard]] constexpr const mapped_type& get_or(const key_type& key, const mapped_type& fallback) const {
+        auto it = find(key);
+        return it == end() ? fallback : it->second;
+    }
+
+   private:
+    // NOTE: arrays can't be returned or initialized from a function result, a struct around one can
+    struct entry_array {
+        value_type data[N] = {};
+    };
+
+    entry_array m_entries;
+    impl::perfect_hash<N> m_index;
+
+    [[nodiscard]] static constexpr entry_array copy_entries(const value_type (&entries)[N]) {
+        entry_array res;
+        for (size_type i = 0; i < N; ++i)
+            res.data[i] = entries[i];
+        return res;
+    }
+
+    struct hash_array {
+        size_t data[N] = {};
+    };
+
+    [[nodiscard]] static constexpr hash_array hashes_of(const value_type (&entries)[N]) {
+        hash_array res;
+        for (size_type i = 0; i < N; ++i)
+            res.data[i] = Hash{}(entries[i].first);
+        return res;
+    }
+};
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// NOTE: non-standard, deduces N from the braced list, e.g.
+//       constexpr auto commands = make_frozen_map<int, handler_t>({{1, &on_start}, {2, &on_stop}});
+template <typename Key, typename T, typename Hash = hash<Key>, typename Equal = equal_to<Key>, size_t N>
+[[nodiscard]] constexpr frozen_map<Key, T, N, Hash, Equal> make_frozen_map(const pair<Key, T> (&entries)[N]) {
+    return frozen_map<Key, T, N, Hash, Equal>(entries);
+}
+
+}  // namespace lw_std
\ No newline at end of file
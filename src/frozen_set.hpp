@@ -0,0 +1,128 @@
+// frozen_set header (non-standard)
+#pragma once
+
+#include "functional.hpp"
+#include "impl/perfect_hash.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+// NOTE: non-standard, an immutable set of N keys that are known at compile time, see frozen_map
+template <typename Key, size_t N, typename Hash = hash<Key>, typename Equal = equal_to<Key>>
+class frozen_set {
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+
+    using iterator = const value_type*;
+    using const_iterator = const value_type*;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // NOTE: Key has to be default constructible, the keys are copied into a value initialized array
+    constexpr explicit frozen_set(const value_type (&keys)[N])
+        : m_keys(copy_keys(keys)), m_index(hashes_of(m_keys.data).data, [this](size_t i, size_t j) { return Equal{}(m_keys.data[i], m_keys.data[j]); }) {}
+
+    /*
+        Iterators
+    */
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return m_keys.data;
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return m_keys.data + N;
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    /*
+        Capacity
+    */
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return false;
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return N;
+    }
+
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return N;
+    }
+
+    /*
+        Lookup
+    */
+
+    [[nodiscard]] constexpr const_iterator find(const key_type& key) const {
+        const value_type& candidate = m_keys.data[m_index(Hash{}(key))];
+        return Equal{}(candidate, key) ? &candidate : end();
+    }
+
+    [[nodiscard]] constexpr size_type count(const key_type& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    [[nodiscard]] constexpr bool contains(const key_type& key) const {
+        return find(key) != end();
+    }
+
+   private:
+    struct key_array {
+        value_type data[N] = {};
+    };
+
+    key_array m_keys;
+    impl::perfect_hash<N> m_index;
+
+    [[nodiscard]] static constexpr key_array copy_keys(const value_type (&keys)[N]) {
+        key_array res;
+        for (size_type i = 0; i < N; ++i)
+            res.data[i] = keys[i];
+        return res;
+    }
+
+    struct hash_array {
+        size_t data[N] = {};
+    };
+
+    [[nodiscard]] static constexpr hash_array hashes_of(const value_type (&keys)[N]) {
+        hash_array res;
+        for (size_type i = 0; i < N; ++i)
+            res.data[i] = Hash{}(keys[i]);
+        return res;
+    }
+};
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// NOTE: non-standard, deduces N from the braced list, e.g. constexpr auto opcodes = make_frozen_set<uint8_t>({0x01, 0x3C, 0x7F});
+template <typename Key, typename Hash = hash<Key>, typename Equal = equal_to<Key>, size_t N>
+[[nodiscard]] constexpr frozen_set<Key, N, Hash, Equal> make_frozen_set(const Key (&keys)[N]) {
+    return frozen_set<Key, N, Hash, Equal>(keys);
+}
+
+}  // namespace lw_std
\ No newline at end of file
@@ -22,6 +22,23 @@ struct equal_to {
     }
 };
 
+// less https://en.cppreference.com/w/cpp/utility/functional/less
+template <class T = void>
+struct less {
+    [[nodiscard]] constexpr bool operator()(const T& lhs, const T& rhs) const {
+        return lhs < rhs;
+    }
+};
+
+// less<void> https://en.cppreference.com/w/cpp/utility/functional/less_void
+template <>
+struct less<void> {
+    template <class T, class U>
+    [[nodiscard]] constexpr bool operator()(const T& lhs, const U& rhs) const {
+        return lhs < rhs;
+    }
+};
+
 /*
     Hashing
 */
@@ -37,40 +54,61 @@ struct hash {
     }
 };
 
-// FIXME: this implementation ignores the last n bytes that don't fit into 4-byte chunks
-template <>
-struct hash<lw_std::string> {
-    typedef lw_std::string argument_type;
+namespace impl {
+
+// NOTE: murmur style mixing of 4-byte chunks, the bytes are assembled one by one instead of loaded through a
+//       reinterpret_cast, which keeps it usable in constant expressions and on targets without unaligned loads
+[[nodiscard]] constexpr size_t hash_bytes(const char* ptr, size_t len) {
+    const size_t m = 0x5bd1e995;
+    size_t current_hash = m;
+
+    auto mix = [&](uint32_t val) {
+        val *= m;
+        val ^= val >> 23;
+        val *= m;
+        current_hash *= m;
+        current_hash ^= val;
+    };
+
+    auto byte = [&](size_t i) { return static_cast<uint32_t>(static_cast<unsigned char>(ptr[i])); };
+
+    while (len >= 4) {
+        len -= sizeof(uint32_t);
+        mix(byte(len) | byte(len + 1) << 8 | byte(len + 2) << 16 | byte(len + 3) << 24);
+    }
+
+    // NOTE: the 1 to 3 bytes that don't fill a chunk, with the count so "a" and "a\0" differ
+    if (len > 0) {
+        uint32_t tail = static_cast<uint32_t>(len) << 24;
+        for (size_t i = 0; i < len; ++i)
+            tail |= byte(i) << (8 * i);
+        mix(tail);
+    }
+
+    current_hash ^= current_hash >> 11;
+    return current_hash;
+}
+
+}  // namespace impl
+
+template <size_t SsoCapacity, typename Allocator>
+struct hash<basic_string<char, SsoCapacity, Allocator>> {
+    typedef basic_string<char, SsoCapacity, Allocator> argument_type;
     typedef size_t result_type;
 
     [[nodiscard]] size_t operator()(const argument_type& key) const {
-        // NOTE:: key.data() is not available on arduino
-        return hash_bytes(key.c_str(), key.length());
+        return impl::hash_bytes(key.data(), key.size());
     }
+};
+
+// NOTE: hashes the same as the strings, so views and strings with the same characters share their hash
+template <>
+struct hash<string_view> {
+    typedef string_view argument_type;
+    typedef size_t result_type;
 
-   private:
-    [[nodiscard]] constexpr size_t hash_bytes(const char* ptr, size_t len) const {
-        const size_t m = 0x5bd1e995;
-        size_t current_hash = m;
-
-        auto mix = [&](uint32_t val) {
-            val *= m;
-            val ^= val >> 23;
-            val *= m;
-            current_hash *= m;
-            current_hash ^= val;
-        };
-
-        while (len >= 4) {
-            len -= sizeof(uint32_t);
-            mix(*reinterpret_cast<const uint32_t*>(ptr + len));
-        }
-
-        // FIXME:
-        // mix(*((uint32_t*) ptr));
-
-        current_hash ^= current_hash >> 11;
-        return current_hash;
+    [[nodiscard]] constexpr size_t operator()(argument_type key) const {
+        return impl::hash_bytes(key.data(), key.size());
     }
 };
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#ifndef ARDUINO
+#    include <new>
+#endif
+
 #include "../limits.hpp"
 #include "../utility.hpp"
 #include "member_types.hpp"
@@ -0,0 +1,99 @@
+#pragma once
+
+#ifdef ARDUINO
+#    include <string.h>
+#else
+#    include <cstring>
+#endif
+
+#include "../algorithm.hpp"
+#include "../type_traits.hpp"
+#include "../utility.hpp"
+
+namespace lw_std {
+
+// char_traits https://en.cppreference.com/w/cpp/string/char_traits
+// NOTE: basic_string and basic_string_view always use char_traits<CharT>, they take no Traits parameter;
+//       ranges of chars use memcpy, memcmp and strlen, and lw_std::find for searches (memchr or SIMD),
+//       unless they are evaluated at compile time
+template <typename CharT>
+struct char_traits {
+    using char_type = CharT;
+
+    // eq https://en.cppreference.com/w/cpp/string/char_traits/cmp
+    [[nodiscard]] static constexpr bool eq(char_type a, char_type b) noexcept {
+        return a == b;
+    }
+
+    // lt https://en.cppreference.com/w/cpp/string/char_traits/cmp
+    // NOTE: like std::char_traits<char>, chars compare as unsigned char
+    [[nodiscard]] static constexpr bool lt(char_type a, char_type b) noexcept {
+        if constexpr (is_same_v<char_type, char>)
+            return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+        else
+            return a < b;
+    }
+
+    // assign (2) https://en.cppreference.com/w/cpp/string/char_traits/assign
+    static constexpr char_type* assign(char_type* p, size_t count, char_type ch) {
+        if constexpr (sizeof(char_type) == 1) {
+            if (!is_constant_evaluated()) {
+                if (count > 0) memset(p, static_cast<unsigned char>(ch), count);
+                return p;
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            p[i] = ch;
+        return p;
+    }
+
+    // move https://en.cppreference.com/w/cpp/string/char_traits/move
+    static char_type* move(char_type* dest, const char_type* src, size_t count) {
+        if (count > 0) memmove(dest, src, count * sizeof(char_type));
+        return dest;
+    }
+
+    // copy https://en.cppreference.com/w/cpp/string/char_traits/copy
+    static constexpr char_type* copy(char_type* dest, const char_type* src, size_t count) {
+        if (!is_constant_evaluated()) {
+            if (count > 0) memcpy(dest, src, count * sizeof(char_type));
+            return dest;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            dest[i] = src[i];
+        return dest;
+    }
+
+    // compare https://en.cppreference.com/w/cpp/string/char_traits/compare
+    [[nodiscard]] static constexpr int compare(const char_type* s1, const char_type* s2, size_t count) {
+        if constexpr (sizeof(char_type) == 1) {
+            if (!is_constant_evaluated()) return count == 0 ? 0 : memcmp(s1, s2, count);
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            if (!eq(s1[i], s2[i])) return lt(s1[i], s2[i]) ? -1 : 1;
+        return 0;
+    }
+
+    // length https://en.cppreference.com/w/cpp/string/char_traits/length
+    [[nodiscard]] static constexpr size_t length(const char_type* s) {
+        if constexpr (is_same_v<char_type, char>) {
+            if (!is_constant_evaluated()) return strlen(s);
+        }
+
+        size_t res = 0;
+        while (!eq(s[res], char_type()))
+            ++res;
+        return res;
+    }
+
+    // find https://en.cppreference.com/w/cpp/string/char_traits/find
+    [[nodiscard]] static constexpr const char_type* find(const char_type* p, size_t count, const char_type& ch) {
+        const char_type* it = lw_std::find(p, p + count, ch);
+        return it == p + count ? nullptr : it;
+    }
+};
+
+}  // namespace lw_std
\ No newline at end of file
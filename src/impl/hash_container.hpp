@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../dynamic_bitset.hpp"
 #include "../functional.hpp"
 #include "../vector.hpp"
 #include "iterator.hpp"
@@ -17,8 +18,12 @@ class hash_container_impl {
         END
     };
 
+    // NOTE: the elements are allocated and freed through the allocator of the container, the deleter is an empty
+    //       base for stateless allocators, so a bucket still holds just one pointer next to its state
+    using element_ptr = unique_ptr<T, allocator_delete<Allocator>>;
+
     struct bucket_t {
-        unique_ptr<T> elt{};
+        element_ptr elt{};
         bucket_state state{CLEAN};
 
         constexpr bucket_t() = default;
@@ -33,7 +38,7 @@ class hash_container_impl {
 
         constexpr bucket_t& operator=(const bucket_t& other) {
             if (other.elt)
-                elt = make_unique<T>(*other.elt);
+                elt = lw_std::allocate_unique<T>(other.elt.get_deleter().get_allocator(), *other.elt);
             state = other.state;
             return *this;
         }
@@ -47,14 +52,35 @@ class hash_container_impl {
 
     typedef typename Allocator::template rebind<bucket_t>::other bucket_allocator_t;
 
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+    // NOTE: iterators carry their container along, to jump to the next used bucket with its occupancy bitmap
+    template <typename B>
+    struct bucket_cursor {
+        constexpr bucket_cursor(B* b, const hash_container_impl* container)
+            : bucket(b), owner(container) {}
+
+        template <typename C>
+        constexpr bucket_cursor(const bucket_cursor<C>& other)
+            : bucket(other.bucket), owner(other.owner) {}
+
+        B* bucket;
+        const hash_container_impl* owner;
+    };
+
    public:
     /*
         MEMBER TYPES
     */
 
-    LWSTD_COMMON_CONTAINER_TYPES(T, bucket_t*, Allocator)
     LWSTD_COMMON_VALUE_TYPES(T)
 
+    using allocator_type = Allocator;
+    using iterator = iterator_impl<iterator_def<T, bucket_cursor<bucket_t>>, iterator_def<T, bucket_cursor<bucket_t>>>;
+    using const_iterator = iterator_impl<iterator_def<const T, bucket_cursor<const bucket_t>>, iterator>;
+
     using key_type = KeyType;
     using key_equal = Equal;
     using hasher = Hash;
@@ -105,33 +131,34 @@ class hash_container_impl {
     */
 
     // begin https://en.cppreference.com/w/cpp/container/unordered_set/begin
+    // NOTE: O(1), the first used bucket is kept up to date by insert and erase
     [[nodiscard]] constexpr iterator begin() noexcept {
-        return &find_first_used_bucket(*this);
+        return m_buckets.capacity() <= 1 ? end() : iterator_at(m_buckets[m_first_used]);
     }
 
     // begin https://en.cppreference.com/w/cpp/container/unordered_set/begin
     [[nodiscard]] constexpr const_iterator begin() const noexcept {
-        return &find_first_used_bucket(*this);
+        return m_buckets.capacity() <= 1 ? end() : iterator_at(m_buckets[m_first_used]);
     }
 
     // cbegin https://en.cppreference.com/w/cpp/container/unordered_set/begin
     [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
-        return &find_first_used_bucket(*this);
+        return begin();
     }
 
     // end https://en.cppreference.com/w/cpp/container/unordered_set/end
     [[nodiscard]] constexpr iterator end() noexcept {
-        return &m_buckets.back();
+        return iterator_at(m_buckets.back());
     }
 
     // end https://en.cppreference.com/w/cpp/container/unordered_set/end
     [[nodiscard]] constexpr const_iterator end() const noexcept {
-        return &m_buckets.back();
+        return iterator_at(m_buckets.back());
     }
 
     // cend https://en.cppreference.com/w/cpp/container/unordered_set/end
     [[nodiscard]] constexpr const_iterator cend() const noexcept {
-        return &m_buckets.back();
+        return end();
     }
 
     /*
@@ -159,7 +186,12 @@ class hash_container_impl {
 
     // clear https://en.cppreference.com/w/cpp/container/unordered_set/clear
     constexpr void clear() noexcept {
-        m_buckets.resize(0);
+        // NOTE: the bucket count is the capacity of m_buckets, so the storage has to go as well
+        m_buckets.clear();
+        m_buckets.shrink_to_fit();
+        m_used_buckets.clear();
+        m_used_buckets.shrink_to_fit();
+        m_first_used = 0;
         m_size = 0;
     }
 
@@ -195,14 +227,13 @@ class hash_container_impl {
         //       if capacity is zero we would get division by zero in hash
         rehash_if_needed();
 
-        // FIXME: use allocator
-        unique_ptr<T> element = make_unique<T>(lw_std::forward<Args>(args)...);
+        element_ptr element = lw_std::allocate_unique<T>(get_allocator(), lw_std::forward<Args>(args)...);
         auto hash = hash_element(key_access_proxy(*element));
-        iterator res = &find_hash(*this, key_access_proxy(*element), hash);
+        iterator res = iterator_at(find_hash(*this, key_access_proxy(*element), hash));
 
         if (res == end()) {
             m_size++;
-            return {insert_into_next_free_after(hash, element.release()), true};
+            return {insert_into_next_free_after(hash, lw_std::move(element)), true};
         }
 
         return {res, false};
@@ -213,11 +244,12 @@ class hash_container_impl {
     // erase (1) https://en.cppreference.com/w/cpp/container/unordered_set/erase
     constexpr iterator erase(const_iterator pos) {
         const auto& underlying_pos = static_cast<typename const_iterator::underlying_type>(pos);
-        auto* mutable_bucket = const_cast<bucket_t*>(underlying_pos.m_data);
+        auto* mutable_bucket = const_cast<bucket_t*>(underlying_pos.m_data.bucket);
         mutable_bucket->elt.reset();
         mutable_bucket->state = DELETED;
+        mark_unused(*mutable_bucket);
         m_size--;
-        return iterator(mutable_bucket) + 1;
+        return iterator_at(*mutable_bucket) + 1;
     }
 
     // erase (2) https://en.cppreference.com/w/cpp/container/unordered_set/erase
@@ -230,7 +262,7 @@ class hash_container_impl {
 
     // erase (3) https://en.cppreference.com/w/cpp/container/unordered_set/erase
     constexpr size_type erase(key_type key) {
-        const_iterator res = &find_hash(*this, key, hash_element(key));
+        const_iterator res = iterator_at(find_hash(*this, key, hash_element(key)));
         if (res == end()) return 0;
         erase(res);
         return 1;
@@ -238,6 +270,26 @@ class hash_container_impl {
 
     // FIXME: erase (4) https://en.cppreference.com/w/cpp/container/unordered_set/erase
 
+    // NOTE: non-standard, backs the free erase_if: one sweep over the buckets drops all matching elements,
+    //       then the remaining ones are rehashed in place, so no DELETED markers (tombstones) are left
+    //       to lengthen later probe sequences
+    template <typename Pred>
+    constexpr size_type erase_if(Pred pred) {
+        auto old_size = m_size;
+
+        for (auto& bucket : m_buckets) {
+            if (bucket.elt && pred(*bucket.elt)) {
+                bucket.elt.reset();
+                m_size--;
+            }
+        }
+
+        if (m_size != old_size)
+            rehash_in_place();
+
+        return old_size - m_size;
+    }
+
     // FIXME: swap https://en.cppreference.com/w/cpp/container/unordered_set/swap
 
     // FIXME: extract https://en.cppreference.com/w/cpp/container/unordered_set/extract
@@ -257,12 +309,12 @@ class hash_container_impl {
 
     // find (1) https://en.cppreference.com/w/cpp/container/unordered_set/find
     [[nodiscard]] constexpr iterator find(const key_type& key) {
-        return &find_hash(*this, key, hash_element(key));
+        return iterator_at(find_hash(*this, key, hash_element(key)));
     }
 
     // find (2) https://en.cppreference.com/w/cpp/container/unordered_set/find
     [[nodiscard]] constexpr const_iterator find(const key_type& key) const {
-        return &find_hash(*this, key, hash_element(key));
+        return iterator_at(find_hash(*this, key, hash_element(key)));
     }
 
     // FIXME: find (3) https://en.cppreference.com/w/cpp/container/unordered_set/find
@@ -332,6 +384,14 @@ class hash_container_impl {
     // FIXME: key_eq https://en.cppreference.com/w/cpp/container/unordered_set/key_eq
 
    protected:
+    [[nodiscard]] constexpr iterator iterator_at(bucket_t& bucket) noexcept {
+        return iterator(bucket_cursor<bucket_t>(&bucket, this));
+    }
+
+    [[nodiscard]] constexpr const_iterator iterator_at(const bucket_t& bucket) const noexcept {
+        return const_iterator(bucket_cursor<const bucket_t>(&bucket, this));
+    }
+
     [[nodiscard]] constexpr const key_type& key_access_proxy(const_reference elt) const {
         return Derived::key_access_proxy(elt);
     }
@@ -366,6 +426,7 @@ class hash_container_impl {
        protected:
         typedef P value_type;
         typedef IT_P data_type;
+        typedef forward_iterator_tag iterator_category;
 
         constexpr iterator_def() = default;
 
@@ -395,38 +456,50 @@ class hash_container_impl {
         }
 
         [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
-            return m_data == other.m_data;
+            return m_data.bucket == other.m_data.bucket;
         }
 
         [[nodiscard]] constexpr P* get() {
-            return m_data->elt.get();
+            return m_data.bucket->elt.get();
         }
 
         [[nodiscard]] constexpr const P* get() const {
-            return m_data->elt.get();
+            return m_data.bucket->elt.get();
         }
 
-        constexpr void advance(int n) {
-            for (int i = 0; i < n; ++i)
-                do {
-                    if (m_data->state == END) return;
-                    m_data++;
-                } while (!m_data->elt);
+        constexpr void advance(ptrdiff_t n) {
+            for (ptrdiff_t i = 0; i < n; ++i) {
+                if (m_data.bucket->state == END) return;
+
+                // NOTE: short gaps are stepped over bucket by bucket (independent loads of adjacent buckets),
+                //       longer ones are jumped with the occupancy bitmap
+                ++m_data.bucket;
+                for (int gap = 1; !m_data.bucket->elt && m_data.bucket->state != END; ++gap) {
+                    if (gap == short_gap) {
+                        m_data.bucket += m_data.owner->distance_to_next_used(m_data.bucket);
+                        break;
+                    }
+                    ++m_data.bucket;
+                }
+            }
         }
 
        private:
-        IT_P m_data{nullptr};
+        static constexpr int short_gap = 4;
+
+        IT_P m_data{nullptr, nullptr};
     };
 
     [[nodiscard]] constexpr size_type capacity() const {
         return m_buckets.capacity() - 1;  // end bucket not included
     }
 
-    constexpr iterator insert_into_next_free_after(typename Hash::result_type hash, T* elt) {
+    constexpr iterator insert_into_next_free_after(typename Hash::result_type hash, element_ptr&& elt) {
         bucket_t& free_spot = iterate_buckets_until(*this, hash, [](bucket_t& b) -> pair<bool, bucket_t*> { return {!b.elt, &b}; });
-        free_spot.elt.reset(elt);
+        free_spot.elt = lw_std::move(elt);
         free_spot.state = CLEAN;
-        return &free_spot;
+        mark_used(free_spot);
+        return iterator_at(free_spot);
     }
 
     constexpr void rehash_if_needed(size_type num_buckets = 0) {
@@ -445,26 +518,31 @@ class hash_container_impl {
             if (implicit_resize) num_buckets += 8;
 
             m_buckets.resize(num_buckets);
-            for (size_type i = 0; i < m_buckets.capacity(); ++i)
-                rehash_element(m_buckets[i]);
+            rehash_in_place();
+        }
+    }
 
-            for (size_type i = 0; i < m_buckets.capacity(); ++i)
-                m_buckets[i].state = CLEAN;
+    constexpr void rehash_in_place() {
+        for (size_type i = 0; i < m_buckets.capacity(); ++i)
+            rehash_element(m_buckets[i]);
 
-            m_buckets.back().state = END;
-        }
+        for (size_type i = 0; i < m_buckets.capacity(); ++i)
+            m_buckets[i].state = CLEAN;
+
+        m_buckets.back().state = END;
+        rebuild_used_buckets();
     }
 
     constexpr void rehash_element(bucket_t& bucket) {
         if (bucket.elt && bucket.state != REHASHED) {
-            T* element = bucket.elt.release();
+            element_ptr element = lw_std::move(bucket.elt);
             bucket.state = REHASHED;
             auto new_hash = hash_element(key_access_proxy(*element));
 
-            iterate_buckets_until(*this, new_hash, [this, element](bucket_t& b) -> pair<bool, bucket_t*> {
+            iterate_buckets_until(*this, new_hash, [this, &element](bucket_t& b) -> pair<bool, bucket_t*> {
                 rehash_element(b);
                 if (!b.elt) {
-                    b.elt.reset(element);
+                    b.elt = lw_std::move(element);
                     b.state = REHASHED;
                     return {true, &b};
                 }
@@ -473,14 +551,50 @@ class hash_container_impl {
         }
     }
 
-    template <typename This>
-    [[nodiscard]] static constexpr auto& find_first_used_bucket(This& obj) {
-        typedef decltype(obj.m_buckets.back()) bucket_ref_type;
-        typedef decltype(&obj.m_buckets.back()) bucket_ptr_type;
+    [[nodiscard]] constexpr size_type index_of(const bucket_t& bucket) const noexcept {
+        return static_cast<size_type>(&bucket - m_buckets.data());
+    }
 
-        return iterate_buckets_until(obj, 0, [](bucket_ref_type b) -> pair<bool, bucket_ptr_type> {
-            return {b.elt, &b};
-        });
+    // NOTE: the next used bucket (or the end bucket) with count-trailing-zeros on the occupancy bitmap,
+    //       instead of testing every bucket in between
+    [[nodiscard]] constexpr ptrdiff_t distance_to_next_used(const bucket_t* bucket) const noexcept {
+        // NOTE: the end bucket is marked, so there always is a set bit after an unused bucket
+        auto index = index_of(*bucket);
+        const auto* blocks = m_used_buckets.blocks();
+
+        auto block_index = index / 64;
+        auto block = blocks[block_index] >> (index % 64);
+        if (block != 0) return countr_zero(block);
+
+        do {
+            block = blocks[++block_index];
+        } while (block == 0);
+
+        return static_cast<ptrdiff_t>(block_index * 64 - index) + countr_zero(block);
+    }
+
+    constexpr void mark_used(const bucket_t& bucket) {
+        auto index = index_of(bucket);
+        m_used_buckets.set(index);
+        if (index < m_first_used) m_first_used = index;
+    }
+
+    constexpr void mark_unused(const bucket_t& bucket) {
+        auto index = index_of(bucket);
+        m_used_buckets.reset(index);
+        if (index == m_first_used) m_first_used = m_used_buckets.find_next(index);
+    }
+
+    // NOTE: the end bucket is always marked, so the search for the next used bucket stops there
+    constexpr void rebuild_used_buckets() {
+        m_used_buckets.reset();
+        m_used_buckets.resize(m_buckets.capacity());
+
+        for (size_type i = 0; i < m_buckets.capacity(); ++i)
+            if (m_buckets[i].elt) m_used_buckets.set(i);
+
+        m_used_buckets.set(index_of(m_buckets.back()));
+        m_first_used = m_used_buckets.find_first();
     }
 
     template <typename This, typename UnaryPredicate>
@@ -501,6 +615,10 @@ class hash_container_impl {
 
     vector<bucket_t, bucket_allocator_t> m_buckets{};
     size_type m_size = 0;
+
+    // NOTE: one bit per bucket that holds an element, plus the end bucket
+    dynamic_bitset m_used_buckets{};
+    size_type m_first_used = 0;
 };
 
 }  // namespace lw_std
\ No newline at end of file
@@ -1,12 +1,55 @@
 #pragma once
 
+#include "../type_traits.hpp"
+
+#ifdef LWSTD_BUILD_STD_COMPATIBILITY
+#    include <iterator>
+#endif
+
 namespace lw_std {
 
+/*
+    Iterator tags
+*/
+
+#ifdef LWSTD_BUILD_STD_COMPATIBILITY
+// NOTE: with std compatibility the tags are the ones of std, so iterators of the std containers dispatch like ours
+using input_iterator_tag = ::std::input_iterator_tag;
+using output_iterator_tag = ::std::output_iterator_tag;
+using forward_iterator_tag = ::std::forward_iterator_tag;
+using bidirectional_iterator_tag = ::std::bidirectional_iterator_tag;
+using random_access_iterator_tag = ::std::random_access_iterator_tag;
+#else
+// input_iterator_tag https://en.cppreference.com/w/cpp/iterator/iterator_tags
+struct input_iterator_tag {};
+
+// output_iterator_tag https://en.cppreference.com/w/cpp/iterator/iterator_tags
+struct output_iterator_tag {};
+
+// forward_iterator_tag https://en.cppreference.com/w/cpp/iterator/iterator_tags
+struct forward_iterator_tag : public input_iterator_tag {};
+
+// bidirectional_iterator_tag https://en.cppreference.com/w/cpp/iterator/iterator_tags
+struct bidirectional_iterator_tag : public forward_iterator_tag {};
+
+// random_access_iterator_tag https://en.cppreference.com/w/cpp/iterator/iterator_tags
+struct random_access_iterator_tag : public bidirectional_iterator_tag {};
+#endif
+
+// NOTE: it (the iterator_def of a container) provides equal, get and advance(difference_type) and names its iterator_category;
+//       bidirectional iterators have to accept negative steps in advance, random access ones also provide distance_to,
+//       the operators of the stronger categories are only instantiated if they are used
 template <typename it, typename non_const_it>
 class iterator_impl : public it {
    public:
     typedef it underlying_type;
 
+    using iterator_category = typename it::iterator_category;
+    using value_type = remove_cv_t<typename it::value_type>;
+    using difference_type = ptrdiff_t;
+    using pointer = typename it::value_type*;
+    using reference = typename it::value_type&;
+
     constexpr iterator_impl(const typename it::data_type& data)
         : it(data) {}
 
@@ -42,7 +85,7 @@ class iterator_impl : public it {
         return tmp;
     }
 
-    constexpr iterator_impl operator+(int n) const {
+    constexpr iterator_impl operator+(difference_type n) const {
         iterator_impl tmp(*this);
         tmp.advance(n);
         return tmp;
@@ -56,6 +99,66 @@ class iterator_impl : public it {
         return !it::equal(static_cast<const it&>(rhs));
     }
 
+    /*
+        bidirectional
+    */
+
+    constexpr iterator_impl& operator--() {
+        it::advance(-1);
+        return *this;
+    }
+
+    constexpr iterator_impl operator--(int) {
+        iterator_impl tmp(*this);
+        it::advance(-1);
+        return tmp;
+    }
+
+    /*
+        random access
+    */
+
+    constexpr iterator_impl& operator+=(difference_type n) {
+        it::advance(n);
+        return *this;
+    }
+
+    constexpr iterator_impl& operator-=(difference_type n) {
+        it::advance(-n);
+        return *this;
+    }
+
+    constexpr iterator_impl operator-(difference_type n) const {
+        iterator_impl tmp(*this);
+        tmp.advance(-n);
+        return tmp;
+    }
+
+    [[nodiscard]] constexpr difference_type operator-(const iterator_impl& rhs) const {
+        return rhs.distance_to(*this);
+    }
+
+    // NOTE: iterators which dereference to a proxy (e.g. flat_map) build it inside the temporary, don't use this on them
+    [[nodiscard]] constexpr auto& operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    [[nodiscard]] constexpr bool operator<(const iterator_impl& rhs) const {
+        return it::distance_to(rhs) > 0;
+    }
+
+    [[nodiscard]] constexpr bool operator>(const iterator_impl& rhs) const {
+        return rhs < *this;
+    }
+
+    [[nodiscard]] constexpr bool operator<=(const iterator_impl& rhs) const {
+        return !(rhs < *this);
+    }
+
+    [[nodiscard]] constexpr bool operator>=(const iterator_impl& rhs) const {
+        return !(*this < rhs);
+    }
+
     [[nodiscard]] constexpr auto& operator*() {
         return *it::get();
     }
@@ -73,4 +176,9 @@ class iterator_impl : public it {
     }
 };
 
+template <typename it, typename non_const_it>
+[[nodiscard]] constexpr iterator_impl<it, non_const_it> operator+(typename iterator_impl<it, non_const_it>::difference_type n, const iterator_impl<it, non_const_it>& iter) {
+    return iter + n;
+}
+
 }  // namespace lw_std
\ No newline at end of file
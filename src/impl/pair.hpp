@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../compare.hpp"
 #include "move.hpp"
 
 #ifdef LWSTD_BUILD_STD_COMPATIBILITY
@@ -30,7 +31,9 @@ struct pair {
     */
 
     // (constructor) (1) https://en.cppreference.com/w/cpp/utility/pair/pair
-    constexpr pair() = default;
+    // NOTE: value initializes both members like std::pair, which also keeps it usable in constant expressions
+    constexpr pair()
+        : first(), second() {}
 
     // (constructor) (2) https://en.cppreference.com/w/cpp/utility/pair/pair
     constexpr pair(const first_type& t, const second_type& u)
@@ -110,51 +113,51 @@ template <typename T1, typename T2>
 }
 
 // operator== (1) https://en.cppreference.com/w/cpp/utility/pair/operator_cmp
-template <typename T1, typename T2>
-[[nodiscard]] constexpr bool operator==(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
+// NOTE: heterogeneous like the C++23 version, so proxy pairs of references (e.g. flat_map) compare against value pairs
+template <typename T1, typename T2, typename U1, typename U2>
+[[nodiscard]] constexpr bool operator==(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
     return lhs.first == rhs.first && lhs.second == rhs.second;
 }
 
 // operator!= (2) https://en.cppreference.com/w/cpp/utility/pair/operator_cmp
-template <typename T1, typename T2>
-[[nodiscard]] constexpr bool operator!=(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
+template <typename T1, typename T2, typename U1, typename U2>
+[[nodiscard]] constexpr bool operator!=(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
     return !operator==(lhs, rhs);
 }
 
+// NOTE: operator<=> (7) https://en.cppreference.com/w/cpp/utility/pair/operator_cmp as C++17 overload of synthesized_cmp_three_way,
+//       first and second are each compared once
+template <typename T1, typename T2>
+[[nodiscard]] constexpr int synthesized_cmp_three_way(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
+    if (int res = synthesized_cmp_three_way(lhs.first, rhs.first); res != 0)
+        return res;
+    return synthesized_cmp_three_way(lhs.second, rhs.second);
+}
+
 // operator< (3) https://en.cppreference.com/w/cpp/utility/pair/operator_cmp
 template <typename T1, typename T2>
 [[nodiscard]] constexpr bool operator<(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
-    if (synthesized_cmp_equal(lhs.first, rhs.first))
-        return synthesized_cmp_less(lhs.second, rhs.second);
-    return synthesized_cmp_less(lhs.first, rhs.first);
+    return synthesized_cmp_three_way(lhs, rhs) < 0;
 }
 
 // operator<= (4) https://en.cppreference.com/w/cpp/utility/pair/operator_cmp
 template <typename T1, typename T2>
 [[nodiscard]] constexpr bool operator<=(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
-    if (synthesized_cmp_equal(lhs.first, rhs.first))
-        return synthesized_cmp_less_equal(lhs.second, rhs.second);
-    return synthesized_cmp_less_equal(lhs.first, rhs.first);
+    return synthesized_cmp_three_way(lhs, rhs) <= 0;
 }
 
 // operator> (5) https://en.cppreference.com/w/cpp/utility/pair/operator_cmp
 template <typename T1, typename T2>
 [[nodiscard]] constexpr bool operator>(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
-    if (synthesized_cmp_equal(lhs.first, rhs.first))
-        return synthesized_cmp_greater(lhs.second, rhs.second);
-    return synthesized_cmp_greater(lhs.first, rhs.first);
+    return synthesized_cmp_three_way(lhs, rhs) > 0;
 }
 
 // operator> (6) https://en.cppreference.com/w/cpp/utility/pair/operator_cmp
 template <typename T1, typename T2>
 [[nodiscard]] constexpr bool operator>=(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs) {
-    if (synthesized_cmp_equal(lhs.first, rhs.first))
-        return synthesized_cmp_greater_equal(lhs.second, rhs.second);
-    return synthesized_cmp_greater_equal(lhs.first, rhs.first);
+    return synthesized_cmp_three_way(lhs, rhs) >= 0;
 }
 
-// FIXME: operator<=> (7) https://en.cppreference.com/w/cpp/utility/pair/operator_cmp
-
 #ifdef LWSTD_BUILD_STD_COMPATIBILITY
 
 #    define LWSTD_GENERATE_COMPAT_HELPER1(op_name)                                                      \
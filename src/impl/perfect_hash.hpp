@@ -0,0 +1,152 @@
+#pragma once
+
+#include "../algorithm.hpp"
+#include "../bit.hpp"
+#include "../type_traits.hpp"
+#include "../utility.hpp"
+
+namespace lw_std {
+
+namespace impl {
+
+// NOTE: not constexpr on purpose: calling them stops the constant evaluation of a frozen container and the compiler
+//       names them in its error, a table that is built at runtime keeps the first of the two keys
+inline void frozen_duplicate_key() {}
+inline void frozen_hash_collision() {}
+
+// NOTE: finalizer of a hash and a seed that spreads every bit of both over the whole result,
+//       splitmix64 for 64-bit size_t, murmur3's fmix32 for 32-bit targets
+[[nodiscard]] constexpr size_t perfect_hash_mix(size_t hash, uint32_t seed) {
+    if constexpr (sizeof(size_t) >= 8) {
+        size_t x = hash ^ (size_t{seed} * static_cast<size_t>(0x9E3779B97F4A7C15ull));
+        x ^= x >> 31;
+        x *= static_cast<size_t>(0xBF58476D1CE4E5B9ull);
+        x ^= x >> 29;
+        return x;
+    } else {
+        size_t x = hash ^ (size_t{seed} * size_t{0x9E3779B9u});
+        x ^= x >> 16;
+        x *= size_t{0x85EBCA6Bu};
+        x ^= x >> 13;
+        x *= size_t{0xC2B2AE35u};
+        x ^= x >> 16;
+        return x;
+    }
+}
+
+// NOTE: minimal perfect hash from the hashes of N keys to their positions 0..N-1 ("hash and displace"):
+//       the first mix with a global seed picks a bucket, the bucket's displacement is the seed of the second mix,
+//       which picks the slot that holds the position; the displacements are searched bucket by bucket, the largest
+//       first, until all keys of the bucket land on free slots;
+//       a lookup hashes the key once and mixes the hash twice, a slot a key never hashes to holds any position,
+//       so the caller always compares the key it finds there
+template <size_t N>
+class perfect_hash {
+    static_assert(N > 0, "a perfect hash needs at least one key");
+
+   public:
+    using index_type = conditional_t<(N <= 0xFF), uint8_t, conditional_t<(N <= 0xFFFF), uint16_t, uint32_t>>;
+
+    static constexpr size_t slot_count = bit_ceil(N);
+    static constexpr size_t bucket_count = max_of(slot_count / 2, size_t{1});
+
+    // NOTE: keys_equal(i, j) compares the keys at positions i and j, it is only called for keys with the same hash
+    template <typename KeysEqual>
+    constexpr perfect_hash(const size_t (&hashes)[N], KeysEqual keys_equal) {
+        bool unreachable[N] = {};
+        for (uint32_t seed = 1; !build(hashes, keys_equal, unreachable, seed); ++seed) {
+        }
+    }
+
+    [[nodiscard]] constexpr index_type operator()(size_t hash) const {
+        uint32_t displacement = m_displacements[perfect_hash_mix(hash, m_seed) & (bucket_count - 1)];
+        return m_slots[perfect_hash_mix(hash, displacement) & (slot_count - 1)];
+    }
+
+   private:
+    index_type m_slots[slot_count] = {};
+    uint32_t m_displacements[bucket_count] = {};
+    uint32_t m_seed = 0;
+
+    // NOTE: tries a seed, false if a bucket finds no displacement in reasonable time
+    template <typename KeysEqual>
+    constexpr bool build(const size_t (&hashes)[N], KeysEqual keys_equal, bool (&unreachable)[N], uint32_t seed) {
+        constexpr size_t none = N;
+        constexpr uint32_t max_displacement = 64 * slot_count + 1024;
+
+        // NOTE: the keys of a bucket as a singly linked list of positions
+        size_t first[bucket_count] = {};
+        size_t next[N] = {};
+        size_t size[bucket_count] = {};
+        size_t largest = 0;
+
+        for (size_t b = 0; b < bucket_count; ++b)
+            first[b] = none;
+
+        for (size_t i = 0; i < N; ++i) {
+            size_t b = perfect_hash_mix(hashes[i], seed) & (bucket_count - 1);
+            next[i] = first[b];
+            first[b] = i;
+            largest = max_of(largest, ++size[b]);
+        }
+
+        bool taken[slot_count] = {};
+        for (size_t b = 0; b < bucket_count; ++b)
+            m_displacements[b] = 0;
+
+        for (size_t bucket_size = largest; bucket_size > 0; --bucket_size)
+            for (size_t b = 0; b < bucket_count; ++b) {
+                if (size[b] != bucket_size) continue;
+
+                // NOTE: keys with the same hash share every bucket and every slot, no displacement separates them
+                for (size_t i = first[b]; i != none; i = next[i])
+                    for (size_t j = next[i]; j != none; j = next[j])
+                        if (!unreachable[i] && !unreachable[j] && hashes[i] == hashes[j]) {
+                            if (keys_equal(i, j))
+                                frozen_duplicate_key();
+                            else
+                                frozen_hash_collision();
+                            unreachable[i > j ? i : j] = true;
+                        }
+
+                uint32_t displacement = 1;
+                for (; !fits(hashes, first[b], next, taken, unreachable, displacement); ++displacement)
+                    if (displacement == max_displacement) return false;
+
+                m_displacements[b] = displacement;
+                for (size_t i = first[b]; i != none; i = next[i])
+                    if (!unreachable[i]) {
+                        size_t slot = perfect_hash_mix(hashes[i], displacement) & (slot_count - 1);
+                        taken[slot] = true;
+                        m_slots[slot] = static_cast<index_type>(i);
+                    }
+            }
+
+        m_seed = seed;
+        return true;
+    }
+
+    // NOTE: whether all keys of the bucket land on free and different slots with the displacement
+    constexpr bool fits(const size_t (&hashes)[N], size_t first, const size_t (&next)[N], bool (&taken)[slot_count], const bool (&unreachable)[N], uint32_t displacement) const {
+        constexpr size_t none = N;
+
+        size_t placed = first;
+        for (; placed != none; placed = next[placed]) {
+            if (unreachable[placed]) continue;
+
+            size_t slot = perfect_hash_mix(hashes[placed], displacement) & (slot_count - 1);
+            if (taken[slot]) break;
+            taken[slot] = true;
+        }
+
+        // NOTE: the slots are only reserved for the search, give back the ones taken so far
+        for (size_t i = first; i != placed; i = next[i])
+            if (!unreachable[i]) taken[perfect_hash_mix(hashes[i], displacement) & (slot_count - 1)] = false;
+
+        return placed == none;
+    }
+};
+
+}  // namespace impl
+
+}  // namespace lw_std
\ No newline at end of file
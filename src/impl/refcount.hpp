@@ -0,0 +1,81 @@
+#pragma once
+
+namespace lw_std {
+
+// NOTE: non-standard, the reference count policy of shared_ptr, weak_ptr and intrusive_ref_counter:
+//       atomic_refcount can be shared between threads, it uses the gcc/clang __atomic builtins;
+//       a copy increments with relaxed order, the decrement is acq_rel, so the last owner sees every write
+//       made through the other owners before it destroys the object
+class atomic_refcount {
+   public:
+    using count_type = long;
+
+    constexpr explicit atomic_refcount(count_type initial) noexcept
+        : m_count(initial) {}
+
+    void increment() noexcept {
+        __atomic_fetch_add(&m_count, 1, __ATOMIC_RELAXED);
+    }
+
+    // NOTE: returns the new count
+    count_type decrement() noexcept {
+        return __atomic_sub_fetch(&m_count, 1, __ATOMIC_ACQ_REL);
+    }
+
+    // NOTE: for weak_ptr::lock, the count must not come back from zero
+    bool increment_if_not_zero() noexcept {
+        count_type count = __atomic_load_n(&m_count, __ATOMIC_RELAXED);
+        while (count != 0)
+            if (__atomic_compare_exchange_n(&m_count, &count, count + 1, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) return true;
+        return false;
+    }
+
+    [[nodiscard]] count_type load() const noexcept {
+        return __atomic_load_n(&m_count, __ATOMIC_ACQUIRE);
+    }
+
+   private:
+    count_type m_count;
+};
+
+// NOTE: non-standard, a plain integer for single threaded targets (no owner may be copied from an interrupt),
+//       a copy is one increment, no bus lock or memory barrier
+class nonatomic_refcount {
+   public:
+    using count_type = long;
+
+    constexpr explicit nonatomic_refcount(count_type initial) noexcept
+        : m_count(initial) {}
+
+    void increment() noexcept {
+        ++m_count;
+    }
+
+    count_type decrement() noexcept {
+        return --m_count;
+    }
+
+    bool increment_if_not_zero() noexcept {
+        if (m_count == 0) return false;
+        ++m_count;
+        return true;
+    }
+
+    [[nodiscard]] count_type load() const noexcept {
+        return m_count;
+    }
+
+   private:
+    count_type m_count;
+};
+
+// NOTE: non-standard, the policy of shared_ptr and intrusive_ref_counter when none is given;
+//       define LWSTD_SINGLE_THREADED to make it nonatomic_refcount, which it always is on AVR (no threads and
+//       no lock free atomics for a long)
+#if defined(LWSTD_SINGLE_THREADED) || defined(__AVR__)
+using default_refcount = nonatomic_refcount;
+#else
+using default_refcount = atomic_refcount;
+#endif
+
+}  // namespace lw_std
\ No newline at end of file
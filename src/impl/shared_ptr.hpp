@@ -0,0 +1,654 @@
+#pragma once
+
+#include "../type_traits.hpp"
+#include "allocator.hpp"
+#include "move.hpp"
+#include "refcount.hpp"
+#include "unique_ptr.hpp"
+
+namespace lw_std {
+
+template <typename T, typename RefCount = default_refcount>
+class shared_ptr;
+
+template <typename T, typename RefCount = default_refcount>
+class weak_ptr;
+
+namespace impl {
+
+// NOTE: whether a Y* converts to a T*, for the converting constructors (there is no is_convertible yet)
+template <typename T>
+true_type converts_to_pointer(T*);
+
+template <typename T>
+false_type converts_to_pointer(...);
+
+template <typename Y, typename T>
+inline constexpr bool pointer_converts_v = decltype(converts_to_pointer<T>(static_cast<Y*>(nullptr)))::value;
+
+// NOTE: the counts of a shared object, the owners together hold one weak reference, so the block outlives the
+//       object as long as there are weak_ptrs; what the object is and how the block is freed is up to the derived block
+template <typename RefCount>
+class shared_count_block {
+   public:
+    shared_count_block(const shared_count_block&) = delete;
+    shared_count_block& operator=(const shared_count_block&) = delete;
+
+    void add_shared() noexcept {
+        m_shared.increment();
+    }
+
+    [[nodiscard]] bool add_shared_if_alive() noexcept {
+        return m_shared.increment_if_not_zero();
+    }
+
+    void release_shared() noexcept {
+        if (m_shared.decrement() == 0) {
+            destroy_object();
+            // NOTE: without weak_ptrs nobody can reach the weak count anymore, which saves its decrement
+            if (m_weak.load() == 1)
+                destroy_block();
+            else
+                release_weak();
+        }
+    }
+
+    void add_weak() noexcept {
+        m_weak.increment();
+    }
+
+    void release_weak() noexcept {
+        if (m_weak.decrement() == 0) destroy_block();
+    }
+
+    [[nodiscard]] long use_count() const noexcept {
+        return m_shared.load();
+    }
+
+   protected:
+    constexpr shared_count_block() noexcept = default;
+    ~shared_count_block() = default;
+
+    virtual void destroy_object() noexcept = 0;
+    virtual void destroy_block() noexcept = 0;
+
+   private:
+    RefCount m_shared{1};
+    RefCount m_weak{1};
+};
+
+// NOTE: the control block of a shared_ptr that took over a pointer, a second allocation next to the object
+template <typename Y, typename Deleter, typename RefCount>
+class shared_pointer_block final : public shared_count_block<RefCount>, private ebo_holder<Deleter> {
+   public:
+    shared_pointer_block(Y* ptr, Deleter&& deleter)
+        : ebo_holder<Deleter>(lw_std::move(deleter)), m_ptr(ptr) {}
+
+   private:
+    Y* m_ptr;
+
+    void destroy_object() noexcept override {
+        ebo_holder<Deleter>::held()(m_ptr);
+    }
+
+    void destroy_block() noexcept override {
+        delete this;
+    }
+};
+
+struct for_overwrite_tag {};
+
+struct shared_ptr_access;
+
+// NOTE: the control block of make_shared/allocate_shared, the object lives inside it, so both take one allocation;
+//       it keeps a copy of the allocator given to allocate_shared (an empty base if stateless) to free itself
+template <typename T, typename Allocator, typename RefCount>
+class shared_inplace_block final : public shared_count_block<RefCount>, private ebo_holder<Allocator> {
+   public:
+    template <typename... Args>
+    explicit shared_inplace_block(const Allocator& alloc, Args&&... args)
+        : ebo_holder<Allocator>(alloc) {
+        allocator<T>().construct(get(), lw_std::forward<Args>(args)...);
+    }
+
+    // NOTE: default initializes the object, which leaves trivial types uninitialized
+    shared_inplace_block(const Allocator& alloc, for_overwrite_tag)
+        : ebo_holder<Allocator>(alloc) {
+        ::new (static_cast<void*>(get())) T;
+    }
+
+    [[nodiscard]] T* get() noexcept {
+        return &m_storage.value;
+    }
+
+   private:
+    union storage {
+        storage() noexcept {}
+        ~storage() {}
+
+        T value;
+    } m_storage;
+
+    void destroy_object() noexcept override {
+        m_storage.value.~T();
+    }
+
+    void destroy_block() noexcept override {
+        typename Allocator::template rebind<shared_inplace_block>::other alloc(ebo_holder<Allocator>::held());
+        this->~shared_inplace_block();
+        alloc.deallocate(this, 1);
+    }
+};
+
+}  // namespace impl
+
+// shared_ptr https://en.cppreference.com/w/cpp/memory/shared_ptr
+// NOTE: RefCount is non-standard, the reference count policy (atomic_refcount or nonatomic_refcount), pointers only
+//       convert into pointers of the same policy; two pointers wide, the counts are in a control block, which
+//       make_shared/allocate_shared allocate together with the object
+// FIXME: arrays, enable_shared_from_this
+template <typename T, typename RefCount>
+class shared_ptr {
+    using block_type = impl::shared_count_block<RefCount>;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using element_type = remove_extent_t<T>;
+    using weak_type = weak_ptr<T, RefCount>;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    constexpr shared_ptr() noexcept = default;
+
+    // (constructor) (2) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    constexpr shared_ptr(decltype(nullptr)) noexcept {}
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    // NOTE: the control block is a second allocation, make_shared needs only one
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    explicit shared_ptr(Y* ptr)
+        : shared_ptr(ptr, default_delete<Y>()) {}
+
+    // (constructor) (4) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    template <typename Y, typename Deleter, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    shared_ptr(Y* ptr, Deleter d)
+        : m_ptr(ptr), m_block(new impl::shared_pointer_block<Y, Deleter, RefCount>(ptr, lw_std::move(d))) {}
+
+    // FIXME: (constructor) (5-7) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+
+    // (constructor) (8) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    // NOTE: shares the ownership of r but points to ptr, e.g. a member of the object or a part of a shared buffer
+    template <typename Y>
+    shared_ptr(const shared_ptr<Y, RefCount>& r, element_type* ptr) noexcept
+        : m_ptr(ptr), m_block(r.m_block) {
+        if (m_block != nullptr) m_block->add_shared();
+    }
+
+    // (constructor) (9) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    shared_ptr(const shared_ptr& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        if (m_block != nullptr) m_block->add_shared();
+    }
+
+    // (constructor) (9) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    shared_ptr(const shared_ptr<Y, RefCount>& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        if (m_block != nullptr) m_block->add_shared();
+    }
+
+    // (constructor) (10) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    // NOTE: no count is touched
+    shared_ptr(shared_ptr&& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        r.m_ptr = nullptr;
+        r.m_block = nullptr;
+    }
+
+    // (constructor) (10) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    shared_ptr(shared_ptr<Y, RefCount>&& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        r.m_ptr = nullptr;
+        r.m_block = nullptr;
+    }
+
+    // (constructor) (11) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    // NOTE: there are no exceptions, an expired weak_ptr gives an empty shared_ptr instead of throwing bad_weak_ptr
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    explicit shared_ptr(const weak_ptr<Y, RefCount>& r) noexcept
+        : shared_ptr(r.lock()) {}
+
+    // (constructor) (13) https://en.cppreference.com/w/cpp/memory/shared_ptr/shared_ptr
+    template <typename Y, typename Deleter, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    shared_ptr(unique_ptr<Y, Deleter>&& r)
+        : m_ptr(r.get()) {
+        if (m_ptr != nullptr) m_block = new impl::shared_pointer_block<Y, Deleter, RefCount>(r.get(), lw_std::move(r.get_deleter()));
+        static_cast<void>(r.release());
+    }
+
+    // (destructor) https://en.cppreference.com/w/cpp/memory/shared_ptr/~shared_ptr
+    ~shared_ptr() {
+        if (m_block != nullptr) m_block->release_shared();
+    }
+
+    // operator= (1) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator%3D
+    shared_ptr& operator=(const shared_ptr& r) noexcept {
+        shared_ptr(r).swap(*this);
+        return *this;
+    }
+
+    // operator= (1) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator%3D
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    shared_ptr& operator=(const shared_ptr<Y, RefCount>& r) noexcept {
+        shared_ptr(r).swap(*this);
+        return *this;
+    }
+
+    // operator= (2) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator%3D
+    shared_ptr& operator=(shared_ptr&& r) noexcept {
+        shared_ptr(lw_std::move(r)).swap(*this);
+        return *this;
+    }
+
+    // operator= (2) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator%3D
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    shared_ptr& operator=(shared_ptr<Y, RefCount>&& r) noexcept {
+        shared_ptr(lw_std::move(r)).swap(*this);
+        return *this;
+    }
+
+    // operator= (4) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator%3D
+    template <typename Y, typename Deleter, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    shared_ptr& operator=(unique_ptr<Y, Deleter>&& r) {
+        shared_ptr(lw_std::move(r)).swap(*this);
+        return *this;
+    }
+
+    /*
+        Modifiers
+    */
+
+    // reset (1) https://en.cppreference.com/w/cpp/memory/shared_ptr/reset
+    void reset() noexcept {
+        shared_ptr().swap(*this);
+    }
+
+    // reset (2) https://en.cppreference.com/w/cpp/memory/shared_ptr/reset
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    void reset(Y* ptr) {
+        shared_ptr(ptr).swap(*this);
+    }
+
+    // reset (3) https://en.cppreference.com/w/cpp/memory/shared_ptr/reset
+    template <typename Y, typename Deleter, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    void reset(Y* ptr, Deleter d) {
+        shared_ptr(ptr, lw_std::move(d)).swap(*this);
+    }
+
+    // FIXME: reset (4) https://en.cppreference.com/w/cpp/memory/shared_ptr/reset
+
+    // swap https://en.cppreference.com/w/cpp/memory/shared_ptr/swap
+    void swap(shared_ptr& r) noexcept {
+        lw_std::swap(m_ptr, r.m_ptr);
+        lw_std::swap(m_block, r.m_block);
+    }
+
+    /*
+        Observers
+    */
+
+    // get https://en.cppreference.com/w/cpp/memory/shared_ptr/get
+    [[nodiscard]] element_type* get() const noexcept {
+        return m_ptr;
+    }
+
+    // operator* https://en.cppreference.com/w/cpp/memory/shared_ptr/operator*
+    // NOTE: a template, so shared_ptr<void> compiles
+    template <typename U = T>
+    [[nodiscard]] U& operator*() const noexcept {
+        return *m_ptr;
+    }
+
+    // operator-> https://en.cppreference.com/w/cpp/memory/shared_ptr/operator*
+    [[nodiscard]] T* operator->() const noexcept {
+        return m_ptr;
+    }
+
+    // FIXME: operator[] https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_at
+
+    // use_count https://en.cppreference.com/w/cpp/memory/shared_ptr/use_count
+    // NOTE: with atomic_refcount only a hint, other threads may change it at any time
+    [[nodiscard]] long use_count() const noexcept {
+        return m_block == nullptr ? 0 : m_block->use_count();
+    }
+
+    // operator bool https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_bool
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return m_ptr != nullptr;
+    }
+
+    // owner_before https://en.cppreference.com/w/cpp/memory/shared_ptr/owner_before
+    template <typename Y>
+    [[nodiscard]] bool owner_before(const shared_ptr<Y, RefCount>& other) const noexcept {
+        return reinterpret_cast<uintptr_t>(m_block) < reinterpret_cast<uintptr_t>(other.m_block);
+    }
+
+    // owner_before https://en.cppreference.com/w/cpp/memory/shared_ptr/owner_before
+    template <typename Y>
+    [[nodiscard]] bool owner_before(const weak_ptr<Y, RefCount>& other) const noexcept {
+        return reinterpret_cast<uintptr_t>(m_block) < reinterpret_cast<uintptr_t>(other.m_block);
+    }
+
+   private:
+    template <typename, typename>
+    friend class shared_ptr;
+
+    template <typename, typename>
+    friend class weak_ptr;
+
+    friend impl::shared_ptr_access;
+
+    // NOTE: adopts a reference the caller already counted
+    shared_ptr(block_type* block, element_type* ptr) noexcept
+        : m_ptr(ptr), m_block(block) {}
+
+    element_type* m_ptr{nullptr};
+    block_type* m_block{nullptr};
+};
+
+// weak_ptr https://en.cppreference.com/w/cpp/memory/weak_ptr
+// NOTE: keeps the control block, not the object, alive; after make_shared that is the memory of the object as well
+template <typename T, typename RefCount>
+class weak_ptr {
+    using block_type = impl::shared_count_block<RefCount>;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using element_type = remove_extent_t<T>;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/memory/weak_ptr/weak_ptr
+    constexpr weak_ptr() noexcept = default;
+
+    // (constructor) (2) https://en.cppreference.com/w/cpp/memory/weak_ptr/weak_ptr
+    weak_ptr(const weak_ptr& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        if (m_block != nullptr) m_block->add_weak();
+    }
+
+    // (constructor) (2) https://en.cppreference.com/w/cpp/memory/weak_ptr/weak_ptr
+    // NOTE: converts the pointer without locking, so a virtual base of an expired object is not supported
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    weak_ptr(const weak_ptr<Y, RefCount>& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        if (m_block != nullptr) m_block->add_weak();
+    }
+
+    // (constructor) (2) https://en.cppreference.com/w/cpp/memory/weak_ptr/weak_ptr
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    weak_ptr(const shared_ptr<Y, RefCount>& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        if (m_block != nullptr) m_block->add_weak();
+    }
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/memory/weak_ptr/weak_ptr
+    weak_ptr(weak_ptr&& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        r.m_ptr = nullptr;
+        r.m_block = nullptr;
+    }
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/memory/weak_ptr/weak_ptr
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    weak_ptr(weak_ptr<Y, RefCount>&& r) noexcept
+        : m_ptr(r.m_ptr), m_block(r.m_block) {
+        r.m_ptr = nullptr;
+        r.m_block = nullptr;
+    }
+
+    // (destructor) https://en.cppreference.com/w/cpp/memory/weak_ptr/~weak_ptr
+    ~weak_ptr() {
+        if (m_block != nullptr) m_block->release_weak();
+    }
+
+    // operator= (1) https://en.cppreference.com/w/cpp/memory/weak_ptr/operator%3D
+    weak_ptr& operator=(const weak_ptr& r) noexcept {
+        weak_ptr(r).swap(*this);
+        return *this;
+    }
+
+    // operator= (2) https://en.cppreference.com/w/cpp/memory/weak_ptr/operator%3D
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    weak_ptr& operator=(const weak_ptr<Y, RefCount>& r) noexcept {
+        weak_ptr(r).swap(*this);
+        return *this;
+    }
+
+    // operator= (3) https://en.cppreference.com/w/cpp/memory/weak_ptr/operator%3D
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    weak_ptr& operator=(const shared_ptr<Y, RefCount>& r) noexcept {
+        weak_ptr(r).swap(*this);
+        return *this;
+    }
+
+    // operator= (4) https://en.cppreference.com/w/cpp/memory/weak_ptr/operator%3D
+    weak_ptr& operator=(weak_ptr&& r) noexcept {
+        weak_ptr(lw_std::move(r)).swap(*this);
+        return *this;
+    }
+
+    // operator= (5) https://en.cppreference.com/w/cpp/memory/weak_ptr/operator%3D
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    weak_ptr& operator=(weak_ptr<Y, RefCount>&& r) noexcept {
+        weak_ptr(lw_std::move(r)).swap(*this);
+        return *this;
+    }
+
+    /*
+        Modifiers
+    */
+
+    // reset https://en.cppreference.com/w/cpp/memory/weak_ptr/reset
+    void reset() noexcept {
+        weak_ptr().swap(*this);
+    }
+
+    // swap https://en.cppreference.com/w/cpp/memory/weak_ptr/swap
+    void swap(weak_ptr& r) noexcept {
+        lw_std::swap(m_ptr, r.m_ptr);
+        lw_std::swap(m_block, r.m_block);
+    }
+
+    /*
+        Observers
+    */
+
+    // use_count https://en.cppreference.com/w/cpp/memory/weak_ptr/use_count
+    [[nodiscard]] long use_count() const noexcept {
+        return m_block == nullptr ? 0 : m_block->use_count();
+    }
+
+    // expired https://en.cppreference.com/w/cpp/memory/weak_ptr/expired
+    [[nodiscard]] bool expired() const noexcept {
+        return use_count() == 0;
+    }
+
+    // lock https://en.cppreference.com/w/cpp/memory/weak_ptr/lock
+    // NOTE: the count is only incremented while it is not zero, so an object that is being destroyed stays dead
+    [[nodiscard]] shared_ptr<T, RefCount> lock() const noexcept {
+        if (m_block != nullptr && m_block->add_shared_if_alive()) return shared_ptr<T, RefCount>(m_block, m_ptr);
+        return shared_ptr<T, RefCount>();
+    }
+
+    // owner_before https://en.cppreference.com/w/cpp/memory/weak_ptr/owner_before
+    template <typename Y>
+    [[nodiscard]] bool owner_before(const weak_ptr<Y, RefCount>& other) const noexcept {
+        return reinterpret_cast<uintptr_t>(m_block) < reinterpret_cast<uintptr_t>(other.m_block);
+    }
+
+    // owner_before https://en.cppreference.com/w/cpp/memory/weak_ptr/owner_before
+    template <typename Y>
+    [[nodiscard]] bool owner_before(const shared_ptr<Y, RefCount>& other) const noexcept {
+        return reinterpret_cast<uintptr_t>(m_block) < reinterpret_cast<uintptr_t>(other.m_block);
+    }
+
+   private:
+    template <typename, typename>
+    friend class shared_ptr;
+
+    template <typename, typename>
+    friend class weak_ptr;
+
+    element_type* m_ptr{nullptr};
+    block_type* m_block{nullptr};
+};
+
+namespace impl {
+
+struct shared_ptr_access {
+    // NOTE: the control block and the object in one allocation, through the allocator rebound to the block
+    template <typename T, typename RefCount, typename Allocator, typename... Args>
+    [[nodiscard]] static shared_ptr<T, RefCount> allocate(const Allocator& alloc, Args&&... args) {
+        using block = shared_inplace_block<T, Allocator, RefCount>;
+
+        typename Allocator::template rebind<block>::other block_allocator(alloc);
+        block* b = block_allocator.allocate(1);
+        block_allocator.construct(b, alloc, lw_std::forward<Args>(args)...);
+        return shared_ptr<T, RefCount>(b, b->get());
+    }
+};
+
+}  // namespace impl
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// allocate_shared (1) https://en.cppreference.com/w/cpp/memory/shared_ptr/allocate_shared
+// NOTE: RefCount is non-standard, e.g. allocate_shared<T, nonatomic_refcount>(alloc, args...)
+template <typename T, typename RefCount = default_refcount, typename Allocator, typename... Args>
+[[nodiscard]] enable_if_t<!is_array_v<T>, shared_ptr<T, RefCount>> allocate_shared(const Allocator& alloc, Args&&... args) {
+    return impl::shared_ptr_access::allocate<T, RefCount>(alloc, lw_std::forward<Args>(args)...);
+}
+
+// FIXME: allocate_shared (2-5) https://en.cppreference.com/w/cpp/memory/shared_ptr/allocate_shared
+
+// allocate_shared_for_overwrite (6) https://en.cppreference.com/w/cpp/memory/shared_ptr/allocate_shared
+template <typename T, typename RefCount = default_refcount, typename Allocator>
+[[nodiscard]] enable_if_t<!is_array_v<T>, shared_ptr<T, RefCount>> allocate_shared_for_overwrite(const Allocator& alloc) {
+    return impl::shared_ptr_access::allocate<T, RefCount>(alloc, impl::for_overwrite_tag{});
+}
+
+// FIXME: allocate_shared_for_overwrite (7) https://en.cppreference.com/w/cpp/memory/shared_ptr/allocate_shared
+
+// make_shared (1) https://en.cppreference.com/w/cpp/memory/shared_ptr/make_shared
+// NOTE: RefCount is non-standard, e.g. make_shared<T, nonatomic_refcount>(args...)
+template <typename T, typename RefCount = default_refcount, typename... Args>
+[[nodiscard]] enable_if_t<!is_array_v<T>, shared_ptr<T, RefCount>> make_shared(Args&&... args) {
+    return impl::shared_ptr_access::allocate<T, RefCount>(allocator<T>(), lw_std::forward<Args>(args)...);
+}
+
+// FIXME: make_shared (2-5) https://en.cppreference.com/w/cpp/memory/shared_ptr/make_shared
+
+// make_shared_for_overwrite (6) https://en.cppreference.com/w/cpp/memory/shared_ptr/make_shared
+template <typename T, typename RefCount = default_refcount>
+[[nodiscard]] enable_if_t<!is_array_v<T>, shared_ptr<T, RefCount>> make_shared_for_overwrite() {
+    return impl::shared_ptr_access::allocate<T, RefCount>(allocator<T>(), impl::for_overwrite_tag{});
+}
+
+// FIXME: make_shared_for_overwrite (7) https://en.cppreference.com/w/cpp/memory/shared_ptr/make_shared
+
+// static_pointer_cast https://en.cppreference.com/w/cpp/memory/shared_ptr/pointer_cast
+template <typename T, typename U, typename RefCount>
+[[nodiscard]] shared_ptr<T, RefCount> static_pointer_cast(const shared_ptr<U, RefCount>& r) noexcept {
+    return shared_ptr<T, RefCount>(r, static_cast<T*>(r.get()));
+}
+
+// dynamic_pointer_cast https://en.cppreference.com/w/cpp/memory/shared_ptr/pointer_cast
+// NOTE: needs RTTI, which embedded builds often turn off (-fno-rtti)
+template <typename T, typename U, typename RefCount>
+[[nodiscard]] shared_ptr<T, RefCount> dynamic_pointer_cast(const shared_ptr<U, RefCount>& r) noexcept {
+    if (auto* ptr = dynamic_cast<T*>(r.get())) return shared_ptr<T, RefCount>(r, ptr);
+    return shared_ptr<T, RefCount>();
+}
+
+// const_pointer_cast https://en.cppreference.com/w/cpp/memory/shared_ptr/pointer_cast
+template <typename T, typename U, typename RefCount>
+[[nodiscard]] shared_ptr<T, RefCount> const_pointer_cast(const shared_ptr<U, RefCount>& r) noexcept {
+    return shared_ptr<T, RefCount>(r, const_cast<T*>(r.get()));
+}
+
+// reinterpret_pointer_cast https://en.cppreference.com/w/cpp/memory/shared_ptr/pointer_cast
+template <typename T, typename U, typename RefCount>
+[[nodiscard]] shared_ptr<T, RefCount> reinterpret_pointer_cast(const shared_ptr<U, RefCount>& r) noexcept {
+    return shared_ptr<T, RefCount>(r, reinterpret_cast<T*>(r.get()));
+}
+
+// FIXME: get_deleter https://en.cppreference.com/w/cpp/memory/shared_ptr/get_deleter
+
+// operator== (1) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_cmp
+template <typename T, typename U, typename RefCount>
+[[nodiscard]] bool operator==(const shared_ptr<T, RefCount>& lhs, const shared_ptr<U, RefCount>& rhs) noexcept {
+    return lhs.get() == rhs.get();
+}
+
+// operator!= (2) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_cmp
+template <typename T, typename U, typename RefCount>
+[[nodiscard]] bool operator!=(const shared_ptr<T, RefCount>& lhs, const shared_ptr<U, RefCount>& rhs) noexcept {
+    return lhs.get() != rhs.get();
+}
+
+// FIXME: operator (3-7) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_cmp
+
+// operator== (8) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_cmp
+template <typename T, typename RefCount>
+[[nodiscard]] bool operator==(const shared_ptr<T, RefCount>& lhs, decltype(nullptr)) noexcept {
+    return !lhs;
+}
+
+// operator== (9) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_cmp
+template <typename T, typename RefCount>
+[[nodiscard]] bool operator==(decltype(nullptr), const shared_ptr<T, RefCount>& rhs) noexcept {
+    return !rhs;
+}
+
+// operator!= (10) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_cmp
+template <typename T, typename RefCount>
+[[nodiscard]] bool operator!=(const shared_ptr<T, RefCount>& lhs, decltype(nullptr)) noexcept {
+    return static_cast<bool>(lhs);
+}
+
+// operator!= (11) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_cmp
+template <typename T, typename RefCount>
+[[nodiscard]] bool operator!=(decltype(nullptr), const shared_ptr<T, RefCount>& rhs) noexcept {
+    return static_cast<bool>(rhs);
+}
+
+// FIXME: operator (12-20) https://en.cppreference.com/w/cpp/memory/shared_ptr/operator_cmp
+
+// swap https://en.cppreference.com/w/cpp/memory/shared_ptr/swap2
+template <typename T, typename RefCount>
+void swap(shared_ptr<T, RefCount>& lhs, shared_ptr<T, RefCount>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// swap https://en.cppreference.com/w/cpp/memory/weak_ptr/swap2
+template <typename T, typename RefCount>
+void swap(weak_ptr<T, RefCount>& lhs, weak_ptr<T, RefCount>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace lw_std
\ No newline at end of file
@@ -1,14 +1,117 @@
 #pragma once
 
+#include "../type_traits.hpp"
+#include "allocator.hpp"
 #include "move.hpp"
 
 namespace lw_std {
 
-// FIXME: unique_ptr https://en.cppreference.com/w/cpp/memory/unique_ptr
-template <typename T>
-class unique_ptr {
+namespace impl {
+
+// NOTE: holds a T, as an empty base when T is an empty class, so stateless deleters and allocators take no space
+template <typename T, bool = is_empty_v<T> && !is_final_v<T>>
+class ebo_holder {
+   public:
+    constexpr ebo_holder() = default;
+
+    constexpr explicit ebo_holder(const T& value)
+        : m_value(value) {}
+
+    constexpr explicit ebo_holder(T&& value)
+        : m_value(lw_std::move(value)) {}
+
+    [[nodiscard]] constexpr T& held() noexcept {
+        return m_value;
+    }
+
+    [[nodiscard]] constexpr const T& held() const noexcept {
+        return m_value;
+    }
+
    private:
-    T* m_ptr{nullptr};
+    T m_value{};
+};
+
+template <typename T>
+class ebo_holder<T, true> : private T {
+   public:
+    constexpr ebo_holder() = default;
+
+    constexpr explicit ebo_holder(const T& value)
+        : T(value) {}
+
+    constexpr explicit ebo_holder(T&& value)
+        : T(lw_std::move(value)) {}
+
+    [[nodiscard]] constexpr T& held() noexcept {
+        return *this;
+    }
+
+    [[nodiscard]] constexpr const T& held() const noexcept {
+        return *this;
+    }
+};
+
+}  // namespace impl
+
+// default_delete https://en.cppreference.com/w/cpp/memory/default_delete
+template <typename T>
+struct default_delete {
+    constexpr default_delete() noexcept = default;
+
+    // NOTE: from the deleter of a derived class
+    template <typename U, typename = enable_if_t<is_base_of_v<T, U>>>
+    constexpr default_delete(const default_delete<U>&) noexcept {}
+
+    constexpr void operator()(T* ptr) const {
+        static_assert(sizeof(T) > 0, "default_delete: can't delete an incomplete type");
+        delete ptr;
+    }
+};
+
+// default_delete https://en.cppreference.com/w/cpp/memory/default_delete
+template <typename T>
+struct default_delete<T[]> {
+    constexpr default_delete() noexcept = default;
+
+    constexpr void operator()(T* ptr) const {
+        static_assert(sizeof(T) > 0, "default_delete: can't delete an incomplete type");
+        delete[] ptr;
+    }
+};
+
+// NOTE: non-standard (proposed for std as part of allocate_unique), destroys and deallocates one element
+//       through a copy of the allocator, which is an empty base of unique_ptr for stateless allocators
+template <typename Allocator>
+class allocator_delete : private impl::ebo_holder<Allocator> {
+    using allocator_holder = impl::ebo_holder<Allocator>;
+
+   public:
+    using allocator_type = Allocator;
+    using pointer = typename Allocator::value_type*;
+
+    constexpr allocator_delete() = default;
+
+    constexpr explicit allocator_delete(const allocator_type& alloc)
+        : allocator_holder(alloc) {}
+
+    [[nodiscard]] constexpr allocator_type get_allocator() const {
+        return allocator_holder::held();
+    }
+
+    constexpr void operator()(pointer ptr) {
+        allocator_holder::held().destroy(ptr);
+        allocator_holder::held().deallocate(ptr, 1);
+    }
+};
+
+// unique_ptr https://en.cppreference.com/w/cpp/memory/unique_ptr
+// NOTE: the deleter is an empty base when it is an empty class (default_delete, allocator_delete of a stateless
+//       allocator), so those unique_ptrs are the size of a pointer
+// FIXME: Deleter::pointer and reference deleters
+template <typename T, typename Deleter = default_delete<T>>
+class unique_ptr : private impl::ebo_holder<Deleter> {
+    using deleter_holder = impl::ebo_holder<Deleter>;
 
    public:
     /*
@@ -17,54 +120,71 @@ class unique_ptr {
 
     using pointer = T*;
     using element_type = T;
+    using deleter_type = Deleter;
 
     /*
         MEMBER FUNCTIONS
     */
 
-    // FIXME: (constructor) (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    // (constructor) (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
     constexpr unique_ptr() noexcept = default;
 
+    // (constructor) (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr unique_ptr(decltype(nullptr)) noexcept {}
+
     // (constructor) (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
     constexpr explicit unique_ptr(pointer p) noexcept
         : m_ptr(p) {}
 
-    // FIXME: (constructor) (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
-    // FIXME: (constructor) (4) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    // (constructor) (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr unique_ptr(pointer p, const deleter_type& d) noexcept
+        : deleter_holder(d), m_ptr(p) {}
+
+    // (constructor) (4) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr unique_ptr(pointer p, deleter_type&& d) noexcept
+        : deleter_holder(lw_std::move(d)), m_ptr(p) {}
 
     // (constructor) (5) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
-    constexpr unique_ptr(unique_ptr&& other) noexcept {
-        operator=(lw_std::move(other));
-    }
+    constexpr unique_ptr(unique_ptr&& other) noexcept
+        : deleter_holder(lw_std::move(other.get_deleter())), m_ptr(other.release()) {}
 
-    // FIXME: (constructor) (6) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
-    template <typename U>
-    constexpr unique_ptr(unique_ptr<U>&& u) noexcept
-        : m_ptr(u.m_ptr) {}
+    // (constructor) (6) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    // NOTE: from a unique_ptr to a derived class, whose deleter converts to deleter_type
+    template <typename U, typename E, typename = enable_if_t<!is_array_v<U> && is_base_of_v<T, U>>>
+    constexpr unique_ptr(unique_ptr<U, E>&& u) noexcept
+        : deleter_holder(Deleter(lw_std::move(u.get_deleter()))), m_ptr(u.release()) {}
+
+    unique_ptr(const unique_ptr&) = delete;
 
     // (destructor) https://en.cppreference.com/w/cpp/memory/unique_ptr/~unique_ptr
     ~unique_ptr() {
-        if (m_ptr) {
-            delete m_ptr;
-            m_ptr = nullptr;
-        };
+        if (m_ptr != nullptr) get_deleter()(m_ptr);
     }
 
     // operator= (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator%3D
     constexpr unique_ptr& operator=(unique_ptr&& r) noexcept {
         if (this != &r) {
             reset(r.release());
+            get_deleter() = lw_std::move(r.get_deleter());
         }
         return *this;
     }
 
-    // FIXME: operator= (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator%3D
-    template <typename U>
-    constexpr unique_ptr& operator=(unique_ptr<U>&& r) noexcept {
-        return operator=(r);
+    // operator= (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator%3D
+    template <typename U, typename E, typename = enable_if_t<!is_array_v<U> && is_base_of_v<T, U>>>
+    constexpr unique_ptr& operator=(unique_ptr<U, E>&& r) noexcept {
+        reset(r.release());
+        get_deleter() = Deleter(lw_std::move(r.get_deleter()));
+        return *this;
     }
 
-    // FIXME: operator= (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator%3D
+    // operator= (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator%3D
+    constexpr unique_ptr& operator=(decltype(nullptr)) noexcept {
+        reset();
+        return *this;
+    }
+
+    unique_ptr& operator=(const unique_ptr&) = delete;
 
     /*
         Modifiers
@@ -78,19 +198,19 @@ class unique_ptr {
     }
 
     // reset (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/reset
+    // NOTE: like std, the pointer is replaced before the old one is deleted
     constexpr void reset(pointer ptr = pointer()) noexcept {
-        if (m_ptr) delete m_ptr;
+        pointer old = m_ptr;
         m_ptr = ptr;
+        if (old != nullptr) get_deleter()(old);
     }
 
-    // reset (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/reset
-    template <typename U>
-    constexpr void reset(U ptr) noexcept {
-        operator=(ptr);
+    // swap https://en.cppreference.com/w/cpp/memory/unique_ptr/swap
+    constexpr void swap(unique_ptr& other) noexcept {
+        lw_std::swap(m_ptr, other.m_ptr);
+        lw_std::swap(get_deleter(), other.get_deleter());
     }
 
-    // FIXME: reset (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/reset
-
     /*
         Observers
     */
@@ -100,14 +220,22 @@ class unique_ptr {
         return m_ptr;
     }
 
-    // FIXME: get_deleter https://en.cppreference.com/w/cpp/memory/unique_ptr/get_deleter
+    // get_deleter https://en.cppreference.com/w/cpp/memory/unique_ptr/get_deleter
+    [[nodiscard]] constexpr deleter_type& get_deleter() noexcept {
+        return deleter_holder::held();
+    }
+
+    // get_deleter https://en.cppreference.com/w/cpp/memory/unique_ptr/get_deleter
+    [[nodiscard]] constexpr const deleter_type& get_deleter() const noexcept {
+        return deleter_holder::held();
+    }
 
     // operator bool https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_bool
-    [[nodiscard]] constexpr operator bool() const noexcept {
+    [[nodiscard]] constexpr explicit operator bool() const noexcept {
         return m_ptr != nullptr;
     }
 
-    // FIXME: operator* (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator*
+    // operator* (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator*
     [[nodiscard]] constexpr T& operator*() const noexcept {
         return *m_ptr;
     }
@@ -116,6 +244,136 @@ class unique_ptr {
     [[nodiscard]] constexpr pointer operator->() const noexcept {
         return m_ptr;
     }
+
+   private:
+    pointer m_ptr{nullptr};
+};
+
+// unique_ptr https://en.cppreference.com/w/cpp/memory/unique_ptr
+// NOTE: owns an array, which is deleted with delete[] by default
+template <typename T, typename Deleter>
+class unique_ptr<T[], Deleter> : private impl::ebo_holder<Deleter> {
+    using deleter_holder = impl::ebo_holder<Deleter>;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using pointer = T*;
+    using element_type = T;
+    using deleter_type = Deleter;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr unique_ptr() noexcept = default;
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr unique_ptr(decltype(nullptr)) noexcept {}
+
+    // (constructor) (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr explicit unique_ptr(pointer p) noexcept
+        : m_ptr(p) {}
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr unique_ptr(pointer p, const deleter_type& d) noexcept
+        : deleter_holder(d), m_ptr(p) {}
+
+    // (constructor) (4) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr unique_ptr(pointer p, deleter_type&& d) noexcept
+        : deleter_holder(lw_std::move(d)), m_ptr(p) {}
+
+    // (constructor) (5) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+    constexpr unique_ptr(unique_ptr&& other) noexcept
+        : deleter_holder(lw_std::move(other.get_deleter())), m_ptr(other.release()) {}
+
+    // FIXME: (constructor) (6) https://en.cppreference.com/w/cpp/memory/unique_ptr/unique_ptr
+
+    unique_ptr(const unique_ptr&) = delete;
+
+    // (destructor) https://en.cppreference.com/w/cpp/memory/unique_ptr/~unique_ptr
+    ~unique_ptr() {
+        if (m_ptr != nullptr) get_deleter()(m_ptr);
+    }
+
+    // operator= (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator%3D
+    constexpr unique_ptr& operator=(unique_ptr&& r) noexcept {
+        if (this != &r) {
+            reset(r.release());
+            get_deleter() = lw_std::move(r.get_deleter());
+        }
+        return *this;
+    }
+
+    // FIXME: operator= (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator%3D
+
+    // operator= (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator%3D
+    constexpr unique_ptr& operator=(decltype(nullptr)) noexcept {
+        reset();
+        return *this;
+    }
+
+    unique_ptr& operator=(const unique_ptr&) = delete;
+
+    /*
+        Modifiers
+    */
+
+    // release https://en.cppreference.com/w/cpp/memory/unique_ptr/release
+    [[nodiscard]] constexpr pointer release() noexcept {
+        auto tmp = m_ptr;
+        m_ptr = nullptr;
+        return tmp;
+    }
+
+    // reset (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/reset
+    // NOTE: T* only, not the pointers to qualified T the standard accepts too
+    constexpr void reset(pointer ptr = pointer()) noexcept {
+        pointer old = m_ptr;
+        m_ptr = ptr;
+        if (old != nullptr) get_deleter()(old);
+    }
+
+    // swap https://en.cppreference.com/w/cpp/memory/unique_ptr/swap
+    constexpr void swap(unique_ptr& other) noexcept {
+        lw_std::swap(m_ptr, other.m_ptr);
+        lw_std::swap(get_deleter(), other.get_deleter());
+    }
+
+    /*
+        Observers
+    */
+
+    // get https://en.cppreference.com/w/cpp/memory/unique_ptr/get
+    [[nodiscard]] constexpr pointer get() const noexcept {
+        return m_ptr;
+    }
+
+    // get_deleter https://en.cppreference.com/w/cpp/memory/unique_ptr/get_deleter
+    [[nodiscard]] constexpr deleter_type& get_deleter() noexcept {
+        return deleter_holder::held();
+    }
+
+    // get_deleter https://en.cppreference.com/w/cpp/memory/unique_ptr/get_deleter
+    [[nodiscard]] constexpr const deleter_type& get_deleter() const noexcept {
+        return deleter_holder::held();
+    }
+
+    // operator bool https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_bool
+    [[nodiscard]] constexpr explicit operator bool() const noexcept {
+        return m_ptr != nullptr;
+    }
+
+    // operator[] https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_at
+    [[nodiscard]] constexpr T& operator[](size_t i) const {
+        return m_ptr[i];
+    }
+
+   private:
+    pointer m_ptr{nullptr};
 };
 
 /*
@@ -124,32 +382,60 @@ class unique_ptr {
 
 // make_unique (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
 template <typename T, typename... Args>
-[[nodiscard]] constexpr unique_ptr<T> make_unique(Args&&... args) {
+[[nodiscard]] constexpr enable_if_t<!is_array_v<T>, unique_ptr<T>> make_unique(Args&&... args) {
     return unique_ptr<T>{new T{lw_std::forward<Args>(args)...}};
 }
 
-// FIXME: make_unique (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
-// FIXME: make_unique (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
+// make_unique (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
+// NOTE: the elements are value initialized
+template <typename T>
+[[nodiscard]] constexpr enable_if_t<is_same_v<T, remove_extent_t<T>[]>, unique_ptr<T>> make_unique(size_t size) {
+    return unique_ptr<T>{new remove_extent_t<T>[size]()};
+}
+
+// make_unique (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
+template <typename T, typename... Args>
+enable_if_t<is_array_v<T> && !is_same_v<T, remove_extent_t<T>[]>> make_unique(Args&&... args) = delete;
 
-// make_unique_for_overwrite (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
+// make_unique_for_overwrite (4) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
 template <typename T>
-[[nodiscard]] constexpr unique_ptr<T> make_unique_for_overwrite() {
+[[nodiscard]] constexpr enable_if_t<!is_array_v<T>, unique_ptr<T>> make_unique_for_overwrite() {
     return unique_ptr<T>{new T{}};
 }
 
-// FIXME: make_unique (5) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
-// FIXME: make_unique (6) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
+// make_unique_for_overwrite (5) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
+// NOTE: the elements are default initialized, which leaves trivial types uninitialized
+template <typename T>
+[[nodiscard]] constexpr enable_if_t<is_same_v<T, remove_extent_t<T>[]>, unique_ptr<T>> make_unique_for_overwrite(size_t size) {
+    return unique_ptr<T>{new remove_extent_t<T>[size]};
+}
+
+// FIXME: make_unique_for_overwrite (6) https://en.cppreference.com/w/cpp/memory/unique_ptr/make_unique
+
+// NOTE: non-standard (proposed for std), make_unique through an allocator (rebound to T), e.g. a pool allocator;
+//       the object is freed by the allocator_delete which holds a copy of it
+// FIXME: arrays
+template <typename T, typename Allocator, typename... Args>
+[[nodiscard]] constexpr enable_if_t<!is_array_v<T>, unique_ptr<T, allocator_delete<typename Allocator::template rebind<T>::other>>>
+allocate_unique(const Allocator& alloc, Args&&... args) {
+    using allocator_type = typename Allocator::template rebind<T>::other;
+
+    allocator_type rebound(alloc);
+    T* ptr = rebound.allocate(1);
+    rebound.construct(ptr, lw_std::forward<Args>(args)...);
+    return unique_ptr<T, allocator_delete<allocator_type>>(ptr, allocator_delete<allocator_type>(rebound));
+}
 
 // operator== (1) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
-template <typename T1, typename T2>
-[[nodiscard]] constexpr bool operator==(const unique_ptr<T1>& x, const unique_ptr<T1>& y) {
+template <typename T1, typename D1, typename T2, typename D2>
+[[nodiscard]] constexpr bool operator==(const unique_ptr<T1, D1>& x, const unique_ptr<T2, D2>& y) {
     return x.get() == y.get();
 }
 
 // operator!= (2) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
-template <typename T1, typename T2>
-[[nodiscard]] constexpr bool operator!=(const unique_ptr<T1>& x, const unique_ptr<T1>& y) {
-    return !operator==(x, y);
+template <typename T1, typename D1, typename T2, typename D2>
+[[nodiscard]] constexpr bool operator!=(const unique_ptr<T1, D1>& x, const unique_ptr<T2, D2>& y) {
+    return x.get() != y.get();
 }
 
 // FIXME: operator< (3) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
@@ -157,6 +443,37 @@ template <typename T1, typename T2>
 // FIXME: operator> (5) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cm
 // FIXME: operator> (6) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
 // FIXME: operator<=> (7) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
-// FIXME: operator (8-20) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
+
+// operator== (8) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
+template <typename T, typename D>
+[[nodiscard]] constexpr bool operator==(const unique_ptr<T, D>& x, decltype(nullptr)) noexcept {
+    return !x;
+}
+
+// operator== (9) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
+template <typename T, typename D>
+[[nodiscard]] constexpr bool operator==(decltype(nullptr), const unique_ptr<T, D>& x) noexcept {
+    return !x;
+}
+
+// operator!= (10) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
+template <typename T, typename D>
+[[nodiscard]] constexpr bool operator!=(const unique_ptr<T, D>& x, decltype(nullptr)) noexcept {
+    return static_cast<bool>(x);
+}
+
+// operator!= (11) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
+template <typename T, typename D>
+[[nodiscard]] constexpr bool operator!=(decltype(nullptr), const unique_ptr<T, D>& x) noexcept {
+    return static_cast<bool>(x);
+}
+
+// FIXME: operator (12-20) https://en.cppreference.com/w/cpp/memory/unique_ptr/operator_cmp
+
+// swap https://en.cppreference.com/w/cpp/memory/unique_ptr/swap2
+template <typename T, typename D>
+constexpr void swap(unique_ptr<T, D>& lhs, unique_ptr<T, D>& rhs) noexcept {
+    lhs.swap(rhs);
+}
 
 }  // namespace lw_std
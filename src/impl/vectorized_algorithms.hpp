@@ -0,0 +1,432 @@
+#pragma once
+
+#ifdef ARDUINO
+#    include <string.h>
+#else
+#    include <cstring>
+#endif
+
+#include "../bit.hpp"
+#include "../type_traits.hpp"
+#include "../utility.hpp"
+
+// NOTE: the instruction set is picked at compile time (e.g. -mavx2), there is no runtime cpu detection;
+//       define LWSTD_DISABLE_SIMD to only use the memchr/memcmp and scalar paths
+#ifndef LWSTD_DISABLE_SIMD
+#    if defined(__AVX2__)
+#        define LWSTD_SIMD_AVX2
+#        include <immintrin.h>
+#    elif defined(__SSE2__)
+#        define LWSTD_SIMD_SSE2
+#        include <emmintrin.h>
+#    elif defined(__ARM_NEON) && defined(__aarch64__)
+#        define LWSTD_SIMD_NEON
+#        include <arm_neon.h>
+#    endif
+#endif
+
+namespace lw_std {
+
+// NOTE: non-standard, types whose operator== compares the object representation,
+//       ranges of these can be compared as raw bytes
+template <typename T>
+struct is_bitwise_comparable : bool_constant<is_integral_v<T> || is_pointer_v<T>> {};
+
+template <typename T>
+inline constexpr bool is_bitwise_comparable_v = is_bitwise_comparable<T>::value;
+
+// NOTE: non-standard, searching a range of It for a T can use the kernels below
+template <typename It, typename T>
+inline constexpr bool is_vectorizable_search_v = is_pointer_v<It> && is_same_v<remove_cv_t<remove_pointer_t<It>>, T> && is_bitwise_comparable_v<T>;
+
+// NOTE: non-standard, comparing a range of It1 to a range of It2 can use the kernels below
+template <typename It1, typename It2>
+inline constexpr bool is_vectorizable_compare_v = is_pointer_v<It1> && is_pointer_v<It2> &&
+                                                  is_same_v<remove_cv_t<remove_pointer_t<It1>>, remove_cv_t<remove_pointer_t<It2>>> &&
+                                                  is_bitwise_comparable_v<remove_cv_t<remove_pointer_t<It1>>>;
+
+// NOTE: non-standard, the operation of vectorized_bitwise
+enum class bitwise_op {
+    bit_and,
+    bit_or,
+    bit_xor
+};
+
+// NOTE: non-standard, compares register sized blocks of elements, element_size bytes each;
+//       equal_mask has the bits of all bytes of equal elements set, bits_per_byte bits per byte
+struct simd_block {
+#if defined(LWSTD_SIMD_AVX2)
+    typedef __m256i vector_t;
+    typedef uint32_t mask_t;
+    static constexpr size_t size = 32;
+    static constexpr int bits_per_byte = 1;
+#elif defined(LWSTD_SIMD_SSE2)
+    typedef __m128i vector_t;
+    typedef uint32_t mask_t;
+    static constexpr size_t size = 16;
+    static constexpr int bits_per_byte = 1;
+#elif defined(LWSTD_SIMD_NEON)
+    typedef uint8x16_t vector_t;
+    typedef uint64_t mask_t;
+    static constexpr size_t size = 16;
+    static constexpr int bits_per_byte = 4;
+#else
+    typedef unsigned char vector_t;
+    typedef uint32_t mask_t;
+    static constexpr size_t size = 0;
+    static constexpr int bits_per_byte = 1;
+#endif
+
+    static constexpr mask_t all_equal = size * bits_per_byte >= sizeof(mask_t) * 8 ? ~mask_t{0} : (mask_t{1} << (size * bits_per_byte)) - 1;
+
+    // NOTE: a byte counter overflows after this many blocks
+    static constexpr size_t max_count_blocks = 255;
+
+    template <size_t element_size>
+    [[nodiscard]] static mask_t equal_mask(const void* a, const void* b) {
+        return to_mask(equal_lanes<element_size>(load(a), load(b)));
+    }
+
+    // NOTE: number of bytes of all equal elements in block_count (<= max_count_blocks) consecutive blocks from first
+    template <size_t element_size>
+    [[nodiscard]] static size_t equal_byte_count(const void* first, size_t block_count, const void* needle) {
+        const auto* bytes = static_cast<const unsigned char*>(first);
+        vector_t needle_block = load(needle);
+        vector_t counters = zero();
+
+        // NOTE: the bytes of equal lanes are all ones (-1), subtracting them counts up every byte
+        for (size_t i = 0; i < block_count; ++i, bytes += size)
+            counters = subtract_bytes(counters, equal_lanes<element_size>(load(bytes), needle_block));
+
+        return sum_bytes(counters);
+    }
+
+    // NOTE: *dst = *dst op *src on one block
+    template <bitwise_op op>
+    static void apply_bitwise(void* dst, const void* src) {
+        store(dst, bitwise<op>(load(dst), load(src)));
+    }
+
+    template <typename T>
+    [[nodiscard]] static constexpr size_t element_index(mask_t mask) {
+        return static_cast<size_t>(countr_zero(mask)) / (sizeof(T) * bits_per_byte);
+    }
+
+   private:
+#if defined(LWSTD_SIMD_AVX2)
+    [[nodiscard]] static vector_t load(const void* p) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    }
+
+    static void store(void* p, vector_t x) {
+        _mm256_storeu_si256(static_cast<__m256i*>(p), x);
+    }
+
+    [[nodiscard]] static vector_t zero() {
+        return _mm256_setzero_si256();
+    }
+
+    template <bitwise_op op>
+    [[nodiscard]] static vector_t bitwise(vector_t x, vector_t y) {
+        if constexpr (op == bitwise_op::bit_and)
+            return _mm256_and_si256(x, y);
+        else if constexpr (op == bitwise_op::bit_or)
+            return _mm256_or_si256(x, y);
+        else
+            return _mm256_xor_si256(x, y);
+    }
+
+    template <size_t element_size>
+    [[nodiscard]] static vector_t equal_lanes(vector_t x, vector_t y) {
+        if constexpr (element_size == 1)
+            return _mm256_cmpeq_epi8(x, y);
+        else if constexpr (element_size == 2)
+            return _mm256_cmpeq_epi16(x, y);
+        else if constexpr (element_size == 4)
+            return _mm256_cmpeq_epi32(x, y);
+        else
+            return _mm256_cmpeq_epi64(x, y);
+    }
+
+    [[nodiscard]] static mask_t to_mask(vector_t eq) {
+        return static_cast<mask_t>(_mm256_movemask_epi8(eq));
+    }
+
+    [[nodiscard]] static vector_t subtract_bytes(vector_t x, vector_t y) {
+        return _mm256_sub_epi8(x, y);
+    }
+
+    [[nodiscard]] static size_t sum_bytes(vector_t x) {
+        // NOTE: sad leaves one sum per 64-bit lane, each fits into the low 32 bits
+        __m256i sums = _mm256_sad_epu8(x, zero());
+        __m128i half_sums = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+        return static_cast<size_t>(_mm_cvtsi128_si32(half_sums) + _mm_cvtsi128_si32(_mm_srli_si128(half_sums, 8)));
+    }
+#elif defined(LWSTD_SIMD_SSE2)
+    [[nodiscard]] static vector_t load(const void* p) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+
+    static void store(void* p, vector_t x) {
+        _mm_storeu_si128(static_cast<__m128i*>(p), x);
+    }
+
+    [[nodiscard]] static vector_t zero() {
+        return _mm_setzero_si128();
+    }
+
+    template <bitwise_op op>
+    [[nodiscard]] static vector_t bitwise(vector_t x, vector_t y) {
+        if constexpr (op == bitwise_op::bit_and)
+            return _mm_and_si128(x, y);
+        else if constexpr (op == bitwise_op::bit_or)
+            return _mm_or_si128(x, y);
+        else
+            return _mm_xor_si128(x, y);
+    }
+
+    template <size_t element_size>
+    [[nodiscard]] static vector_t equal_lanes(vector_t x, vector_t y) {
+        if constexpr (element_size == 1) {
+            return _mm_cmpeq_epi8(x, y);
+        } else if constexpr (element_size == 2) {
+            return _mm_cmpeq_epi16(x, y);
+        } else if constexpr (element_size == 4) {
+            return _mm_cmpeq_epi32(x, y);
+        } else {
+            // NOTE: SSE2 has no 64-bit compare, both 32-bit halves have to be equal
+            __m128i eq32 = _mm_cmpeq_epi32(x, y);
+            return _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, 0b10'11'00'01));
+        }
+    }
+
+    [[nodiscard]] static mask_t to_mask(vector_t eq) {
+        return static_cast<mask_t>(_mm_movemask_epi8(eq));
+    }
+
+    [[nodiscard]] static vector_t subtract_bytes(vector_t x, vector_t y) {
+        return _mm_sub_epi8(x, y);
+    }
+
+    [[nodiscard]] static size_t sum_bytes(vector_t x) {
+        // NOTE: sad leaves one sum per 64-bit lane, each fits into the low 32 bits
+        __m128i sums = _mm_sad_epu8(x, zero());
+        return static_cast<size_t>(_mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+    }
+#elif defined(LWSTD_SIMD_NEON)
+    [[nodiscard]] static vector_t load(const void* p) {
+        return vld1q_u8(static_cast<const uint8_t*>(p));
+    }
+
+    static void store(void* p, vector_t x) {
+        vst1q_u8(static_cast<uint8_t*>(p), x);
+    }
+
+    [[nodiscard]] static vector_t zero() {
+        return vdupq_n_u8(0);
+    }
+
+    template <bitwise_op op>
+    [[nodiscard]] static vector_t bitwise(vector_t x, vector_t y) {
+        if constexpr (op == bitwise_op::bit_and)
+            return vandq_u8(x, y);
+        else if constexpr (op == bitwise_op::bit_or)
+            return vorrq_u8(x, y);
+        else
+            return veorq_u8(x, y);
+    }
+
+    template <size_t element_size>
+    [[nodiscard]] static vector_t equal_lanes(vector_t x, vector_t y) {
+        if constexpr (element_size == 1)
+            return vceqq_u8(x, y);
+        else if constexpr (element_size == 2)
+            return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(x), vreinterpretq_u16_u8(y)));
+        else if constexpr (element_size == 4)
+            return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(x), vreinterpretq_u32_u8(y)));
+        else
+            return vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(x), vreinterpretq_u64_u8(y)));
+    }
+
+    [[nodiscard]] static mask_t to_mask(vector_t eq) {
+        // NOTE: there is no movemask on NEON, narrowing each 16-bit lane by 4 leaves 4 bits per byte
+        return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    }
+
+    [[nodiscard]] static vector_t subtract_bytes(vector_t x, vector_t y) {
+        return vsubq_u8(x, y);
+    }
+
+    [[nodiscard]] static size_t sum_bytes(vector_t x) {
+        return vaddlvq_u8(x);
+    }
+#else
+    // NOTE: no vector unit, never called (size is 0), only here so the kernels compile
+    [[nodiscard]] static vector_t load(const void*) {
+        return 0;
+    }
+
+    static void store(void*, vector_t) {}
+
+    [[nodiscard]] static vector_t zero() {
+        return 0;
+    }
+
+    template <bitwise_op>
+    [[nodiscard]] static vector_t bitwise(vector_t x, vector_t) {
+        return x;
+    }
+
+    template <size_t element_size>
+    [[nodiscard]] static vector_t equal_lanes(vector_t, vector_t) {
+        return 0;
+    }
+
+    [[nodiscard]] static mask_t to_mask(vector_t) {
+        return all_equal;
+    }
+
+    [[nodiscard]] static vector_t subtract_bytes(vector_t x, vector_t) {
+        return x;
+    }
+
+    [[nodiscard]] static size_t sum_bytes(vector_t) {
+        return 0;
+    }
+#endif
+};
+
+// NOTE: non-standard, find on a contiguous range of bitwise comparable elements
+template <typename T>
+[[nodiscard]] inline const T* vectorized_find(const T* first, const T* last, const T& value) {
+    auto count = static_cast<size_t>(last - first);
+    if (count == 0) return last;
+
+    if constexpr (sizeof(T) == 1) {
+        const void* res = memchr(first, static_cast<int>(value), count);
+        return res != nullptr ? static_cast<const T*>(res) : last;
+    } else {
+        if constexpr (simd_block::size != 0) {
+            constexpr size_t block_count = simd_block::size / sizeof(T);
+
+            T needle[block_count];
+            for (auto& element : needle)
+                element = value;
+
+            for (; static_cast<size_t>(last - first) >= block_count; first += block_count) {
+                auto mask = simd_block::equal_mask<sizeof(T)>(first, needle);
+                if (mask != 0)
+                    return first + simd_block::element_index<T>(mask);
+            }
+        }
+
+        for (; first != last; ++first)
+            if (*first == value)
+                return first;
+
+        return last;
+    }
+}
+
+// NOTE: non-standard, count on a contiguous range of bitwise comparable elements
+template <typename T>
+[[nodiscard]] inline ptrdiff_t vectorized_count(const T* first, const T* last, const T& value) {
+    size_t res = 0;
+
+    if constexpr (simd_block::size != 0) {
+        constexpr size_t block_count = simd_block::size / sizeof(T);
+
+        T needle[block_count];
+        for (auto& element : needle)
+            element = value;
+
+        size_t equal_bytes = 0;
+        while (static_cast<size_t>(last - first) >= block_count) {
+            auto blocks = static_cast<size_t>(last - first) / block_count;
+            if (blocks > simd_block::max_count_blocks) blocks = simd_block::max_count_blocks;
+
+            equal_bytes += simd_block::equal_byte_count<sizeof(T)>(first, blocks, needle);
+            first += blocks * block_count;
+        }
+        res = equal_bytes / sizeof(T);
+    }
+
+    for (; first != last; ++first)
+        if (*first == value)
+            ++res;
+
+    return static_cast<ptrdiff_t>(res);
+}
+
+// NOTE: non-standard, index of the first element that differs in two contiguous ranges of count bitwise comparable elements,
+//       count if there is none
+template <typename T>
+[[nodiscard]] inline size_t vectorized_mismatch(const T* a, const T* b, size_t count) {
+    size_t i = 0;
+
+    if constexpr (simd_block::size != 0) {
+        constexpr size_t block_count = simd_block::size / sizeof(T);
+
+        for (; count - i >= block_count; i += block_count) {
+            auto mask = simd_block::equal_mask<sizeof(T)>(a + i, b + i);
+            if (mask != simd_block::all_equal)
+                return i + simd_block::element_index<T>(~mask);
+        }
+    }
+
+    for (; i != count; ++i)
+        if (!(a[i] == b[i]))
+            return i;
+
+    return count;
+}
+
+// NOTE: non-standard, equal on two contiguous ranges of count bitwise comparable elements
+template <typename T>
+[[nodiscard]] inline bool vectorized_equal(const T* a, const T* b, size_t count) {
+    return count == 0 || memcmp(a, b, count * sizeof(T)) == 0;
+}
+
+// NOTE: non-standard, three-way lexicographical compare of two contiguous ranges of bitwise comparable elements
+template <typename T>
+[[nodiscard]] inline int vectorized_compare_three_way(const T* a, size_t count_a, const T* b, size_t count_b) {
+    auto common = count_a < count_b ? count_a : count_b;
+
+    if constexpr (is_same_v<T, unsigned char>) {
+        // NOTE: memcmp compares unsigned chars, so only for those its result is also the element order
+        if (common != 0)
+            if (int res = memcmp(a, b, common); res != 0)
+                return res;
+    } else {
+        auto i = vectorized_mismatch(a, b, common);
+        if (i != common)
+            return a[i] < b[i] ? -1 : 1;
+    }
+
+    if (count_a == count_b) return 0;
+    return count_a < count_b ? -1 : 1;
+}
+
+// NOTE: non-standard, dst[i] = dst[i] op src[i] for count integers (e.g. the blocks of two bitsets), dst and src may be the same
+template <bitwise_op op, typename T>
+inline void vectorized_bitwise(T* dst, const T* src, size_t count) {
+    size_t i = 0;
+
+    if constexpr (simd_block::size != 0) {
+        constexpr size_t block_count = simd_block::size / sizeof(T);
+
+        for (; count - i >= block_count; i += block_count)
+            simd_block::apply_bitwise<op>(dst + i, src + i);
+    }
+
+    for (; i != count; ++i) {
+        if constexpr (op == bitwise_op::bit_and)
+            dst[i] &= src[i];
+        else if constexpr (op == bitwise_op::bit_or)
+            dst[i] |= src[i];
+        else
+            dst[i] ^= src[i];
+    }
+}
+
+}  // namespace lw_std
@@ -0,0 +1,350 @@
+// intrusive_list header (non-standard)
+#pragma once
+
+#include "impl/iterator.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+template <typename Tag>
+class intrusive_list_hook;
+
+template <typename T, typename Tag>
+class intrusive_list;
+
+// NOTE: non-standard, the links of an element of an intrusive_list, a base class of the element itself;
+//       an element can unlink itself from whatever list it is in (also done by the destructor), so no node
+//       is ever allocated and the element does not have to know its list; an element that is in several lists
+//       at once derives from one hook per list, told apart by Tag
+template <typename Tag = void>
+class intrusive_list_hook {
+   public:
+    constexpr intrusive_list_hook() = default;
+
+    // NOTE: a copy is a new, unlinked element, the links belong to the list the original is in
+    constexpr intrusive_list_hook(const intrusive_list_hook&) noexcept {}
+
+    constexpr intrusive_list_hook& operator=(const intrusive_list_hook&) noexcept {
+        return *this;
+    }
+
+    ~intrusive_list_hook() {
+        unlink();
+    }
+
+    [[nodiscard]] constexpr bool is_linked() const noexcept {
+        return m_next != nullptr;
+    }
+
+    constexpr void unlink() noexcept {
+        if (is_linked()) {
+            m_prev->m_next = m_next;
+            m_next->m_prev = m_prev;
+            m_prev = m_next = nullptr;
+        }
+    }
+
+   private:
+    template <typename T, typename ListTag>
+    friend class intrusive_list;
+
+    intrusive_list_hook* m_prev{nullptr};
+    intrusive_list_hook* m_next{nullptr};
+
+    constexpr void link_before(intrusive_list_hook* next) noexcept {
+        m_prev = next->m_prev;
+        m_next = next;
+        m_prev->m_next = this;
+        next->m_prev = this;
+    }
+};
+
+// NOTE: non-standard, a doubly linked list of elements that carry their links in their hook base class (like
+//       boost::intrusive::list with a base hook); the list never allocates, copies or destroys elements, it only links
+//       them, so an element has to outlive its membership (or unlink itself on destruction, which the hook does) and can
+//       be in one such list per hook; the list is circular around a root hook, so size() has to count (elements can
+//       leave without the list noticing); e.g. intrusive_list<connection> for a
+//       'struct connection : intrusive_list_hook<>', the element of a hook is found with a static_cast
+template <typename T, typename Tag = void>
+class intrusive_list {
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+    using hook_type = intrusive_list_hook<Tag>;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using iterator = iterator_impl<iterator_def<T, hook_type*>, iterator_def<T, hook_type*>>;
+    using const_iterator = iterator_impl<iterator_def<const T, hook_type*>, iterator>;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    constexpr intrusive_list() {
+        m_root.m_prev = m_root.m_next = &m_root;
+    }
+
+    intrusive_list(const intrusive_list&) = delete;
+
+    constexpr intrusive_list(intrusive_list&& other) noexcept
+        : intrusive_list() {
+        take_over(other);
+    }
+
+    // NOTE: the elements are unlinked, not destroyed
+    ~intrusive_list() {
+        clear();
+    }
+
+    intrusive_list& operator=(const intrusive_list&) = delete;
+
+    constexpr intrusive_list& operator=(intrusive_list&& other) noexcept {
+        if (&other != this) {
+            clear();
+            take_over(other);
+        }
+        return *this;
+    }
+
+    /*
+        Element access
+    */
+
+    [[nodiscard]] constexpr reference front() {
+        return *element_of(m_root.m_next);
+    }
+
+    [[nodiscard]] constexpr const_reference front() const {
+        return *element_of(m_root.m_next);
+    }
+
+    [[nodiscard]] constexpr reference back() {
+        return *element_of(m_root.m_prev);
+    }
+
+    [[nodiscard]] constexpr const_reference back() const {
+        return *element_of(m_root.m_prev);
+    }
+
+    /*
+        Iterators
+    */
+
+    [[nodiscard]] constexpr iterator begin() noexcept {
+        return iterator(m_root.m_next);
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return const_iterator(m_root.m_next);
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] constexpr iterator end() noexcept {
+        return iterator(&m_root);
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return const_iterator(&m_root);
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    // NOTE: iterator to an element that is linked into this list, in O(1)
+    [[nodiscard]] constexpr iterator iterator_to(reference value) noexcept {
+        return iterator(hook_of(value));
+    }
+
+    [[nodiscard]] constexpr const_iterator iterator_to(const_reference value) const noexcept {
+        return const_iterator(hook_of(const_cast<reference>(value)));
+    }
+
+    /*
+        Capacity
+    */
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_root.m_next == &m_root;
+    }
+
+    // NOTE: O(n), see above
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        size_type res = 0;
+        for (const hook_type* current = m_root.m_next; current != &m_root; current = current->m_next)
+            ++res;
+        return res;
+    }
+
+    /*
+        Modifiers
+    */
+
+    constexpr void clear() noexcept {
+        while (!empty())
+            m_root.m_next->unlink();
+    }
+
+    // NOTE: value must not be linked into a list (by this hook) yet
+    constexpr iterator insert(const_iterator pos, reference value) noexcept {
+        hook_type* hook = hook_of(value);
+        hook->link_before(pos.m_data);
+        return iterator(hook);
+    }
+
+    // NOTE: unlinks the element at pos, returns the iterator following it
+    constexpr iterator erase(const_iterator pos) noexcept {
+        hook_type* next = pos.m_data->m_next;
+        pos.m_data->unlink();
+        return iterator(next);
+    }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept {
+        while (first != last)
+            first = erase(first);
+
+        return iterator(last.m_data);
+    }
+
+    constexpr void push_back(reference value) noexcept {
+        insert(end(), value);
+    }
+
+    constexpr void pop_back() noexcept {
+        if (!empty()) m_root.m_prev->unlink();
+    }
+
+    constexpr void push_front(reference value) noexcept {
+        insert(begin(), value);
+    }
+
+    constexpr void pop_front() noexcept {
+        if (!empty()) m_root.m_next->unlink();
+    }
+
+    constexpr void swap(intrusive_list& other) noexcept {
+        intrusive_list tmp(lw_std::move(other));
+        other = lw_std::move(*this);
+        *this = lw_std::move(tmp);
+    }
+
+    /*
+        Operations
+    */
+
+    // NOTE: unlinks the elements p is true for, returns how many there were
+    template <typename UnaryPredicate>
+    constexpr size_type remove_if(UnaryPredicate p) {
+        size_type res = 0;
+        for (hook_type* current = m_root.m_next; current != &m_root;) {
+            hook_type* next = current->m_next;
+            if (p(*element_of(current))) {
+                current->unlink();
+                ++res;
+            }
+            current = next;
+        }
+        return res;
+    }
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def {
+        friend intrusive_list;
+
+       protected:
+        typedef P value_type;
+        typedef IT_P data_type;
+        typedef bidirectional_iterator_tag iterator_category;
+
+        constexpr iterator_def() = default;
+
+        constexpr iterator_def(const IT_P& data)
+            : m_data(data) {}
+
+        template <typename Q, typename IT_Q>
+        constexpr iterator_def(const iterator_def<Q, IT_Q>& other)
+            : m_data(other.m_data) {}
+
+        constexpr iterator_def(const iterator_def& other) {
+            operator=(other);
+        }
+
+        constexpr iterator_def(iterator_def&& other) {
+            operator=(lw_std::move(other));
+        }
+
+        constexpr iterator_def& operator=(const iterator_def& other) {
+            m_data = other.m_data;
+            return *this;
+        }
+
+        constexpr iterator_def& operator=(iterator_def&& other) {
+            m_data = lw_std::move(other.m_data);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
+            return m_data == other.m_data;
+        }
+
+        [[nodiscard]] constexpr P* get() {
+            return element_of(m_data);
+        }
+
+        [[nodiscard]] constexpr const P* get() const {
+            return element_of(m_data);
+        }
+
+        constexpr void advance(ptrdiff_t n) {
+            for (; n > 0; --n)
+                m_data = m_data->m_next;
+
+            for (; n < 0; ++n)
+                m_data = m_data->m_prev;
+        }
+
+       private:
+        IT_P m_data{nullptr};
+    };
+
+    // NOTE: end() of a const list still is an iterator to the root
+    mutable hook_type m_root{};
+
+    [[nodiscard]] static constexpr hook_type* hook_of(reference value) noexcept {
+        return static_cast<hook_type*>(&value);
+    }
+
+    // NOTE: the hook is a base class of T, so the element is found without knowing the layout of T
+    [[nodiscard]] static constexpr T* element_of(hook_type* hook) noexcept {
+        return static_cast<T*>(hook);
+    }
+
+    constexpr void take_over(intrusive_list& other) noexcept {
+        if (other.empty()) return;
+
+        m_root.m_next = other.m_root.m_next;
+        m_root.m_prev = other.m_root.m_prev;
+        m_root.m_next->m_prev = &m_root;
+        m_root.m_prev->m_next = &m_root;
+
+        other.m_root.m_prev = other.m_root.m_next = &other.m_root;
+    }
+};
+
+}  // namespace lw_std
\ No newline at end of file
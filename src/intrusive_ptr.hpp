@@ -0,0 +1,199 @@
+// intrusive_ptr header (non-standard)
+#pragma once
+
+#include "memory.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+// NOTE: non-standard (as in boost), a base class that puts the reference count into the object itself, so an
+//       intrusive_ptr is one pointer and needs no control block: new T is the only allocation;
+//       Derived is the class deriving from it, the last intrusive_ptr deletes it as a Derived
+template <typename Derived, typename RefCount = default_refcount>
+class intrusive_ref_counter {
+   public:
+    // NOTE: with atomic_refcount only a hint, other threads may change it at any time
+    [[nodiscard]] long use_count() const noexcept {
+        return m_count.load();
+    }
+
+   protected:
+    constexpr intrusive_ref_counter() noexcept = default;
+
+    // NOTE: a copy is a new object, no pointer refers to it yet
+    constexpr intrusive_ref_counter(const intrusive_ref_counter&) noexcept {}
+
+    constexpr intrusive_ref_counter& operator=(const intrusive_ref_counter&) noexcept {
+        return *this;
+    }
+
+    ~intrusive_ref_counter() = default;
+
+   private:
+    // NOTE: mutable, so objects shared as const (e.g. immutable configuration) are counted as well
+    mutable RefCount m_count{0};
+
+    // NOTE: found by argument dependent lookup from intrusive_ptr<Derived>
+    friend void intrusive_ptr_add_ref(const intrusive_ref_counter* ptr) noexcept {
+        ptr->m_count.increment();
+    }
+
+    friend void intrusive_ptr_release(const intrusive_ref_counter* ptr) noexcept {
+        if (ptr->m_count.decrement() == 0) delete static_cast<const Derived*>(ptr);
+    }
+};
+
+// NOTE: non-standard (as in boost), a shared pointer to an object that counts its own references through
+//       intrusive_ptr_add_ref(T*) and intrusive_ptr_release(T*), e.g. by deriving from intrusive_ref_counter;
+//       a raw pointer to such an object can be turned into an intrusive_ptr again at any time
+template <typename T>
+class intrusive_ptr {
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using element_type = T;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    constexpr intrusive_ptr() noexcept = default;
+
+    constexpr intrusive_ptr(decltype(nullptr)) noexcept {}
+
+    // NOTE: add_ref = false adopts a reference the caller already holds, e.g. one given up by detach
+    intrusive_ptr(T* ptr, bool add_ref = true) noexcept
+        : m_ptr(ptr) {
+        if (m_ptr != nullptr && add_ref) intrusive_ptr_add_ref(m_ptr);
+    }
+
+    intrusive_ptr(const intrusive_ptr& r) noexcept
+        : intrusive_ptr(r.m_ptr) {}
+
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    intrusive_ptr(const intrusive_ptr<Y>& r) noexcept
+        : intrusive_ptr(r.get()) {}
+
+    intrusive_ptr(intrusive_ptr&& r) noexcept
+        : m_ptr(r.detach()) {}
+
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    intrusive_ptr(intrusive_ptr<Y>&& r) noexcept
+        : m_ptr(r.detach()) {}
+
+    ~intrusive_ptr() {
+        if (m_ptr != nullptr) intrusive_ptr_release(m_ptr);
+    }
+
+    intrusive_ptr& operator=(const intrusive_ptr& r) noexcept {
+        intrusive_ptr(r).swap(*this);
+        return *this;
+    }
+
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    intrusive_ptr& operator=(const intrusive_ptr<Y>& r) noexcept {
+        intrusive_ptr(r).swap(*this);
+        return *this;
+    }
+
+    intrusive_ptr& operator=(intrusive_ptr&& r) noexcept {
+        intrusive_ptr(lw_std::move(r)).swap(*this);
+        return *this;
+    }
+
+    template <typename Y, typename = enable_if_t<impl::pointer_converts_v<Y, T>>>
+    intrusive_ptr& operator=(intrusive_ptr<Y>&& r) noexcept {
+        intrusive_ptr(lw_std::move(r)).swap(*this);
+        return *this;
+    }
+
+    intrusive_ptr& operator=(T* ptr) noexcept {
+        intrusive_ptr(ptr).swap(*this);
+        return *this;
+    }
+
+    /*
+        Modifiers
+    */
+
+    void reset() noexcept {
+        intrusive_ptr().swap(*this);
+    }
+
+    void reset(T* ptr, bool add_ref = true) noexcept {
+        intrusive_ptr(ptr, add_ref).swap(*this);
+    }
+
+    // NOTE: gives up the reference without releasing it, the caller has to release it (or adopt it again)
+    [[nodiscard]] T* detach() noexcept {
+        T* ptr = m_ptr;
+        m_ptr = nullptr;
+        return ptr;
+    }
+
+    void swap(intrusive_ptr& r) noexcept {
+        lw_std::swap(m_ptr, r.m_ptr);
+    }
+
+    /*
+        Observers
+    */
+
+    [[nodiscard]] T* get() const noexcept {
+        return m_ptr;
+    }
+
+    [[nodiscard]] T& operator*() const noexcept {
+        return *m_ptr;
+    }
+
+    [[nodiscard]] T* operator->() const noexcept {
+        return m_ptr;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return m_ptr != nullptr;
+    }
+
+   private:
+    T* m_ptr{nullptr};
+};
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// NOTE: non-standard, the counterpart of make_shared, a single allocation of the object with its count
+template <typename T, typename... Args>
+[[nodiscard]] intrusive_ptr<T> make_intrusive(Args&&... args) {
+    return intrusive_ptr<T>(new T(lw_std::forward<Args>(args)...));
+}
+
+template <typename T, typename U>
+[[nodiscard]] bool operator==(const intrusive_ptr<T>& lhs, const intrusive_ptr<U>& rhs) noexcept {
+    return lhs.get() == rhs.get();
+}
+
+template <typename T, typename U>
+[[nodiscard]] bool operator!=(const intrusive_ptr<T>& lhs, const intrusive_ptr<U>& rhs) noexcept {
+    return lhs.get() != rhs.get();
+}
+
+template <typename T>
+[[nodiscard]] bool operator==(const intrusive_ptr<T>& lhs, decltype(nullptr)) noexcept {
+    return !lhs;
+}
+
+template <typename T>
+[[nodiscard]] bool operator!=(const intrusive_ptr<T>& lhs, decltype(nullptr)) noexcept {
+    return static_cast<bool>(lhs);
+}
+
+template <typename T>
+void swap(intrusive_ptr<T>& lhs, intrusive_ptr<T>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace lw_std
\ No newline at end of file
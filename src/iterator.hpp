@@ -0,0 +1,91 @@
+// iterator header https://en.cppreference.com/w/cpp/header/iterator
+#pragma once
+
+#include "impl/iterator.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+/*
+    CLASSES
+*/
+
+/*
+    Primitives
+*/
+
+// iterator_traits https://en.cppreference.com/w/cpp/iterator/iterator_traits
+template <typename Iter>
+struct iterator_traits {
+    using difference_type = typename Iter::difference_type;
+    using value_type = typename Iter::value_type;
+    using pointer = typename Iter::pointer;
+    using reference = typename Iter::reference;
+    using iterator_category = typename Iter::iterator_category;
+};
+
+template <typename T>
+struct iterator_traits<T*> {
+    using difference_type = ptrdiff_t;
+    using value_type = remove_cv_t<T>;
+    using pointer = T*;
+    using reference = T&;
+    using iterator_category = random_access_iterator_tag;
+};
+
+/*
+    FUNCTIONS
+*/
+
+/*
+    Iterator operations
+*/
+
+// advance https://en.cppreference.com/w/cpp/iterator/advance
+template <typename InputIt, typename Distance>
+constexpr void advance(InputIt& it, Distance n) {
+    using category = typename iterator_traits<InputIt>::iterator_category;
+    auto steps = static_cast<typename iterator_traits<InputIt>::difference_type>(n);
+
+    if constexpr (is_base_of_v<random_access_iterator_tag, category>) {
+        it += steps;
+    } else {
+        for (; steps > 0; --steps)
+            ++it;
+
+        if constexpr (is_base_of_v<bidirectional_iterator_tag, category>)
+            for (; steps < 0; ++steps)
+                --it;
+    }
+}
+
+// distance https://en.cppreference.com/w/cpp/iterator/distance
+template <typename InputIt>
+[[nodiscard]] constexpr typename iterator_traits<InputIt>::difference_type distance(InputIt first, InputIt last) {
+    if constexpr (is_base_of_v<random_access_iterator_tag, typename iterator_traits<InputIt>::iterator_category>) {
+        return last - first;
+    } else {
+        typename iterator_traits<InputIt>::difference_type n = 0;
+        for (; first != last; ++first)
+            ++n;
+
+        return n;
+    }
+}
+
+// next https://en.cppreference.com/w/cpp/iterator/next
+template <typename InputIt>
+[[nodiscard]] constexpr InputIt next(InputIt it, typename iterator_traits<InputIt>::difference_type n = 1) {
+    lw_std::advance(it, n);
+    return it;
+}
+
+// prev https://en.cppreference.com/w/cpp/iterator/prev
+template <typename BidirIt>
+[[nodiscard]] constexpr BidirIt prev(BidirIt it, typename iterator_traits<BidirIt>::difference_type n = 1) {
+    lw_std::advance(it, -n);
+    return it;
+}
+
+}  // namespace lw_std
\ No newline at end of file
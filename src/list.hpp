@@ -2,9 +2,12 @@
 #pragma once
 
 #include "algorithm.hpp"
+#include "functional.hpp"
 #include "impl/iterator.hpp"
 #include "impl/member_types.hpp"
+#include "iterator.hpp"
 #include "memory.hpp"
+#include "type_traits.hpp"
 #include "utility.hpp"
 
 namespace lw_std {
@@ -37,13 +40,23 @@ class list {
 
     typedef typename Allocator::template rebind<node>::other node_allocator_t;
 
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+    // NOTE: end() holds no node, so iterators carry their list along to find the back node on --end()
+    typedef pair<node*, const list*> iterator_data_t;
+
    public:
     /*
         MEMBER TYPES
     */
 
     LWSTD_COMMON_VALUE_TYPES(T)
-    LWSTD_COMMON_CONTAINER_TYPES(T, node*, Allocator)
+
+    using allocator_type = Allocator;
+    using iterator = iterator_impl<iterator_def<T, iterator_data_t>, iterator_def<T, iterator_data_t>>;
+    using const_iterator = iterator_impl<iterator_def<const T, iterator_data_t>, iterator>;
 
     /*
         MEMBER FUNCTIONS
@@ -104,7 +117,7 @@ class list {
     }
 
     // assign (2) https://en.cppreference.com/w/cpp/container/list/assign
-    template <typename InputIt>
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
     constexpr void assign(InputIt first, InputIt last) {
         clear();
         for (; first != last; ++first)
@@ -148,32 +161,32 @@ class list {
 
     // begin https://en.cppreference.com/w/cpp/container/list/begin
     [[nodiscard]] constexpr iterator begin() noexcept {
-        return iterator(m_front);
+        return iterator_at(m_front);
     }
 
     // begin https://en.cppreference.com/w/cpp/container/list/begin
     [[nodiscard]] constexpr const_iterator begin() const noexcept {
-        return const_iterator(m_front);
+        return iterator_at(m_front);
     }
 
     // begin https://en.cppreference.com/w/cpp/container/list/begin
     [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
-        return const_iterator(m_front);
+        return iterator_at(m_front);
     }
 
     // end https://en.cppreference.com/w/cpp/container/list/end
     [[nodiscard]] constexpr iterator end() noexcept {
-        return iterator(static_cast<node*>(nullptr));
+        return iterator_at(nullptr);
     }
 
     // end https://en.cppreference.com/w/cpp/container/list/end
     [[nodiscard]] constexpr const_iterator end() const noexcept {
-        return const_iterator(static_cast<node*>(nullptr));
+        return iterator_at(nullptr);
     }
 
     // end https://en.cppreference.com/w/cpp/container/list/end
     [[nodiscard]] constexpr const_iterator cend() const noexcept {
-        return const_iterator(static_cast<node*>(nullptr));
+        return iterator_at(nullptr);
     }
 
     // FIXME: rbegin https://en.cppreference.com/w/cpp/container/list/rbegin
@@ -230,7 +243,7 @@ class list {
     }
 
     // insert (4) https://en.cppreference.com/w/cpp/container/list/insert
-    template <typename InputIt>
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
     constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
         bool ret_set{false};
         iterator ret_it = to_non_const_iterator(pos);
@@ -263,20 +276,20 @@ class list {
             m_back = new_node;
         } else {
             const auto& underlying_it = static_cast<typename const_iterator::underlying_type>(pos);
-            auto* mutable_item = const_cast<node*>(underlying_it.m_data);
+            auto* mutable_item = underlying_it.m_data.first;
             m_allocator.construct(new_node, mutable_item->prev, mutable_item, lw_std::forward<Args>(args)...);
         }
 
         if (empty()) m_back = m_front = new_node;
 
         m_size++;
-        return new_node;
+        return iterator_at(new_node);
     }
 
     // erase (1) https://en.cppreference.com/w/cpp/container/list/erase
     constexpr iterator erase(const_iterator pos) {
-        auto* mutable_item = to_non_const_iterator(pos).m_data;
-        auto ret_it = iterator(mutable_item->next);
+        auto* mutable_item = to_non_const_iterator(pos).m_data.first;
+        auto ret_it = iterator_at(mutable_item->next);
 
         if (mutable_item->prev)
             mutable_item->prev->next = mutable_item->next;
@@ -325,7 +338,7 @@ class list {
         if (!empty()) {
             auto tmp = m_back;
             m_back = m_back->prev;
-            erase(tmp);
+            erase(iterator_at(tmp));
         }
     }
 
@@ -350,7 +363,7 @@ class list {
         if (!empty()) {
             auto tmp = m_front;
             m_front = m_front->next;
-            erase(tmp);
+            erase(iterator_at(tmp));
         }
     }
 
@@ -363,23 +376,199 @@ class list {
         Operations
     */
 
-    // FIXME: merge (1) https://en.cppreference.com/w/cpp/container/list/merge
-    // FIXME: merge (2) https://en.cppreference.com/w/cpp/container/list/merge
+    // merge (1) https://en.cppreference.com/w/cpp/container/list/merge
+    constexpr void merge(list& other) {
+        merge(other, less<T>());
+    }
+
+    // merge (1) https://en.cppreference.com/w/cpp/container/list/merge
+    constexpr void merge(list&& other) {
+        merge(other, less<T>());
+    }
+
+    // merge (2) https://en.cppreference.com/w/cpp/container/list/merge
+    // NOTE: the nodes of other are relinked into this list, no element is allocated, copied or moved
+    template <typename Compare>
+    constexpr void merge(list& other, Compare comp) {
+        if (&other == this) return;
+
+        m_front = merge_chains(m_front, other.m_front, comp);
+        m_back = fix_prev_links(m_front);
+        m_size += other.m_size;
+
+        other.m_front = other.m_back = nullptr;
+        other.m_size = 0;
+    }
+
+    // merge (2) https://en.cppreference.com/w/cpp/container/list/merge
+    template <typename Compare>
+    constexpr void merge(list&& other, Compare comp) {
+        merge(other, comp);
+    }
+
+    // splice (1) https://en.cppreference.com/w/cpp/container/list/splice
+    constexpr void splice(const_iterator pos, list& other) {
+        if (&other == this || other.empty()) return;
+
+        link_before(node_of(pos), other.m_front, other.m_back);
+        m_size += other.m_size;
+
+        other.m_front = other.m_back = nullptr;
+        other.m_size = 0;
+    }
+
+    // splice (1) https://en.cppreference.com/w/cpp/container/list/splice
+    constexpr void splice(const_iterator pos, list&& other) {
+        splice(pos, other);
+    }
+
+    // splice (2) https://en.cppreference.com/w/cpp/container/list/splice
+    constexpr void splice(const_iterator pos, list& other, const_iterator it) {
+        node* moved = node_of(it);
+        node* next = node_of(pos);
+        if (&other == this && (moved == next || moved->next == next)) return;
+
+        other.unlink(moved, moved);
+        link_before(next, moved, moved);
+        other.m_size--;
+        m_size++;
+    }
+
+    // splice (2) https://en.cppreference.com/w/cpp/container/list/splice
+    constexpr void splice(const_iterator pos, list&& other, const_iterator it) {
+        splice(pos, other, it);
+    }
+
+    // splice (3) https://en.cppreference.com/w/cpp/container/list/splice
+    // NOTE: O(1) within one list, otherwise the range has to be counted for the sizes
+    constexpr void splice(const_iterator pos, list& other, const_iterator first, const_iterator last) {
+        if (first == last) return;
+
+        node* first_node = node_of(first);
+        node* last_node = node_of(last) != nullptr ? node_of(last)->prev : other.m_back;
+
+        if (&other != this) {
+            auto count = static_cast<size_type>(lw_std::distance(first, last));
+            other.m_size -= count;
+            m_size += count;
+        }
+
+        other.unlink(first_node, last_node);
+        link_before(node_of(pos), first_node, last_node);
+    }
+
+    // splice (3) https://en.cppreference.com/w/cpp/container/list/splice
+    constexpr void splice(const_iterator pos, list&& other, const_iterator first, const_iterator last) {
+        splice(pos, other, first, last);
+    }
+
+    // remove (1) https://en.cppreference.com/w/cpp/container/list/remove
+    constexpr size_type remove(const T& value) {
+        // NOTE: value might be an element of this list, so the node holding it is erased last
+        node* deferred = nullptr;
+        auto old_size = m_size;
+
+        for (node* current = m_front; current != nullptr;) {
+            node* next = current->next;
+            if (current->value == value) {
+                if (&current->value == &value)
+                    deferred = current;
+                else
+                    erase(iterator_at(current));
+            }
+            current = next;
+        }
+
+        if (deferred != nullptr) erase(iterator_at(deferred));
+        return old_size - m_size;
+    }
+
+    // remove_if (2) https://en.cppreference.com/w/cpp/container/list/remove
+    template <typename UnaryPredicate>
+    constexpr size_type remove_if(UnaryPredicate p) {
+        // NOTE: matching nodes are unlinked where they are, no element is moved
+        auto old_size = m_size;
+
+        for (node* current = m_front; current != nullptr;) {
+            node* next = current->next;
+            if (p(current->value))
+                erase(iterator_at(current));
+            current = next;
+        }
+
+        return old_size - m_size;
+    }
+
+    // reverse https://en.cppreference.com/w/cpp/container/list/reverse
+    constexpr void reverse() noexcept {
+        for (node* current = m_front; current != nullptr; current = current->prev)
+            lw_std::swap(current->prev, current->next);
+
+        lw_std::swap(m_front, m_back);
+    }
+
+    // unique (1) https://en.cppreference.com/w/cpp/container/list/unique
+    constexpr size_type unique() {
+        return unique(equal_to<T>());
+    }
+
+    // unique (2) https://en.cppreference.com/w/cpp/container/list/unique
+    template <typename BinaryPredicate>
+    constexpr size_type unique(BinaryPredicate p) {
+        auto old_size = m_size;
+
+        // NOTE: every element is compared to the first one of its group, as std::list does
+        for (node* current = m_front; current != nullptr && current->next != nullptr;) {
+            if (p(current->value, current->next->value))
+                erase(iterator_at(current->next));
+            else
+                current = current->next;
+        }
 
-    // FIXME: splice (1) https://en.cppreference.com/w/cpp/container/list/splice
-    // FIXME: splice (2) https://en.cppreference.com/w/cpp/container/list/splice
-    // FIXME: splice (3) https://en.cppreference.com/w/cpp/container/list/splice
+        return old_size - m_size;
+    }
+
+    // sort (1) https://en.cppreference.com/w/cpp/container/list/sort
+    constexpr void sort() {
+        sort(less<T>());
+    }
 
-    // FIXME: remove (1) https://en.cppreference.com/w/cpp/container/list/remove
-    // FIXME: remove_if (2) https://en.cppreference.com/w/cpp/container/list/remove
+    // sort (2) https://en.cppreference.com/w/cpp/container/list/sort
+    // NOTE: merge sort on the next links in a single front to back pass: bins[i] holds a sorted chain of 2^i nodes,
+    //       every node is carried up through the filled bins like a binary counter, so merges happen while their nodes
+    //       are still in cache; the prev links are restored in a last pass; stable, O(n log n), no allocation and no
+    //       element is moved
+    template <typename Compare>
+    constexpr void sort(Compare comp) {
+        if (m_size < 2) return;
 
-    // FIXME: reverse https://en.cppreference.com/w/cpp/container/list/reverse
+        node* bins[sizeof(size_type) * 8] = {};
+        size_type bin_count = 0;
 
-    // FIXME: unique (1) https://en.cppreference.com/w/cpp/container/list/unique
-    // FIXME: unique (2) https://en.cppreference.com/w/cpp/container/list/unique
+        for (node* rest = m_front; rest != nullptr;) {
+            node* carry = rest;
+            rest = rest->next;
+            carry->next = nullptr;
 
-    // FIXME: sort (1) https://en.cppreference.com/w/cpp/container/list/sort
-    // FIXME: sort (2) https://en.cppreference.com/w/cpp/container/list/sort
+            // NOTE: the chains in the bins hold earlier nodes than carry, so they go first to keep the sort stable
+            size_type i = 0;
+            for (; i < bin_count && bins[i] != nullptr; ++i) {
+                carry = merge_chains(bins[i], carry, comp);
+                bins[i] = nullptr;
+            }
+
+            bins[i] = carry;
+            if (i == bin_count) ++bin_count;
+        }
+
+        node* sorted = nullptr;
+        for (size_type i = 0; i < bin_count; ++i)
+            if (bins[i] != nullptr)
+                sorted = merge_chains(bins[i], sorted, comp);
+
+        m_front = sorted;
+        m_back = fix_prev_links(m_front);
+    }
 
    private:
     template <typename P, typename IT_P>
@@ -389,6 +578,7 @@ class list {
        protected:
         typedef P value_type;
         typedef IT_P data_type;
+        typedef bidirectional_iterator_tag iterator_category;
 
         constexpr iterator_def() = default;
 
@@ -418,27 +608,27 @@ class list {
         }
 
         [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
-            return m_data == other.m_data;
+            return m_data.first == other.m_data.first;
         }
 
         [[nodiscard]] constexpr P* get() {
-            return &(m_data->value);
+            return &(m_data.first->value);
         }
 
         [[nodiscard]] constexpr const P* get() const {
-            return &(m_data->value);
+            return &(m_data.first->value);
         }
 
-        constexpr void advance(int n) {
-            for (int i = 0; i < n && m_data; ++i)
-                m_data = m_data->next;
+        constexpr void advance(ptrdiff_t n) {
+            for (; n > 0 && m_data.first; --n)
+                m_data.first = m_data.first->next;
 
-            for (int i = 0; i > n && m_data; --i)
-                m_data = m_data->prev;
+            for (; n < 0; ++n)
+                m_data.first = m_data.first ? m_data.first->prev : m_data.second->m_back;
         }
 
        private:
-        IT_P m_data;
+        IT_P m_data{nullptr, nullptr};
     };
 
     node_allocator_t m_allocator;
@@ -448,10 +638,142 @@ class list {
 
     size_type m_size = 0;
 
+    [[nodiscard]] constexpr iterator iterator_at(node* n) const {
+        return iterator(iterator_data_t{n, this});
+    }
+
+    [[nodiscard]] static node* node_of(const const_iterator& pos) {
+        return static_cast<const typename const_iterator::underlying_type&>(pos).m_data.first;
+    }
+
+    // NOTE: takes the chain first..last (inclusive) out of this list, the size is up to the caller
+    constexpr void unlink(node* first, node* last) noexcept {
+        if (first->prev != nullptr)
+            first->prev->next = last->next;
+        else
+            m_front = last->next;
+
+        if (last->next != nullptr)
+            last->next->prev = first->prev;
+        else
+            m_back = first->prev;
+    }
+
+    // NOTE: links the chain first..last (inclusive) in before next (nullptr is the end), the size is up to the caller
+    constexpr void link_before(node* next, node* first, node* last) noexcept {
+        node* prev = next != nullptr ? next->prev : m_back;
+
+        first->prev = prev;
+        last->next = next;
+
+        if (prev != nullptr)
+            prev->next = first;
+        else
+            m_front = first;
+
+        if (next != nullptr)
+            next->prev = last;
+        else
+            m_back = last;
+    }
+
+    // NOTE: merges two sorted, nullptr terminated chains by their next links only, a wins ties (stable);
+    //       the prev links are left for fix_prev_links
+    template <typename Compare>
+    [[nodiscard]] static constexpr node* merge_chains(node* a, node* b, Compare& comp) {
+        node* head = nullptr;
+        node** link = &head;
+
+        while (a != nullptr && b != nullptr) {
+            if (comp(b->value, a->value)) {
+                *link = b;
+                b = b->next;
+            } else {
+                *link = a;
+                a = a->next;
+            }
+            link = &(*link)->next;
+        }
+
+        *link = a != nullptr ? a : b;
+        return head;
+    }
+
+    // NOTE: restores the prev links of a chain from its next links, returns the last node
+    static constexpr node* fix_prev_links(node* first) noexcept {
+        node* prev = nullptr;
+        for (; first != nullptr; first = first->next) {
+            first->prev = prev;
+            prev = first;
+        }
+        return prev;
+    }
+
     static iterator to_non_const_iterator(const_iterator& pos) {
         const auto& underlying_pos = static_cast<typename const_iterator::underlying_type>(pos);
-        return const_cast<node*>(underlying_pos.m_data);
+        return iterator(underlying_pos.m_data);
     }
 };
 
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// operator== (1) https://en.cppreference.com/w/cpp/container/list/operator_cmp
+template <typename T>
+[[nodiscard]] constexpr bool operator==(const list<T>& lhs, const list<T>& rhs) {
+    return lhs.size() == rhs.size() && lw_std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+// operator== (2) https://en.cppreference.com/w/cpp/container/list/operator_cmp
+template <typename T>
+[[nodiscard]] constexpr bool operator!=(const list<T>& lhs, const list<T>& rhs) {
+    return !operator==(lhs, rhs);
+}
+
+// NOTE: operator<=> (7) https://en.cppreference.com/w/cpp/container/list/operator_cmp as C++17 overload of synthesized_cmp_three_way,
+//       every pair of elements is compared once
+template <typename T>
+[[nodiscard]] constexpr int synthesized_cmp_three_way(const list<T>& lhs, const list<T>& rhs) {
+    return lw_std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+// operator< (3) https://en.cppreference.com/w/cpp/container/list/operator_cmp
+template <typename T>
+[[nodiscard]] constexpr bool operator<(const list<T>& lhs, const list<T>& rhs) {
+    return synthesized_cmp_three_way(lhs, rhs) < 0;
+}
+
+// operator<= (4) https://en.cppreference.com/w/cpp/container/list/operator_cmp
+template <typename T>
+[[nodiscard]] constexpr bool operator<=(const list<T>& lhs, const list<T>& rhs) {
+    return synthesized_cmp_three_way(lhs, rhs) <= 0;
+}
+
+// operator> (5) https://en.cppreference.com/w/cpp/container/list/operator_cmp
+template <typename T>
+[[nodiscard]] constexpr bool operator>(const list<T>& lhs, const list<T>& rhs) {
+    return synthesized_cmp_three_way(lhs, rhs) > 0;
+}
+
+// operator>= (6) https://en.cppreference.com/w/cpp/container/list/operator_cmp
+template <typename T>
+[[nodiscard]] constexpr bool operator>=(const list<T>& lhs, const list<T>& rhs) {
+    return synthesized_cmp_three_way(lhs, rhs) >= 0;
+}
+
+// NOTE: no extra specialization: swap https://en.cppreference.com/w/cpp/container/list/swap2
+
+// erase (1) https://en.cppreference.com/w/cpp/container/list/erase2
+template <typename T, typename Allocator, typename U>
+constexpr typename list<T, Allocator>::size_type erase(list<T, Allocator>& c, const U& value) {
+    return c.remove_if([&value](const T& element) { return element == value; });
+}
+
+// erase_if (2) https://en.cppreference.com/w/cpp/container/list/erase2
+template <typename T, typename Allocator, typename Pred>
+constexpr typename list<T, Allocator>::size_type erase_if(list<T, Allocator>& c, Pred pred) {
+    return c.remove_if(pred);
+}
+
 }  // namespace lw_std
\ No newline at end of file
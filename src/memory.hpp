@@ -15,4 +15,5 @@
     Smart pointers
 */
 
+#include "impl/shared_ptr.hpp"
 #include "impl/unique_ptr.hpp"
@@ -0,0 +1,348 @@
+// read_mostly_map header (non-standard)
+#pragma once
+
+// NOTE: needs a hosted platform for std::atomic, std::mutex and threads, not available on Arduino
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "algorithm.hpp"
+#include "functional.hpp"
+#include "memory.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+namespace impl {
+
+// NOTE: which reader counter the calling thread uses, assigned round robin on first use and shared by all maps
+inline size_t reader_stripe() {
+    static std::atomic<size_t> next_stripe{0};
+    static thread_local size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed);
+    return stripe;
+}
+
+}  // namespace impl
+
+// NOTE: non-standard, a hash map for tables that are read by many threads all the time and written rarely;
+//       readers take no lock and never wait: they announce themselves on a per thread counter of the current epoch,
+//       walk the buckets with atomic loads and copy the value out;
+//       writers are serialized by a mutex, never change a published node (assigning a value publishes a new node)
+//       and free unlinked nodes only after a grace period, when every reader that could still see them has left;
+//       the grace period flips the epoch twice and waits for the readers of the old one each time, so a writer
+//       blocks for about the length of the longest read, which is the price for wait free reads
+template <typename Key, typename T, typename Hash = hash<Key>, typename Equal = equal_to<Key>, typename Allocator = allocator<pair<const Key, T>>>
+class read_mostly_map {
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using key_type = Key;
+    using mapped_type = T;
+    using size_type = size_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+    using allocator_type = Allocator;
+
+    // NOTE: readers spread over this many cache lines of counters, so they don't write to the same one
+    static constexpr size_type reader_stripes = 16;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    read_mostly_map() = default;
+
+    explicit read_mostly_map(size_type count) {
+        if (count > 0) m_table.store(create_table(count));
+    }
+
+    // NOTE: neither the atomics nor the mutex can be copied or moved, neither can the map
+    read_mostly_map(const read_mostly_map&) = delete;
+    read_mostly_map& operator=(const read_mostly_map&) = delete;
+
+    // NOTE: no reader or writer may be active anymore
+    ~read_mostly_map() {
+        destroy_table(m_table.load());
+    }
+
+    /*
+        Capacity
+    */
+
+    [[nodiscard]] size_type size() const {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool empty() const {
+        return size() == 0;
+    }
+
+    [[nodiscard]] size_type bucket_count() const {
+        const table* t = m_table.load();
+        return t == nullptr ? 0 : t->bucket_count;
+    }
+
+    /*
+        Lookup (wait free, any number of threads)
+    */
+
+    // NOTE: copies the value of key into value, returns whether the key was found
+    bool find(const key_type& key, mapped_type& value) const {
+        read_guard guard(*this);
+
+        const node* n = find_node(key);
+        if (n == nullptr) return false;
+
+        value = n->value;
+        return true;
+    }
+
+    [[nodiscard]] bool contains(const key_type& key) const {
+        read_guard guard(*this);
+        return find_node(key) != nullptr;
+    }
+
+    // NOTE: calls fn(const mapped_type&) while the value can't be freed, returns whether the key was found;
+    //       fn must not write to this map, the writer would wait for the grace period of its own read
+    template <typename Function>
+    bool visit(const key_type& key, Function fn) const {
+        read_guard guard(*this);
+
+        const node* n = find_node(key);
+        if (n == nullptr) return false;
+
+        fn(static_cast<const mapped_type&>(n->value));
+        return true;
+    }
+
+    /*
+        Modifiers (one writer at a time, the others wait on the lock)
+    */
+
+    // NOTE: returns whether the value was inserted, false if the key was already there (its value is kept)
+    bool insert(const key_type& key, const mapped_type& value) {
+        std::lock_guard<std::mutex> guard(m_writer);
+
+        if (find_node(key) != nullptr) return false;
+
+        insert_new(key, value);
+        return true;
+    }
+
+    // NOTE: returns whether the value was inserted, false if it replaced the value of an existing key
+    bool insert_or_assign(const key_type& key, const mapped_type& value) {
+        std::lock_guard<std::mutex> guard(m_writer);
+
+        atomic_link* link = find_link(key);
+        if (link == nullptr) {
+            insert_new(key, value);
+            return true;
+        }
+
+        // NOTE: readers see either the old or the new node, never a value that is half assigned
+        node* old_node = link->load();
+        link->store(create_node(key, value, old_node->next.load()));
+
+        synchronize();
+        destroy_node(old_node);
+        return false;
+    }
+
+    // NOTE: returns the number of erased elements (0 or 1)
+    size_type erase(const key_type& key) {
+        std::lock_guard<std::mutex> guard(m_writer);
+
+        atomic_link* link = find_link(key);
+        if (link == nullptr) return 0;
+
+        // NOTE: the erased node keeps its link, readers that stand on it continue with the rest of the bucket
+        node* old_node = link->load();
+        link->store(old_node->next.load());
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+
+        synchronize();
+        destroy_node(old_node);
+        return 1;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> guard(m_writer);
+
+        table* old_table = m_table.exchange(nullptr);
+        m_size.store(0, std::memory_order_relaxed);
+
+        synchronize();
+        destroy_table(old_table);
+    }
+
+    // NOTE: makes room for count elements without another rehash
+    void reserve(size_type count) {
+        std::lock_guard<std::mutex> guard(m_writer);
+
+        if (count > bucket_count()) rehash(count);
+    }
+
+   private:
+    struct node {
+        node(const key_type& k, const mapped_type& v, node* n) : key(k), value(v), next(n) {}
+
+        const key_type key;
+        const mapped_type value;
+        std::atomic<node*> next;
+    };
+
+    using atomic_link = std::atomic<node*>;
+
+    struct table {
+        size_type bucket_count;
+        atomic_link* buckets;
+    };
+
+    // NOTE: one cache line per stripe, a counter per epoch parity
+    struct alignas(64) reader_counters {
+        std::atomic<size_type> active[2] = {};
+    };
+
+    typedef typename Allocator::template rebind<node>::other node_allocator_t;
+    typedef typename Allocator::template rebind<table>::other table_allocator_t;
+    typedef typename Allocator::template rebind<atomic_link>::other bucket_allocator_t;
+
+    class read_guard {
+       public:
+        explicit read_guard(const read_mostly_map& map)
+            : m_counter(map.m_readers[impl::reader_stripe() % reader_stripes].active[map.m_epoch.load() & 1]) {
+            m_counter.fetch_add(1);
+        }
+
+        read_guard(const read_guard&) = delete;
+        read_guard& operator=(const read_guard&) = delete;
+
+        ~read_guard() {
+            m_counter.fetch_sub(1);
+        }
+
+       private:
+        std::atomic<size_type>& m_counter;
+    };
+
+    // NOTE: all accesses to links, the epoch and the reader counters are sequentially consistent: a writer that
+    //       finds a reader counter at zero after unlinking a node knows the reader's next loads see the unlinked state
+    //       (seq_cst loads cost the same as acquire loads on x86 and ARMv8, only the rare writer pays for the stores)
+    std::atomic<table*> m_table{nullptr};
+    std::atomic<size_type> m_size{0};
+    std::atomic<size_type> m_epoch{0};
+    mutable reader_counters m_readers[reader_stripes];
+
+    std::mutex m_writer;
+
+    node_allocator_t m_node_allocator;
+    table_allocator_t m_table_allocator;
+    bucket_allocator_t m_bucket_allocator;
+
+    [[nodiscard]] const node* find_node(const key_type& key) const {
+        const table* t = m_table.load();
+        if (t == nullptr) return nullptr;
+
+        for (const node* n = t->buckets[Hash{}(key) % t->bucket_count].load(); n != nullptr; n = n->next.load())
+            if (Equal{}(n->key, key)) return n;
+
+        return nullptr;
+    }
+
+    // NOTE: writer only, the link that points to the node of key
+    [[nodiscard]] atomic_link* find_link(const key_type& key) {
+        table* t = m_table.load();
+        if (t == nullptr) return nullptr;
+
+        for (atomic_link* link = &t->buckets[Hash{}(key) % t->bucket_count]; link->load() != nullptr; link = &link->load()->next)
+            if (Equal{}(link->load()->key, key)) return link;
+
+        return nullptr;
+    }
+
+    // NOTE: writer only, key is not in the map yet
+    void insert_new(const key_type& key, const mapped_type& value) {
+        if (size() + 1 > bucket_count()) rehash(max_of(size_type{8}, 2 * bucket_count()));
+
+        table* t = m_table.load();
+        atomic_link& head = t->buckets[Hash{}(key) % t->bucket_count];
+
+        // NOTE: the node is complete before the store publishes it
+        head.store(create_node(key, value, head.load()));
+        m_size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // NOTE: writer only, readers may still walk the old buckets, so the nodes are copied into the new table
+    //       instead of relinked, and the old table is freed after the grace period
+    void rehash(size_type count) {
+        table* new_table = create_table(count);
+        table* old_table = m_table.load();
+
+        if (old_table != nullptr)
+            for (size_type i = 0; i < old_table->bucket_count; ++i)
+                for (node* n = old_table->buckets[i].load(); n != nullptr; n = n->next.load()) {
+                    atomic_link& head = new_table->buckets[Hash{}(n->key) % new_table->bucket_count];
+                    head.store(create_node(n->key, n->value, head.load()));
+                }
+
+        m_table.store(new_table);
+
+        synchronize();
+        destroy_table(old_table);
+    }
+
+    // NOTE: waits until no reader can see what was unlinked before the call;
+    //       a reader announces itself on the epoch it loaded, which can be one flip behind, so both parities are drained
+    void synchronize() {
+        for (int phase = 0; phase < 2; ++phase) {
+            size_type old_parity = m_epoch.fetch_add(1) & 1;
+
+            for (auto& counters : m_readers)
+                while (counters.active[old_parity].load() != 0)
+                    std::this_thread::yield();
+        }
+    }
+
+    [[nodiscard]] node* create_node(const key_type& key, const mapped_type& value, node* next) {
+        node* n = m_node_allocator.allocate(1);
+        m_node_allocator.construct(n, key, value, next);
+        return n;
+    }
+
+    void destroy_node(node* n) {
+        m_node_allocator.destroy(n);
+        m_node_allocator.deallocate(n, 1);
+    }
+
+    [[nodiscard]] table* create_table(size_type count) {
+        table* t = m_table_allocator.allocate(1);
+        atomic_link* buckets = m_bucket_allocator.allocate(count);
+        for (size_type i = 0; i < count; ++i)
+            m_bucket_allocator.construct(buckets + i, nullptr);
+
+        m_table_allocator.construct(t, table{count, buckets});
+        return t;
+    }
+
+    // NOTE: frees the table and its nodes, no reader may see it anymore
+    void destroy_table(table* t) {
+        if (t == nullptr) return;
+
+        for (size_type i = 0; i < t->bucket_count; ++i) {
+            for (node* n = t->buckets[i].load(); n != nullptr;) {
+                node* next = n->next.load();
+                destroy_node(n);
+                n = next;
+            }
+            m_bucket_allocator.destroy(t->buckets + i);
+        }
+
+        m_bucket_allocator.deallocate(t->buckets, t->bucket_count);
+        m_table_allocator.destroy(t);
+        m_table_allocator.deallocate(t, 1);
+    }
+};
+
+}  // namespace lw_std
\ No newline at end of file
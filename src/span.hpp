@@ -0,0 +1,247 @@
+// span header https://en.cppreference.com/w/cpp/header/span
+#pragma once
+
+#include "limits.hpp"
+#include "string_view.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+// dynamic_extent https://en.cppreference.com/w/cpp/container/span/dynamic_extent
+inline constexpr size_t dynamic_extent = numeric_limits<size_t>::max();
+
+namespace impl {
+
+// NOTE: a span of fixed extent only stores the pointer, its size is this empty base
+template <size_t Extent>
+struct span_extent {
+    constexpr explicit span_extent(size_t) {}
+
+    [[nodiscard]] static constexpr size_t size() noexcept {
+        return Extent;
+    }
+};
+
+template <>
+struct span_extent<dynamic_extent> {
+    constexpr explicit span_extent(size_t size)
+        : m_size(size) {}
+
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        return m_size;
+    }
+
+   private:
+    size_t m_size;
+};
+
+// NOTE: only used in decltype, accepts U (*)[] if T is U or const U, the element check of std::span
+template <typename T>
+void span_accepts_elements(T (*)[]);
+
+template <typename Container>
+using span_container_element_t = remove_pointer_t<decltype(lw_std::declval<Container&>().data())>;
+
+}  // namespace impl
+
+// span https://en.cppreference.com/w/cpp/container/span
+// NOTE: a pointer and, for dynamic_extent, a size over elements owned by someone else, e.g. a received frame
+//       in a vector<uint8_t>, which is passed around and cut into fields without copying;
+//       the iterators are plain pointers; lw_std has no exceptions and no checks, a span never outlives its elements
+template <typename T, size_t Extent = dynamic_extent>
+class span : private impl::span_extent<Extent> {
+    using extent_base = impl::span_extent<Extent>;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using element_type = T;
+    using value_type = remove_cv_t<T>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = pointer;
+
+    // extent https://en.cppreference.com/w/cpp/container/span
+    static constexpr size_type extent = Extent;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/container/span/span
+    template <size_t E = Extent, typename = enable_if_t<E == 0 || E == dynamic_extent>>
+    constexpr span() noexcept
+        : extent_base(0) {}
+
+    // (constructor) (2) https://en.cppreference.com/w/cpp/container/span/span
+    // NOTE: pointers only and never explicit (that needs explicit(bool) of C++20), count has to be Extent for a fixed extent
+    constexpr span(pointer first, size_type count)
+        : extent_base(count), m_data(first) {}
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/container/span/span
+    constexpr span(pointer first, pointer last)
+        : extent_base(static_cast<size_type>(last - first)), m_data(first) {}
+
+    // (constructor) (4) https://en.cppreference.com/w/cpp/container/span/span
+    template <size_t N, typename = enable_if_t<Extent == dynamic_extent || Extent == N>>
+    constexpr span(element_type (&arr)[N]) noexcept
+        : extent_base(N), m_data(arr) {}
+
+    // FIXME: (constructor) (5) https://en.cppreference.com/w/cpp/container/span/span
+    // FIXME: (constructor) (6) https://en.cppreference.com/w/cpp/container/span/span
+
+    // (constructor) (7) https://en.cppreference.com/w/cpp/container/span/span
+    // NOTE: any lvalue with data() and size() whose elements fit, e.g. vector, string or another span
+    //       (which covers (8), without checking the extents)
+    template <typename Container,
+              typename = decltype(impl::span_accepts_elements<T>(static_cast<impl::span_container_element_t<Container> (*)[]>(nullptr))),
+              typename = decltype(lw_std::declval<Container&>().size())>
+    constexpr span(Container& c)
+        : extent_base(c.size()), m_data(c.data()) {}
+
+    // (constructor) (9) https://en.cppreference.com/w/cpp/container/span/span
+    constexpr span(const span& other) noexcept = default;
+
+    // operator= https://en.cppreference.com/w/cpp/container/span/operator%3D
+    constexpr span& operator=(const span& other) noexcept = default;
+
+    /*
+        Iterators
+    */
+
+    // begin https://en.cppreference.com/w/cpp/container/span/begin
+    [[nodiscard]] constexpr iterator begin() const noexcept {
+        return m_data;
+    }
+
+    // end https://en.cppreference.com/w/cpp/container/span/end
+    [[nodiscard]] constexpr iterator end() const noexcept {
+        return m_data + size();
+    }
+
+    // FIXME: rbegin https://en.cppreference.com/w/cpp/container/span/rbegin
+    // FIXME: rend https://en.cppreference.com/w/cpp/container/span/rend
+
+    /*
+        Element access
+    */
+
+    // front https://en.cppreference.com/w/cpp/container/span/front
+    [[nodiscard]] constexpr reference front() const {
+        return m_data[0];
+    }
+
+    // back https://en.cppreference.com/w/cpp/container/span/back
+    [[nodiscard]] constexpr reference back() const {
+        return m_data[size() - 1];
+    }
+
+    // operator[] https://en.cppreference.com/w/cpp/container/span/operator_at
+    [[nodiscard]] constexpr reference operator[](size_type idx) const {
+        return m_data[idx];
+    }
+
+    // data https://en.cppreference.com/w/cpp/container/span/data
+    [[nodiscard]] constexpr pointer data() const noexcept {
+        return m_data;
+    }
+
+    /*
+        Observers
+    */
+
+    // size https://en.cppreference.com/w/cpp/container/span/size
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return extent_base::size();
+    }
+
+    // size_bytes https://en.cppreference.com/w/cpp/container/span/size_bytes
+    [[nodiscard]] constexpr size_type size_bytes() const noexcept {
+        return size() * sizeof(element_type);
+    }
+
+    // empty https://en.cppreference.com/w/cpp/container/span/empty
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /*
+        Subviews
+    */
+
+    // first (1) https://en.cppreference.com/w/cpp/container/span/first
+    template <size_t Count>
+    [[nodiscard]] constexpr span<element_type, Count> first() const {
+        static_assert(Extent == dynamic_extent || Count <= Extent, "first: Count is larger than the extent");
+        return span<element_type, Count>(m_data, Count);
+    }
+
+    // first (2) https://en.cppreference.com/w/cpp/container/span/first
+    [[nodiscard]] constexpr span<element_type> first(size_type count) const {
+        return span<element_type>(m_data, count);
+    }
+
+    // last (1) https://en.cppreference.com/w/cpp/container/span/last
+    template <size_t Count>
+    [[nodiscard]] constexpr span<element_type, Count> last() const {
+        static_assert(Extent == dynamic_extent || Count <= Extent, "last: Count is larger than the extent");
+        return span<element_type, Count>(m_data + size() - Count, Count);
+    }
+
+    // last (2) https://en.cppreference.com/w/cpp/container/span/last
+    [[nodiscard]] constexpr span<element_type> last(size_type count) const {
+        return span<element_type>(m_data + size() - count, count);
+    }
+
+    // subspan (1) https://en.cppreference.com/w/cpp/container/span/subspan
+    template <size_t Offset, size_t Count = dynamic_extent>
+    [[nodiscard]] constexpr span<element_type, Count != dynamic_extent ? Count : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent)> subspan() const {
+        static_assert(Extent == dynamic_extent || (Offset <= Extent && (Count == dynamic_extent || Count <= Extent - Offset)), "subspan: out of the extent");
+        return {m_data + Offset, Count != dynamic_extent ? Count : size() - Offset};
+    }
+
+    // subspan (2) https://en.cppreference.com/w/cpp/container/span/subspan
+    [[nodiscard]] constexpr span<element_type> subspan(size_type offset, size_type count = dynamic_extent) const {
+        return span<element_type>(m_data + offset, count != dynamic_extent ? count : size() - offset);
+    }
+
+   private:
+    pointer m_data{nullptr};
+};
+
+/*
+    DEDUCTION GUIDES
+*/
+
+template <typename T, size_t N>
+span(T (&)[N]) -> span<T, N>;
+
+template <typename T>
+span(T*, size_t) -> span<T>;
+
+template <typename Container>
+span(Container&) -> span<impl::span_container_element_t<Container>>;
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// FIXME: as_bytes https://en.cppreference.com/w/cpp/container/span/as_bytes (lw_std has no std::byte)
+
+// NOTE: non-standard, the bytes of a span as characters without a copy, e.g. a text field of a received frame
+template <typename T, size_t Extent, typename = enable_if_t<sizeof(T) == 1>>
+[[nodiscard]] inline string_view as_string_view(span<T, Extent> bytes) {
+    if constexpr (is_same_v<remove_cv_t<T>, char>)
+        return string_view(bytes.data(), bytes.size());
+    else
+        return string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+}  // namespace lw_std
\ No newline at end of file
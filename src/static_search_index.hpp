@@ -0,0 +1,258 @@
+// static_search_index header (non-standard)
+#pragma once
+
+#include "bit.hpp"
+#include "flat_map.hpp"
+#include "functional.hpp"
+#include "impl/iterator.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace lw_std {
+
+// NOTE: non-standard, read-only sorted index which is built once and then only queried;
+//       keys are stored in Eytzinger (breadth first) order of the implicit search tree: the top levels
+//       share a few cache lines and the children of node k sit next to each other at 2k and 2k + 1,
+//       so the nodes a few levels further down can be prefetched while the current one is compared
+template <typename Key, typename Value, typename Compare = less<Key>>
+class static_search_index {
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+    typedef pair<const static_search_index*, size_t> iterator_data_t;
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = pair<key_type, mapped_type>;
+    using key_compare = Compare;
+    using reference = pair<const key_type&, const mapped_type&>;
+    using const_reference = pair<const key_type&, const mapped_type&>;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+
+    // NOTE: the index is immutable, so both iterator types are constant, they iterate in key order
+    using iterator = iterator_impl<iterator_def<const_reference, iterator_data_t>, iterator_def<const_reference, iterator_data_t>>;
+    using const_iterator = iterator;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    constexpr static_search_index() = default;
+
+    // NOTE: keys have to be sorted by comp and unique, values[i] belongs to sorted_keys[i]
+    static_search_index(const vector<key_type>& sorted_keys, const vector<mapped_type>& values, const key_compare& comp = key_compare())
+        : m_compare(comp) {
+        build(sorted_keys, values);
+    }
+
+    explicit static_search_index(const flat_map<key_type, mapped_type, key_compare>& map)
+        : static_search_index(map.keys(), map.values(), map.key_comp()) {}
+
+    /*
+        Iterators
+    */
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return const_iterator(iterator_data_t{this, first_index()});
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return const_iterator(iterator_data_t{this, size_type{0}});
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    /*
+        Capacity
+    */
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_keys.empty();
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return m_keys.size();
+    }
+
+    /*
+        Lookup
+    */
+
+    [[nodiscard]] const_iterator find(const key_type& key) const {
+        auto index = lower_bound_index(key);
+        if (index != 0 && !m_compare(key, m_keys[index - 1]))
+            return const_iterator(iterator_data_t{this, index});
+        return end();
+    }
+
+    [[nodiscard]] size_type count(const key_type& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    [[nodiscard]] bool contains(const key_type& key) const {
+        return find(key) != end();
+    }
+
+    [[nodiscard]] const_iterator lower_bound(const key_type& key) const {
+        return const_iterator(iterator_data_t{this, lower_bound_index(key)});
+    }
+
+    [[nodiscard]] constexpr key_compare key_comp() const {
+        return m_compare;
+    }
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def {
+        friend static_search_index;
+
+       protected:
+        typedef P value_type;
+        typedef IT_P data_type;
+        typedef forward_iterator_tag iterator_category;
+
+        constexpr iterator_def() = default;
+
+        constexpr iterator_def(const IT_P& data)
+            : m_data(data) {}
+
+        constexpr iterator_def(const iterator_def& other) {
+            operator=(other);
+        }
+
+        constexpr iterator_def(iterator_def&& other) {
+            operator=(lw_std::move(other));
+        }
+
+        constexpr iterator_def& operator=(const iterator_def& other) {
+            m_data = other.m_data;
+            return *this;
+        }
+
+        constexpr iterator_def& operator=(iterator_def&& other) {
+            m_data = lw_std::move(other.m_data);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
+            return m_data.second == other.m_data.second;
+        }
+
+        [[nodiscard]] constexpr P* get() {
+            return new (m_proxy) P{m_data.first->m_keys[m_data.second - 1], m_data.first->m_values[m_data.second - 1]};
+        }
+
+        [[nodiscard]] constexpr const P* get() const {
+            return new (m_proxy) P{m_data.first->m_keys[m_data.second - 1], m_data.first->m_values[m_data.second - 1]};
+        }
+
+        constexpr void advance(ptrdiff_t n) {
+            for (ptrdiff_t i = 0; i < n && m_data.second != 0; ++i)
+                m_data.second = m_data.first->next_index(m_data.second);
+        }
+
+       private:
+        // NOTE: second is the 1-based eytzinger index of the node, 0 is end
+        IT_P m_data{nullptr, size_t{0}};
+
+        // NOTE: see flat_map, a pair of references is built in here on every dereference
+        alignas(P) mutable unsigned char m_proxy[sizeof(P)];
+    };
+
+    // NOTE: nodes are numbered from 1 so the children of k are 2k and 2k + 1, node k is stored at [k - 1]
+    vector<key_type> m_keys{};
+    vector<mapped_type> m_values{};
+    key_compare m_compare{};
+
+    void build(const vector<key_type>& sorted_keys, const vector<mapped_type>& values) {
+        auto n = sorted_keys.size();
+
+        // NOTE: an in-order walk of the tree visits the nodes in sorted order
+        vector<size_type> sorted_index_of_node(n);
+        size_type sorted_index = 0;
+        for (auto k = first_index(n); k != 0; k = next_index(k, n))
+            sorted_index_of_node[k - 1] = sorted_index++;
+
+        m_keys.reserve(n);
+        m_values.reserve(n);
+
+        for (size_type k = 0; k < n; ++k) {
+            m_keys.push_back(sorted_keys[sorted_index_of_node[k]]);
+            m_values.push_back(values[sorted_index_of_node[k]]);
+        }
+    }
+
+    [[nodiscard]] size_type lower_bound_index(const key_type& key) const {
+        // NOTE: all descendants of k that are 'levels_per_line' levels further down are next to each other,
+        //       fetch them now so they are in cache when the search gets there
+        constexpr size_type keys_per_line = sizeof(key_type) < 64 ? 64 / sizeof(key_type) : 1;
+
+        const key_type* keys = m_keys.data();
+        auto n = size();
+
+        size_type k = 1;
+        while (k <= n) {
+            prefetch(keys, k * keys_per_line - 1);
+            k = 2 * k + (m_compare(keys[k - 1], key) ? 1 : 0);
+        }
+
+        // NOTE: every 1 bit in k is a step to the right, the last step to the left was at the lower bound;
+        //       strip the trailing right steps and the left step itself, if there is no left step this is 0 (end)
+        return k >> (countr_one(k) + 1);
+    }
+
+    [[nodiscard]] constexpr size_type first_index() const noexcept {
+        return first_index(size());
+    }
+
+    [[nodiscard]] constexpr size_type next_index(size_type k) const noexcept {
+        return next_index(k, size());
+    }
+
+    [[nodiscard]] static constexpr size_type first_index(size_type n) noexcept {
+        if (n == 0) return 0;
+
+        size_type k = 1;
+        while (2 * k <= n)
+            k *= 2;
+        return k;
+    }
+
+    [[nodiscard]] static constexpr size_type next_index(size_type k, size_type n) noexcept {
+        // NOTE: in-order successor: leftmost node of the right subtree or else the first ancestor we are left of
+        if (2 * k + 1 <= n) {
+            k = 2 * k + 1;
+            while (2 * k <= n)
+                k *= 2;
+            return k;
+        }
+
+        return k >> (countr_one(k) + 1);
+    }
+
+    static void prefetch(const key_type* base, size_type index) {
+#if defined(__GNUC__) || defined(__clang__)
+        // NOTE: the prefetched address may be past the end, prefetches never fault, but forming such a pointer is UB,
+        //       so compute the address as an integer
+        __builtin_prefetch(reinterpret_cast<const void*>(reinterpret_cast<uintptr_t>(base) + index * sizeof(key_type)));
+#else
+        (void)base;
+        (void)index;
+#endif
+    }
+};
+
+}  // namespace lw_std
@@ -3,27 +3,1190 @@
 
 #ifdef ARDUINO
 #    include "Arduino.h"
+#    include <stdio.h>
 #else
+#    include <cstdio>
+#endif
+
+#ifdef LWSTD_BUILD_STD_COMPATIBILITY
 #    include <string>
 #endif
 
+#include "algorithm.hpp"
+#include "charconv.hpp"
+#include "impl/char_traits.hpp"
+#include "impl/iterator.hpp"
+#include "impl/member_types.hpp"
+#include "iterator.hpp"
+#include "limits.hpp"
+#include "memory.hpp"
+#include "string_view.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
 namespace lw_std {
 
+// NOTE: non-standard, the characters a basic_string keeps inline by default: the inline buffer overlays the
+//       capacity of a heap string, so 15 chars fit into a string of four words on 64-bit targets (like libstdc++)
+template <typename CharT>
+inline constexpr size_t basic_string_default_sso_capacity = 2 * sizeof(size_t) / sizeof(CharT) - 1;
+
+// basic_string https://en.cppreference.com/w/cpp/string/basic_string
+// NOTE: there is no Traits parameter, characters are handled by char_traits<CharT>;
+//       up to SsoCapacity (non-standard) characters are stored inline without a heap allocation, longer strings grow
+//       geometrically; the allocator has to be stateless, it is not stored, which keeps the string at four words
+template <typename CharT, size_t SsoCapacity = basic_string_default_sso_capacity<CharT>, typename Allocator = allocator<CharT>>
+class basic_string {
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    LWSTD_COMMON_VALUE_TYPES(CharT)
+    LWSTD_COMMON_POINTER_TYPES(CharT)
+    LWSTD_COMMON_CONTAINER_TYPES(CharT, CharT*, Allocator)
+
+    using traits_type = char_traits<CharT>;
+
+   private:
+    using view_type = basic_string_view<CharT>;
+
+   public:
+
+    // npos https://en.cppreference.com/w/cpp/string/basic_string/npos
+    static constexpr size_type npos = numeric_limits<size_type>::max();
+
+    // NOTE: non-standard, the longest string that is stored inline
+    static constexpr size_type sso_capacity = SsoCapacity;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    constexpr basic_string() noexcept {}
+
+    // (constructor) (2) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    constexpr basic_string(size_type count, value_type ch) {
+        append(count, ch);
+    }
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    constexpr basic_string(const basic_string& other, size_type pos) {
+        append(other, pos);
+    }
+
+    // (constructor) (4) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    constexpr basic_string(const basic_string& other, size_type pos, size_type count) {
+        append(other, pos, count);
+    }
+
+    // (constructor) (5) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    constexpr basic_string(const_pointer s, size_type count) {
+        init(s, count);
+    }
+
+    // (constructor) (6) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    constexpr basic_string(const_pointer s) {
+        init(s, traits_type::length(s));
+    }
+
+    // (constructor) (7) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    // NOTE: integral InputIt is excluded, so basic_string(5, 'x') picks (2)
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr basic_string(InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    // (constructor) (8) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    constexpr basic_string(const basic_string& other) {
+        init(other.data(), other.size());
+    }
+
+    // (constructor) (9) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    constexpr basic_string(basic_string&& other) noexcept {
+        take(other);
+    }
+
+    // (constructor) (10) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    // NOTE: takes the view itself instead of anything that converts to one
+    constexpr explicit basic_string(view_type sv) {
+        init(sv.data(), sv.size());
+    }
+
+    // FIXME: (constructor) (11) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+    // FIXME: (constructor) (12) https://en.cppreference.com/w/cpp/string/basic_string/basic_string
+
+#ifdef LWSTD_BUILD_STD_COMPATIBILITY
+    // NOTE: non-standard, conversion from and to std::basic_string
+    basic_string(const std::basic_string<CharT>& other)
+        : basic_string(other.data(), other.size()) {}
+
+    explicit operator std::basic_string<CharT>() const {
+        return std::basic_string<CharT>(data(), size());
+    }
+#endif
+
 #ifdef ARDUINO
+    // NOTE: non-standard, conversion from and to Arduino's String for the APIs that expect one
+    basic_string(const String& other)
+        : basic_string(other.c_str(), other.length()) {}
+
+    explicit operator String() const {
+        return String(c_str());
+    }
+#endif
+
+    // (destructor) https://en.cppreference.com/w/cpp/string/basic_string/~basic_string
+    ~basic_string() {
+        release();
+    }
+
+    // operator= (1) https://en.cppreference.com/w/cpp/string/basic_string/operator%3D
+    constexpr basic_string& operator=(const basic_string& other) {
+        if (&other != this) assign(other.data(), other.size());
+        return *this;
+    }
+
+    // operator= (2) https://en.cppreference.com/w/cpp/string/basic_string/operator%3D
+    constexpr basic_string& operator=(basic_string&& other) noexcept {
+        if (&other != this) {
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    // operator= (3) https://en.cppreference.com/w/cpp/string/basic_string/operator%3D
+    constexpr basic_string& operator=(const_pointer s) {
+        return assign(s);
+    }
+
+    // operator= (4) https://en.cppreference.com/w/cpp/string/basic_string/operator%3D
+    constexpr basic_string& operator=(value_type ch) {
+        return assign(1, ch);
+    }
+
+    // operator= (6) https://en.cppreference.com/w/cpp/string/basic_string/operator%3D
+    constexpr basic_string& operator=(view_type sv) {
+        return assign(sv.data(), sv.size());
+    }
+
+    // assign (1) https://en.cppreference.com/w/cpp/string/basic_string/assign
+    constexpr basic_string& assign(size_type count, value_type ch) {
+        clear();
+        return append(count, ch);
+    }
+
+    // assign (2) https://en.cppreference.com/w/cpp/string/basic_string/assign
+    constexpr basic_string& assign(const basic_string& str) {
+        return operator=(str);
+    }
+
+    // assign (3) https://en.cppreference.com/w/cpp/string/basic_string/assign
+    constexpr basic_string& assign(const basic_string& str, size_type pos, size_type count = npos) {
+        pos = min_of(pos, str.size());
+        return assign(str.data() + pos, min_of(count, str.size() - pos));
+    }
+
+    // assign (4) https://en.cppreference.com/w/cpp/string/basic_string/assign
+    constexpr basic_string& assign(basic_string&& str) noexcept {
+        return operator=(lw_std::move(str));
+    }
+
+    // assign (5) https://en.cppreference.com/w/cpp/string/basic_string/assign
+    constexpr basic_string& assign(const_pointer s, size_type count) {
+        return replace(0, m_size, s, count);
+    }
+
+    // assign (6) https://en.cppreference.com/w/cpp/string/basic_string/assign
+    constexpr basic_string& assign(const_pointer s) {
+        return assign(s, traits_type::length(s));
+    }
+
+    // assign (7) https://en.cppreference.com/w/cpp/string/basic_string/assign
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr basic_string& assign(InputIt first, InputIt last) {
+        return operator=(basic_string(first, last));
+    }
+
+    // assign (9) https://en.cppreference.com/w/cpp/string/basic_string/assign
+    constexpr basic_string& assign(view_type sv) {
+        return assign(sv.data(), sv.size());
+    }
+
+    // get_allocator https://en.cppreference.com/w/cpp/string/basic_string/get_allocator
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type();
+    }
+
+    /*
+        Element access
+    */
+
+    // at https://en.cppreference.com/w/cpp/string/basic_string/at
+    // NOTE: 'at' should throw if pos is out of range, but lw_std works without exceptions,
+    //       out of range it returns the terminating null character, which exists even in an empty string
+    [[nodiscard]] constexpr reference at(size_type pos) {
+        return m_data[min_of(pos, m_size)];
+    }
+
+    // at https://en.cppreference.com/w/cpp/string/basic_string/at
+    [[nodiscard]] constexpr const_reference at(size_type pos) const {
+        return m_data[min_of(pos, m_size)];
+    }
+
+    // operator[] https://en.cppreference.com/w/cpp/string/basic_string/operator_at
+    [[nodiscard]] constexpr reference operator[](size_type pos) {
+        return m_data[pos];
+    }
+
+    // operator[] https://en.cppreference.com/w/cpp/string/basic_string/operator_at
+    [[nodiscard]] constexpr const_reference operator[](size_type pos) const {
+        return m_data[pos];
+    }
+
+    // front https://en.cppreference.com/w/cpp/string/basic_string/front
+    [[nodiscard]] constexpr reference front() {
+        return m_data[0];
+    }
+
+    // front https://en.cppreference.com/w/cpp/string/basic_string/front
+    [[nodiscard]] constexpr const_reference front() const {
+        return m_data[0];
+    }
+
+    // back https://en.cppreference.com/w/cpp/string/basic_string/back
+    [[nodiscard]] constexpr reference back() {
+        return m_data[m_size - 1];
+    }
+
+    // back https://en.cppreference.com/w/cpp/string/basic_string/back
+    [[nodiscard]] constexpr const_reference back() const {
+        return m_data[m_size - 1];
+    }
+
+    // data (1) https://en.cppreference.com/w/cpp/string/basic_string/data
+    [[nodiscard]] constexpr const_pointer data() const noexcept {
+        return m_data;
+    }
+
+    // data (2) https://en.cppreference.com/w/cpp/string/basic_string/data
+    [[nodiscard]] constexpr pointer data() noexcept {
+        return m_data;
+    }
+
+    // c_str https://en.cppreference.com/w/cpp/string/basic_string/c_str
+    [[nodiscard]] constexpr const_pointer c_str() const noexcept {
+        return m_data;
+    }
+
+    // operator basic_string_view https://en.cppreference.com/w/cpp/string/basic_string/operator_basic_string_view
+    constexpr operator view_type() const noexcept {
+        return view_type(m_data, m_size);
+    }
+
+    /*
+        Iterators
+    */
+
+    // begin https://en.cppreference.com/w/cpp/string/basic_string/begin
+    [[nodiscard]] constexpr iterator begin() noexcept {
+        return iterator(m_data);
+    }
+
+    // begin https://en.cppreference.com/w/cpp/string/basic_string/begin
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return const_iterator(m_data);
+    }
+
+    // cbegin https://en.cppreference.com/w/cpp/string/basic_string/begin
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    // end https://en.cppreference.com/w/cpp/string/basic_string/end
+    [[nodiscard]] constexpr iterator end() noexcept {
+        return iterator(m_data + m_size);
+    }
+
+    // end https://en.cppreference.com/w/cpp/string/basic_string/end
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return const_iterator(m_data + m_size);
+    }
+
+    // cend https://en.cppreference.com/w/cpp/string/basic_string/end
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    // FIXME: rbegin https://en.cppreference.com/w/cpp/string/basic_string/rbegin
+    // FIXME: rend https://en.cppreference.com/w/cpp/string/basic_string/rend
+
+    /*
+        Capacity
+    */
+
+    // empty https://en.cppreference.com/w/cpp/string/basic_string/empty
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    // size https://en.cppreference.com/w/cpp/string/basic_string/size
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return m_size;
+    }
+
+    // length https://en.cppreference.com/w/cpp/string/basic_string/size
+    [[nodiscard]] constexpr size_type length() const noexcept {
+        return m_size;
+    }
+
+    // max_size https://en.cppreference.com/w/cpp/string/basic_string/max_size
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return numeric_limits<size_type>::max() / sizeof(value_type) - 1;
+    }
+
+    // reserve https://en.cppreference.com/w/cpp/string/basic_string/reserve
+    // NOTE: allocates exactly new_cap, like std::string it never shrinks (use shrink_to_fit)
+    constexpr void reserve(size_type new_cap) {
+        if (new_cap > capacity()) reallocate(new_cap);
+    }
+
+    // capacity https://en.cppreference.com/w/cpp/string/basic_string/capacity
+    [[nodiscard]] constexpr size_type capacity() const noexcept {
+        return is_inline() ? SsoCapacity : m_capacity;
+    }
+
+    // shrink_to_fit https://en.cppreference.com/w/cpp/string/basic_string/shrink_to_fit
+    // NOTE: a string that fits moves back into the inline buffer
+    constexpr void shrink_to_fit() {
+        if (!is_inline() && m_capacity > m_size) reallocate(m_size);
+    }
+
+    /*
+        Operations
+    */
+
+    // clear https://en.cppreference.com/w/cpp/string/basic_string/clear
+    // NOTE: keeps the capacity
+    constexpr void clear() noexcept {
+        m_size = 0;
+        m_data[0] = value_type();
+    }
+
+    // insert (1) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    constexpr basic_string& insert(size_type index, size_type count, value_type ch) {
+        return replace(index, 0, count, ch);
+    }
+
+    // insert (2) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    constexpr basic_string& insert(size_type index, const_pointer s) {
+        return replace(index, 0, s);
+    }
+
+    // insert (3) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    constexpr basic_string& insert(size_type index, const_pointer s, size_type count) {
+        return replace(index, 0, s, count);
+    }
+
+    // insert (4) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    constexpr basic_string& insert(size_type index, const basic_string& str) {
+        return replace(index, 0, str);
+    }
+
+    // insert (5) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    constexpr basic_string& insert(size_type index, const basic_string& str, size_type index_str, size_type count = npos) {
+        return replace(index, 0, str, index_str, count);
+    }
+
+    // insert (6) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    constexpr iterator insert(const_iterator pos, value_type ch) {
+        auto index = index_from_iterator(pos);
+        replace(index, 0, 1, ch);
+        return iterator(m_data + index);
+    }
+
+    // insert (7) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    constexpr iterator insert(const_iterator pos, size_type count, value_type ch) {
+        auto index = index_from_iterator(pos);
+        replace(index, 0, count, ch);
+        return iterator(m_data + index);
+    }
+
+    // insert (8) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        auto index = index_from_iterator(pos);
+        insert(index, basic_string(first, last));
+        return iterator(m_data + index);
+    }
+
+    // FIXME: insert (9) https://en.cppreference.com/w/cpp/string/basic_string/insert
+
+    // insert (10) https://en.cppreference.com/w/cpp/string/basic_string/insert
+    constexpr basic_string& insert(size_type pos, view_type sv) {
+        return replace(pos, 0, sv.data(), sv.size());
+    }
+
+    // erase (1) https://en.cppreference.com/w/cpp/string/basic_string/erase
+    constexpr basic_string& erase(size_type index = 0, size_type count = npos) {
+        return replace(index, count, const_pointer(nullptr), 0);
+    }
+
+    // erase (2) https://en.cppreference.com/w/cpp/string/basic_string/erase
+    constexpr iterator erase(const_iterator position) {
+        auto index = index_from_iterator(position);
+        erase(index, 1);
+        return iterator(m_data + index);
+    }
+
+    // erase (3) https://en.cppreference.com/w/cpp/string/basic_string/erase
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        auto index = index_from_iterator(first);
+        erase(index, index_from_iterator(last) - index);
+        return iterator(m_data + index);
+    }
+
+    // push_back https://en.cppreference.com/w/cpp/string/basic_string/push_back
+    constexpr void push_back(value_type ch) {
+        if (m_size == capacity()) reallocate(grown_capacity(m_size + 1));
+
+        m_data[m_size] = ch;
+        m_data[++m_size] = value_type();
+    }
+
+    // pop_back https://en.cppreference.com/w/cpp/string/basic_string/pop_back
+    constexpr void pop_back() {
+        m_data[--m_size] = value_type();
+    }
+
+    // append (1) https://en.cppreference.com/w/cpp/string/basic_string/append
+    constexpr basic_string& append(size_type count, value_type ch) {
+        return replace(m_size, 0, count, ch);
+    }
+
+    // append (2) https://en.cppreference.com/w/cpp/string/basic_string/append
+    constexpr basic_string& append(const basic_string& str) {
+        return append(str.data(), str.size());
+    }
+
+    // append (3) https://en.cppreference.com/w/cpp/string/basic_string/append
+    constexpr basic_string& append(const basic_string& str, size_type pos, size_type count = npos) {
+        pos = min_of(pos, str.size());
+        return append(str.data() + pos, min_of(count, str.size() - pos));
+    }
+
+    // append (4) https://en.cppreference.com/w/cpp/string/basic_string/append
+    constexpr basic_string& append(const_pointer s, size_type count) {
+        return replace(m_size, 0, s, count);
+    }
+
+    // append (5) https://en.cppreference.com/w/cpp/string/basic_string/append
+    constexpr basic_string& append(const_pointer s) {
+        return append(s, traits_type::length(s));
+    }
+
+    // append (6) https://en.cppreference.com/w/cpp/string/basic_string/append
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr basic_string& append(InputIt first, InputIt last) {
+        // NOTE: the range may be part of this string, so it is collected first
+        return append(basic_string(first, last));
+    }
+
+    // FIXME: append (7) https://en.cppreference.com/w/cpp/string/basic_string/append
+
+    // append (8) https://en.cppreference.com/w/cpp/string/basic_string/append
+    constexpr basic_string& append(view_type sv) {
+        return append(sv.data(), sv.size());
+    }
+
+    // operator+= (1) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D
+    constexpr basic_string& operator+=(const basic_string& str) {
+        return append(str);
+    }
+
+    // operator+= (2) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D
+    constexpr basic_string& operator+=(value_type ch) {
+        push_back(ch);
+        return *this;
+    }
+
+    // operator+= (3) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D
+    constexpr basic_string& operator+=(const_pointer s) {
+        return append(s);
+    }
+
+    // FIXME: operator+= (4) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D
+
+    // operator+= (5) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D
+    constexpr basic_string& operator+=(view_type sv) {
+        return append(sv);
+    }
+
+    // compare (1) https://en.cppreference.com/w/cpp/string/basic_string/compare
+    [[nodiscard]] constexpr int compare(const basic_string& str) const noexcept {
+        return view_type(*this).compare(str);
+    }
+
+    // compare (2) https://en.cppreference.com/w/cpp/string/basic_string/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, const basic_string& str) const {
+        return compare(pos1, count1, str.data(), str.size());
+    }
+
+    // compare (3) https://en.cppreference.com/w/cpp/string/basic_string/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, const basic_string& str, size_type pos2, size_type count2 = npos) const {
+        pos2 = min_of(pos2, str.size());
+        return compare(pos1, count1, str.data() + pos2, min_of(count2, str.size() - pos2));
+    }
+
+    // compare (4) https://en.cppreference.com/w/cpp/string/basic_string/compare
+    [[nodiscard]] constexpr int compare(const_pointer s) const {
+        return view_type(*this).compare(s);
+    }
+
+    // compare (5) https://en.cppreference.com/w/cpp/string/basic_string/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, const_pointer s) const {
+        return view_type(*this).compare(pos1, count1, s);
+    }
+
+    // compare (6) https://en.cppreference.com/w/cpp/string/basic_string/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, const_pointer s, size_type count2) const {
+        return view_type(*this).compare(pos1, count1, s, count2);
+    }
+
+    // compare (7) https://en.cppreference.com/w/cpp/string/basic_string/compare
+    [[nodiscard]] constexpr int compare(view_type sv) const noexcept {
+        return view_type(*this).compare(sv);
+    }
+
+    // compare (8) https://en.cppreference.com/w/cpp/string/basic_string/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, view_type sv) const {
+        return view_type(*this).compare(pos1, count1, sv);
+    }
+
+    // FIXME: compare (9) https://en.cppreference.com/w/cpp/string/basic_string/compare
+
+    // starts_with (1) https://en.cppreference.com/w/cpp/string/basic_string/starts_with
+    [[nodiscard]] constexpr bool starts_with(view_type sv) const noexcept {
+        return view_type(*this).starts_with(sv);
+    }
+
+    // starts_with (2) https://en.cppreference.com/w/cpp/string/basic_string/starts_with
+    [[nodiscard]] constexpr bool starts_with(value_type ch) const noexcept {
+        return m_size > 0 && m_data[0] == ch;
+    }
 
-// lw_std string delegates to Arduino String
-using string = String;
-template <typename T>
-inline string to_string(T t) {
-    return String(t);
+    // starts_with (3) https://en.cppreference.com/w/cpp/string/basic_string/starts_with
+    [[nodiscard]] constexpr bool starts_with(const_pointer s) const {
+        return view_type(*this).starts_with(s);
+    }
+
+    // ends_with (1) https://en.cppreference.com/w/cpp/string/basic_string/ends_with
+    [[nodiscard]] constexpr bool ends_with(view_type sv) const noexcept {
+        return view_type(*this).ends_with(sv);
+    }
+
+    // ends_with (2) https://en.cppreference.com/w/cpp/string/basic_string/ends_with
+    [[nodiscard]] constexpr bool ends_with(value_type ch) const noexcept {
+        return m_size > 0 && m_data[m_size - 1] == ch;
+    }
+
+    // ends_with (3) https://en.cppreference.com/w/cpp/string/basic_string/ends_with
+    [[nodiscard]] constexpr bool ends_with(const_pointer s) const {
+        return view_type(*this).ends_with(s);
+    }
+
+    // contains (1) https://en.cppreference.com/w/cpp/string/basic_string/contains
+    [[nodiscard]] constexpr bool contains(view_type sv) const noexcept {
+        return find(sv) != npos;
+    }
+
+    // contains (2) https://en.cppreference.com/w/cpp/string/basic_string/contains
+    [[nodiscard]] constexpr bool contains(value_type ch) const noexcept {
+        return find(ch) != npos;
+    }
+
+    // contains (3) https://en.cppreference.com/w/cpp/string/basic_string/contains
+    [[nodiscard]] constexpr bool contains(const_pointer s) const {
+        return find(s) != npos;
+    }
+
+    // replace (1) https://en.cppreference.com/w/cpp/string/basic_string/replace
+    constexpr basic_string& replace(size_type pos, size_type count, const basic_string& str) {
+        return replace(pos, count, str.data(), str.size());
+    }
+
+    // replace (2) https://en.cppreference.com/w/cpp/string/basic_string/replace
+    constexpr basic_string& replace(size_type pos, size_type count, const basic_string& str, size_type pos2, size_type count2 = npos) {
+        pos2 = min_of(pos2, str.size());
+        return replace(pos, count, str.data() + pos2, min_of(count2, str.size() - pos2));
+    }
+
+    // FIXME: replace (3) https://en.cppreference.com/w/cpp/string/basic_string/replace
+
+    // replace (4) https://en.cppreference.com/w/cpp/string/basic_string/replace
+    // NOTE: no exceptions, pos past the end is clamped to the end; s may point into this string
+    constexpr basic_string& replace(size_type pos, size_type count, const_pointer s, size_type count2) {
+        pos = min_of(pos, m_size);
+        count = min_of(count, m_size - pos);
+
+        if (is_inside(s)) {
+            basic_string copy(s, count2);
+            return replace(pos, count, copy.data(), count2);
+        }
+
+        traits_type::copy(open_gap(pos, count, count2), s, count2);
+        return *this;
+    }
+
+    // replace (5) https://en.cppreference.com/w/cpp/string/basic_string/replace
+    constexpr basic_string& replace(size_type pos, size_type count, const_pointer s) {
+        return replace(pos, count, s, traits_type::length(s));
+    }
+
+    // replace (6) https://en.cppreference.com/w/cpp/string/basic_string/replace
+    constexpr basic_string& replace(size_type pos, size_type count, size_type count2, value_type ch) {
+        pos = min_of(pos, m_size);
+        count = min_of(count, m_size - pos);
+
+        traits_type::assign(open_gap(pos, count, count2), count2, ch);
+        return *this;
+    }
+
+    // FIXME: replace (7) https://en.cppreference.com/w/cpp/string/basic_string/replace
+
+    // replace (8) https://en.cppreference.com/w/cpp/string/basic_string/replace
+    constexpr basic_string& replace(size_type pos, size_type count, view_type sv) {
+        return replace(pos, count, sv.data(), sv.size());
+    }
+
+    // FIXME: replace (9) https://en.cppreference.com/w/cpp/string/basic_string/replace
+
+    // substr https://en.cppreference.com/w/cpp/string/basic_string/substr
+    [[nodiscard]] constexpr basic_string substr(size_type pos = 0, size_type count = npos) const {
+        return basic_string(*this, pos, count);
+    }
+
+    // copy https://en.cppreference.com/w/cpp/string/basic_string/copy
+    constexpr size_type copy(pointer dest, size_type count, size_type pos = 0) const {
+        pos = min_of(pos, m_size);
+        count = min_of(count, m_size - pos);
+        traits_type::copy(dest, m_data + pos, count);
+        return count;
+    }
+
+    // resize (1) https://en.cppreference.com/w/cpp/string/basic_string/resize
+    constexpr void resize(size_type count) {
+        resize(count, value_type());
+    }
+
+    // resize (2) https://en.cppreference.com/w/cpp/string/basic_string/resize
+    constexpr void resize(size_type count, value_type ch) {
+        if (count > m_size)
+            append(count - m_size, ch);
+        else
+            erase(count);
+    }
+
+    // FIXME: resize_and_overwrite https://en.cppreference.com/w/cpp/string/basic_string/resize_and_overwrite
+
+    // swap https://en.cppreference.com/w/cpp/string/basic_string/swap
+    constexpr void swap(basic_string& other) noexcept {
+        basic_string temp(lw_std::move(other));
+        other = lw_std::move(*this);
+        *this = lw_std::move(temp);
+    }
+
+    /*
+        Search
+    */
+
+    // NOTE: the searches are the ones of basic_string_view
+
+    // find (1) https://en.cppreference.com/w/cpp/string/basic_string/find
+    [[nodiscard]] constexpr size_type find(const basic_string& str, size_type pos = 0) const noexcept {
+        return view_type(*this).find(view_type(str), pos);
+    }
+
+    // find (2) https://en.cppreference.com/w/cpp/string/basic_string/find
+    [[nodiscard]] constexpr size_type find(const_pointer s, size_type pos, size_type count) const {
+        return view_type(*this).find(s, pos, count);
+    }
+
+    // find (3) https://en.cppreference.com/w/cpp/string/basic_string/find
+    [[nodiscard]] constexpr size_type find(const_pointer s, size_type pos = 0) const {
+        return view_type(*this).find(s, pos);
+    }
+
+    // find (4) https://en.cppreference.com/w/cpp/string/basic_string/find
+    [[nodiscard]] constexpr size_type find(value_type ch, size_type pos = 0) const noexcept {
+        return view_type(*this).find(ch, pos);
+    }
+
+    // find (5) https://en.cppreference.com/w/cpp/string/basic_string/find
+    [[nodiscard]] constexpr size_type find(view_type sv, size_type pos = 0) const noexcept {
+        return view_type(*this).find(sv, pos);
+    }
+
+    // rfind (1) https://en.cppreference.com/w/cpp/string/basic_string/rfind
+    [[nodiscard]] constexpr size_type rfind(const basic_string& str, size_type pos = npos) const noexcept {
+        return view_type(*this).rfind(view_type(str), pos);
+    }
+
+    // rfind (2) https://en.cppreference.com/w/cpp/string/basic_string/rfind
+    [[nodiscard]] constexpr size_type rfind(const_pointer s, size_type pos, size_type count) const {
+        return view_type(*this).rfind(s, pos, count);
+    }
+
+    // rfind (3) https://en.cppreference.com/w/cpp/string/basic_string/rfind
+    [[nodiscard]] constexpr size_type rfind(const_pointer s, size_type pos = npos) const {
+        return view_type(*this).rfind(s, pos);
+    }
+
+    // rfind (4) https://en.cppreference.com/w/cpp/string/basic_string/rfind
+    [[nodiscard]] constexpr size_type rfind(value_type ch, size_type pos = npos) const noexcept {
+        return view_type(*this).rfind(ch, pos);
+    }
+
+    // rfind (5) https://en.cppreference.com/w/cpp/string/basic_string/rfind
+    [[nodiscard]] constexpr size_type rfind(view_type sv, size_type pos = npos) const noexcept {
+        return view_type(*this).rfind(sv, pos);
+    }
+
+    // find_first_of (1) https://en.cppreference.com/w/cpp/string/basic_string/find_first_of
+    [[nodiscard]] constexpr size_type find_first_of(const basic_string& str, size_type pos = 0) const noexcept {
+        return view_type(*this).find_first_of(view_type(str), pos);
+    }
+
+    // find_first_of (2) https://en.cppreference.com/w/cpp/string/basic_string/find_first_of
+    [[nodiscard]] constexpr size_type find_first_of(const_pointer s, size_type pos, size_type count) const {
+        return view_type(*this).find_first_of(s, pos, count);
+    }
+
+    // find_first_of (3) https://en.cppreference.com/w/cpp/string/basic_string/find_first_of
+    [[nodiscard]] constexpr size_type find_first_of(const_pointer s, size_type pos = 0) const {
+        return view_type(*this).find_first_of(s, pos);
+    }
+
+    // find_first_of (4) https://en.cppreference.com/w/cpp/string/basic_string/find_first_of
+    [[nodiscard]] constexpr size_type find_first_of(value_type ch, size_type pos = 0) const noexcept {
+        return view_type(*this).find_first_of(ch, pos);
+    }
+
+    // find_first_of (5) https://en.cppreference.com/w/cpp/string/basic_string/find_first_of
+    [[nodiscard]] constexpr size_type find_first_of(view_type sv, size_type pos = 0) const noexcept {
+        return view_type(*this).find_first_of(sv, pos);
+    }
+
+    // find_first_not_of (1) https://en.cppreference.com/w/cpp/string/basic_string/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(const basic_string& str, size_type pos = 0) const noexcept {
+        return view_type(*this).find_first_not_of(view_type(str), pos);
+    }
+
+    // find_first_not_of (2) https://en.cppreference.com/w/cpp/string/basic_string/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(const_pointer s, size_type pos, size_type count) const {
+        return view_type(*this).find_first_not_of(s, pos, count);
+    }
+
+    // find_first_not_of (3) https://en.cppreference.com/w/cpp/string/basic_string/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(const_pointer s, size_type pos = 0) const {
+        return view_type(*this).find_first_not_of(s, pos);
+    }
+
+    // find_first_not_of (4) https://en.cppreference.com/w/cpp/string/basic_string/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(value_type ch, size_type pos = 0) const noexcept {
+        return view_type(*this).find_first_not_of(ch, pos);
+    }
+
+    // find_first_not_of (5) https://en.cppreference.com/w/cpp/string/basic_string/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(view_type sv, size_type pos = 0) const noexcept {
+        return view_type(*this).find_first_not_of(sv, pos);
+    }
+
+    // find_last_of (1) https://en.cppreference.com/w/cpp/string/basic_string/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(const basic_string& str, size_type pos = npos) const noexcept {
+        return view_type(*this).find_last_of(view_type(str), pos);
+    }
+
+    // find_last_of (2) https://en.cppreference.com/w/cpp/string/basic_string/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(const_pointer s, size_type pos, size_type count) const {
+        return view_type(*this).find_last_of(s, pos, count);
+    }
+
+    // find_last_of (3) https://en.cppreference.com/w/cpp/string/basic_string/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(const_pointer s, size_type pos = npos) const {
+        return view_type(*this).find_last_of(s, pos);
+    }
+
+    // find_last_of (4) https://en.cppreference.com/w/cpp/string/basic_string/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(value_type ch, size_type pos = npos) const noexcept {
+        return view_type(*this).find_last_of(ch, pos);
+    }
+
+    // find_last_of (5) https://en.cppreference.com/w/cpp/string/basic_string/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(view_type sv, size_type pos = npos) const noexcept {
+        return view_type(*this).find_last_of(sv, pos);
+    }
+
+    // find_last_not_of (1) https://en.cppreference.com/w/cpp/string/basic_string/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(const basic_string& str, size_type pos = npos) const noexcept {
+        return view_type(*this).find_last_not_of(view_type(str), pos);
+    }
+
+    // find_last_not_of (2) https://en.cppreference.com/w/cpp/string/basic_string/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(const_pointer s, size_type pos, size_type count) const {
+        return view_type(*this).find_last_not_of(s, pos, count);
+    }
+
+    // find_last_not_of (3) https://en.cppreference.com/w/cpp/string/basic_string/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(const_pointer s, size_type pos = npos) const {
+        return view_type(*this).find_last_not_of(s, pos);
+    }
+
+    // find_last_not_of (4) https://en.cppreference.com/w/cpp/string/basic_string/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(value_type ch, size_type pos = npos) const noexcept {
+        return view_type(*this).find_last_not_of(ch, pos);
+    }
+
+    // find_last_not_of (5) https://en.cppreference.com/w/cpp/string/basic_string/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(view_type sv, size_type pos = npos) const noexcept {
+        return view_type(*this).find_last_not_of(sv, pos);
+    }
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def {
+        friend basic_string;
+
+       protected:
+        typedef P value_type;
+        typedef IT_P data_type;
+        typedef random_access_iterator_tag iterator_category;
+
+        constexpr iterator_def() = default;
+
+        constexpr iterator_def(const IT_P& data)
+            : m_data(data) {}
+
+        template <typename Q, typename IT_Q>
+        constexpr iterator_def(const iterator_def<Q, IT_Q>& other)
+            : m_data(other.m_data) {}
+
+        [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
+            return m_data == other.m_data;
+        }
+
+        [[nodiscard]] constexpr P* get() {
+            return m_data;
+        }
+
+        [[nodiscard]] constexpr const P* get() const {
+            return m_data;
+        }
+
+        constexpr void advance(ptrdiff_t n) {
+            m_data += n;
+        }
+
+        [[nodiscard]] constexpr ptrdiff_t distance_to(const iterator_def& other) const {
+            return other.m_data - m_data;
+        }
+
+       private:
+        IT_P m_data{nullptr};
+    };
+
+    // NOTE: m_data points either into the inline buffer or to the heap, so reads never branch on the mode;
+    //       the inline buffer and the heap capacity share their storage, the mode is m_data == m_local
+    pointer m_data{m_local};
+    size_type m_size{0};
+    union {
+        size_type m_capacity;
+        value_type m_local[SsoCapacity + 1] = {};
+    };
+
+    [[nodiscard]] constexpr bool is_inline() const noexcept {
+        return m_data == m_local;
+    }
+
+    // NOTE: grow geometrically, so n push_backs or appends cost O(n) copied characters in total
+    [[nodiscard]] constexpr size_type grown_capacity(size_type min_capacity) const {
+        return max_of(min_capacity, 2 * capacity());
+    }
+
+    // NOTE: moves the characters into a buffer for new_cap characters (inline if they fit), new_cap >= m_size
+    constexpr void reallocate(size_type new_cap) {
+        if (new_cap <= SsoCapacity) {
+            if (is_inline()) return;
+
+            // NOTE: m_capacity shares its bytes with the inline buffer, read it before the characters move in
+            pointer heap = m_data;
+            size_type heap_capacity = m_capacity;
+            traits_type::copy(m_local, heap, m_size + 1);
+            allocator_type().deallocate(heap, heap_capacity + 1);
+            m_data = m_local;
+            return;
+        }
+
+        pointer new_data = allocator_type().allocate(new_cap + 1);
+        traits_type::copy(new_data, m_data, m_size + 1);
+        release();
+        m_data = new_data;
+        m_capacity = new_cap;
+    }
+
+    // NOTE: replaces count characters at pos by a gap of count2 uninitialized characters and returns it;
+    //       every character behind the gap is moved once and the storage is reallocated at most once
+    [[nodiscard]] constexpr pointer open_gap(size_type pos, size_type count, size_type count2) {
+        size_type new_size = m_size - count + count2;
+        size_type tail = m_size - pos - count + 1;  // including the terminator
+
+        if (new_size > capacity()) {
+            size_type new_cap = grown_capacity(new_size);
+            pointer new_data = allocator_type().allocate(new_cap + 1);
+            traits_type::copy(new_data, m_data, pos);
+            traits_type::copy(new_data + pos + count2, m_data + pos + count, tail);
+            release();
+            m_data = new_data;
+            m_capacity = new_cap;
+        } else if (count != count2) {
+            traits_type::move(m_data + pos + count2, m_data + pos + count, tail);
+        }
+
+        m_size = new_size;
+        return m_data + pos;
+    }
+
+    // NOTE: constructors only, allocates exactly count characters if they don't fit inline
+    constexpr void init(const_pointer s, size_type count) {
+        if (count > SsoCapacity) {
+            m_data = allocator_type().allocate(count + 1);
+            m_capacity = count;
+        }
+
+        traits_type::copy(m_data, s, count);
+        m_data[count] = value_type();
+        m_size = count;
+    }
+
+    // NOTE: takes over the characters of other, which is left empty; this must not own a heap buffer
+    constexpr void take(basic_string& other) noexcept {
+        if (other.is_inline()) {
+            traits_type::copy(m_local, other.m_local, other.m_size + 1);
+            m_data = m_local;
+        } else {
+            m_data = other.m_data;
+            m_capacity = other.m_capacity;
+        }
+        m_size = other.m_size;
+
+        other.m_data = other.m_local;
+        other.m_size = 0;
+        other.m_local[0] = value_type();
+    }
+
+    constexpr void release() noexcept {
+        if (!is_inline()) allocator_type().deallocate(m_data, m_capacity + 1);
+    }
+
+    [[nodiscard]] bool is_inside(const_pointer p) const {
+        // NOTE: comparing pointers into different arrays is unspecified, so compare the addresses
+        auto address = reinterpret_cast<uintptr_t>(p);
+        return address >= reinterpret_cast<uintptr_t>(m_data) && address <= reinterpret_cast<uintptr_t>(m_data + m_size);
+    }
+
+    [[nodiscard]] constexpr size_type index_from_iterator(const const_iterator& it) const {
+        return static_cast<size_type>(it.m_data - m_data);
+    }
 };
 
-#else
+// string https://en.cppreference.com/w/cpp/string/basic_string
+using string = basic_string<char>;
+
+// wstring https://en.cppreference.com/w/cpp/string/basic_string
+using wstring = basic_string<wchar_t>;
+
+// u16string https://en.cppreference.com/w/cpp/string/basic_string
+using u16string = basic_string<char16_t>;
 
-// lw_std string delegates to std::string
-using string = std::string;
-using std::to_string;
+// u32string https://en.cppreference.com/w/cpp/string/basic_string
+using u32string = basic_string<char32_t>;
 
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// operator+ (1) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(const basic_string<CharT, N, Allocator>& lhs, const basic_string<CharT, N, Allocator>& rhs) {
+    basic_string<CharT, N, Allocator> res;
+    res.reserve(lhs.size() + rhs.size());
+    return lw_std::move(res.append(lhs).append(rhs));
+}
+
+// operator+ (2) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(const basic_string<CharT, N, Allocator>& lhs, const CharT* rhs) {
+    basic_string<CharT, N, Allocator> res(lhs);
+    return lw_std::move(res.append(rhs));
+}
+
+// operator+ (3) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(const basic_string<CharT, N, Allocator>& lhs, CharT rhs) {
+    basic_string<CharT, N, Allocator> res(lhs);
+    res.push_back(rhs);
+    return res;
+}
+
+// operator+ (5) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(const CharT* lhs, const basic_string<CharT, N, Allocator>& rhs) {
+    basic_string<CharT, N, Allocator> res(lhs);
+    return lw_std::move(res.append(rhs));
+}
+
+// operator+ (6) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(CharT lhs, const basic_string<CharT, N, Allocator>& rhs) {
+    basic_string<CharT, N, Allocator> res(1, lhs);
+    return lw_std::move(res.append(rhs));
+}
+
+// operator+ (8) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+// NOTE: the rvalue overloads append in place, so a chain a + b + c reuses one buffer
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(basic_string<CharT, N, Allocator>&& lhs, const basic_string<CharT, N, Allocator>& rhs) {
+    return lw_std::move(lhs.append(rhs));
+}
+
+// operator+ (9) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(basic_string<CharT, N, Allocator>&& lhs, const CharT* rhs) {
+    return lw_std::move(lhs.append(rhs));
+}
+
+// operator+ (10) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(basic_string<CharT, N, Allocator>&& lhs, CharT rhs) {
+    lhs.push_back(rhs);
+    return lw_std::move(lhs);
+}
+
+// operator+ (12) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(const basic_string<CharT, N, Allocator>& lhs, basic_string<CharT, N, Allocator>&& rhs) {
+    return lw_std::move(rhs.insert(0, lhs));
+}
+
+// operator+ (15) https://en.cppreference.com/w/cpp/string/basic_string/operator%2B
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr basic_string<CharT, N, Allocator> operator+(basic_string<CharT, N, Allocator>&& lhs, basic_string<CharT, N, Allocator>&& rhs) {
+    return lw_std::move(lhs.append(rhs));
+}
+
+// operator== (1) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator==(const basic_string<CharT, N, Allocator>& lhs, const basic_string<CharT, N, Allocator>& rhs) noexcept {
+    return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+}
+
+// operator!= (2) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator!=(const basic_string<CharT, N, Allocator>& lhs, const basic_string<CharT, N, Allocator>& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+// operator< (3) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator<(const basic_string<CharT, N, Allocator>& lhs, const basic_string<CharT, N, Allocator>& rhs) noexcept {
+    return lhs.compare(rhs) < 0;
+}
+
+// operator<= (4) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator<=(const basic_string<CharT, N, Allocator>& lhs, const basic_string<CharT, N, Allocator>& rhs) noexcept {
+    return lhs.compare(rhs) <= 0;
+}
+
+// operator> (5) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator>(const basic_string<CharT, N, Allocator>& lhs, const basic_string<CharT, N, Allocator>& rhs) noexcept {
+    return lhs.compare(rhs) > 0;
+}
+
+// operator>= (6) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator>=(const basic_string<CharT, N, Allocator>& lhs, const basic_string<CharT, N, Allocator>& rhs) noexcept {
+    return lhs.compare(rhs) >= 0;
+}
+
+// operator== (8) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator==(const basic_string<CharT, N, Allocator>& lhs, const CharT* rhs) {
+    return lhs.compare(rhs) == 0;
+}
+
+// operator== (8) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator==(const CharT* lhs, const basic_string<CharT, N, Allocator>& rhs) {
+    return rhs.compare(lhs) == 0;
+}
+
+// operator!= (9) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator!=(const basic_string<CharT, N, Allocator>& lhs, const CharT* rhs) {
+    return lhs.compare(rhs) != 0;
+}
+
+// operator!= (9) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator!=(const CharT* lhs, const basic_string<CharT, N, Allocator>& rhs) {
+    return rhs.compare(lhs) != 0;
+}
+
+// operator< (10) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator<(const basic_string<CharT, N, Allocator>& lhs, const CharT* rhs) {
+    return lhs.compare(rhs) < 0;
+}
+
+// operator< (10) https://en.cppreference.com/w/cpp/string/basic_string/operator_cmp
+template <typename CharT, size_t N, typename Allocator>
+[[nodiscard]] constexpr bool operator<(const CharT* lhs, const basic_string<CharT, N, Allocator>& rhs) {
+    return rhs.compare(lhs) > 0;
+}
+
+// NOTE: no extra specialization: swap https://en.cppreference.com/w/cpp/string/basic_string/swap2
+// NOTE: erase and erase_if https://en.cppreference.com/w/cpp/string/basic_string/erase2 are the common ones of "algorithm.hpp"
+
+// to_string https://en.cppreference.com/w/cpp/string/basic_string/to_string
+// NOTE: integers go through to_chars into a buffer on the stack, no printf;
+//       the unary + promotes bools and chars to int, like the int overload of std::to_string does for them
+template <typename T, typename = enable_if_t<is_integral_v<T>>>
+[[nodiscard]] string to_string(T value) {
+    char buffer[3 * sizeof(T) + 2];
+    auto res = to_chars(buffer, buffer + sizeof(buffer), +value);
+    return string(buffer, static_cast<size_t>(res.ptr - buffer));
+}
+
+// to_string https://en.cppreference.com/w/cpp/string/basic_string/to_string
+// NOTE: "%f" like std::to_string, Arduino's printf lacks floating point on AVR, so it goes through String there
+[[nodiscard]] inline string to_string(double value) {
+#ifdef ARDUINO
+    return string(String(value));
+#else
+    char buffer[320];
+    int count = snprintf(buffer, sizeof(buffer), "%f", value);
+    return string(buffer, count > 0 ? static_cast<size_t>(count) : 0);
 #endif
+}
+
+// to_string https://en.cppreference.com/w/cpp/string/basic_string/to_string
+[[nodiscard]] inline string to_string(float value) {
+    return to_string(static_cast<double>(value));
+}
 
-}  // namespace lw_std
+}  // namespace lw_std
\ No newline at end of file
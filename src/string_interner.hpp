@@ -0,0 +1,298 @@
+// string_interner header (non-standard)
+#pragma once
+
+#ifdef ARDUINO
+#    include <string.h>
+#else
+#    include <cstring>
+#endif
+
+#include "algorithm.hpp"
+#include "bit.hpp"
+#include "functional.hpp"
+#include "limits.hpp"
+#include "memory.hpp"
+#include "string_view.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace lw_std {
+
+class string_interner;
+
+namespace impl {
+
+// NOTE: in front of the characters of every interned string, in the arena of its interner
+struct interned_header {
+    size_t hash;
+    uint32_t size;
+    uint32_t id;
+
+    [[nodiscard]] const char* chars() const {
+        return reinterpret_cast<const char*>(this + 1);
+    }
+};
+
+}  // namespace impl
+
+// NOTE: non-standard, a handle to a string of a string_interner: one pointer, compared by address in O(1), carrying
+//       the hash of its string, so it keys an unordered_map without hashing or comparing characters;
+//       a default constructed handle refers to no string, a handle is valid as long as its interner (until clear)
+class interned_string {
+   public:
+    constexpr interned_string() noexcept = default;
+
+    [[nodiscard]] string_view view() const noexcept {
+        return m_header == nullptr ? string_view() : string_view(m_header->chars(), m_header->size);
+    }
+
+    operator string_view() const noexcept {
+        return view();
+    }
+
+    // NOTE: null terminated, "" for a default constructed handle
+    [[nodiscard]] const char* c_str() const noexcept {
+        return m_header == nullptr ? "" : m_header->chars();
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return m_header == nullptr ? 0 : m_header->size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    // NOTE: returned by id for a default constructed handle
+    static constexpr uint32_t invalid_id = numeric_limits<uint32_t>::max();
+
+    // NOTE: the strings of an interner are numbered 0, 1, 2, ... in the order they were interned,
+    //       a compact key for arrays or serialization, string_interner::from_id gives the handle back;
+    //       invalid_id for a default constructed handle
+    [[nodiscard]] uint32_t id() const noexcept {
+        return m_header == nullptr ? invalid_id : m_header->id;
+    }
+
+    // NOTE: computed once when the string was interned, the same as hash<string_view> of its characters
+    [[nodiscard]] size_t hash() const noexcept {
+        return m_header == nullptr ? 0 : m_header->hash;
+    }
+
+    // NOTE: whether the handle refers to a string
+    explicit operator bool() const noexcept {
+        return m_header != nullptr;
+    }
+
+    [[nodiscard]] friend bool operator==(const interned_string& lhs, const interned_string& rhs) noexcept {
+        return lhs.m_header == rhs.m_header;
+    }
+
+    [[nodiscard]] friend bool operator!=(const interned_string& lhs, const interned_string& rhs) noexcept {
+        return lhs.m_header != rhs.m_header;
+    }
+
+   private:
+    friend string_interner;
+
+    explicit interned_string(const impl::interned_header* header)
+        : m_header(header) {}
+
+    const impl::interned_header* m_header{nullptr};
+};
+
+// NOTE: equal_to<interned_string> is the common one, it compares the handles
+template <>
+struct hash<interned_string> {
+    typedef interned_string argument_type;
+    typedef size_t result_type;
+
+    [[nodiscard]] size_t operator()(const argument_type& key) const noexcept {
+        return key.hash();
+    }
+};
+
+// NOTE: non-standard, stores each distinct string once, for keys that repeat all the time (e.g. telemetry names):
+//       the strings are packed one after the other into large blocks that never move, each behind a small header
+//       with its hash, length and id, and found again through an open addressing table of header pointers;
+//       interning hashes the string once, every later comparison or hash of its handle is O(1);
+//       strings are never removed one by one, clear frees all of them; not thread safe
+class string_interner {
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using size_type = size_t;
+
+    // NOTE: bytes per arena block, longer strings get a block of their own
+    static constexpr size_type default_block_size = 4096;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    explicit string_interner(size_type block_size = default_block_size)
+        : m_block_words(max_of(words_for(block_size), size_type{8})) {}
+
+    // NOTE: the handles point into the arena, so the interner can't be copied or moved
+    string_interner(const string_interner&) = delete;
+    string_interner& operator=(const string_interner&) = delete;
+
+    ~string_interner() {
+        release();
+    }
+
+    /*
+        Capacity
+    */
+
+    // NOTE: the number of distinct strings
+    [[nodiscard]] size_type size() const noexcept {
+        return m_by_id.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return m_by_id.empty();
+    }
+
+    // NOTE: the bytes allocated for the arena blocks, without the tables
+    [[nodiscard]] size_type arena_bytes() const noexcept {
+        size_type res = 0;
+        for (const auto& b : m_blocks)
+            res += b.words * sizeof(size_t);
+        return res;
+    }
+
+    // NOTE: makes room for count distinct strings in the tables, the arena grows block by block anyway
+    void reserve(size_type count) {
+        m_by_id.reserve(count);
+        if (2 * count > m_slots.size()) rehash(bit_ceil(2 * count));
+    }
+
+    /*
+        Lookup
+    */
+
+    // NOTE: the handle of s, or a default constructed one if s was never interned
+    [[nodiscard]] interned_string find(string_view s) const {
+        if (m_slots.empty()) return interned_string();
+
+        size_t hash = impl::hash_bytes(s.data(), s.size());
+        return interned_string(m_slots[find_slot(s, hash)]);
+    }
+
+    [[nodiscard]] bool contains(string_view s) const {
+        return static_cast<bool>(find(s));
+    }
+
+    // NOTE: a default constructed handle if there is no string with this id (e.g. interned_string::invalid_id)
+    [[nodiscard]] interned_string from_id(uint32_t id) const {
+        return id < m_by_id.size() ? interned_string(m_by_id[id]) : interned_string();
+    }
+
+    /*
+        Modifiers
+    */
+
+    // NOTE: the handle of s, which is copied into the arena the first time; strings are limited to 4 GiB
+    interned_string intern(string_view s) {
+        if (2 * (size() + 1) > m_slots.size()) rehash(max_of(size_type{16}, 2 * m_slots.size()));
+
+        size_t hash = impl::hash_bytes(s.data(), s.size());
+        size_type slot = find_slot(s, hash);
+        if (m_slots[slot] == nullptr) m_slots[slot] = store(s, hash);
+
+        return interned_string(m_slots[slot]);
+    }
+
+    // NOTE: frees every string, all handles become invalid
+    void clear() {
+        release();
+        m_blocks.clear();
+        m_by_id.clear();
+        m_used_words = 0;
+        for (auto& slot : m_slots)
+            slot = nullptr;
+    }
+
+   private:
+    using header = impl::interned_header;
+
+    struct block {
+        size_t* data;
+        size_type words;
+    };
+
+    // NOTE: the arena is counted in words, so every header is aligned
+    size_type m_block_words;
+    size_type m_used_words{0};
+    vector<block> m_blocks;
+
+    vector<const header*> m_by_id;
+
+    // NOTE: a power of two of slots, at most half of them used, nullptr is a free slot
+    vector<const header*> m_slots;
+
+    allocator<size_t> m_allocator;
+
+    [[nodiscard]] static constexpr size_type words_for(size_type bytes) {
+        return (bytes + sizeof(size_t) - 1) / sizeof(size_t);
+    }
+
+    // NOTE: the slot of s, or the free slot where it belongs; the stored hashes are compared before the characters
+    [[nodiscard]] size_type find_slot(string_view s, size_t hash) const {
+        size_type mask = m_slots.size() - 1;
+
+        for (size_type slot = hash & mask;; slot = (slot + 1) & mask) {
+            const header* h = m_slots[slot];
+            if (h == nullptr) return slot;
+            if (h->hash == hash && h->size == s.size() && (s.empty() || memcmp(h->chars(), s.data(), s.size()) == 0)) return slot;
+        }
+    }
+
+    [[nodiscard]] const header* store(string_view s, size_t hash) {
+        size_type words = words_for(sizeof(header) + s.size() + 1);
+
+        // NOTE: the rest of the current block is left unused
+        if (m_blocks.empty() || m_blocks.back().words - m_used_words < words) {
+            size_type block_words = max_of(words, m_block_words);
+            m_blocks.push_back(block{m_allocator.allocate(block_words), block_words});
+            m_used_words = 0;
+        }
+
+        size_t* p = m_blocks.back().data + m_used_words;
+        m_used_words += words;
+
+        auto* h = reinterpret_cast<header*>(p);
+        allocator<header>().construct(h, header{hash, static_cast<uint32_t>(s.size()), static_cast<uint32_t>(m_by_id.size())});
+
+        char* chars = reinterpret_cast<char*>(h + 1);
+        if (!s.empty()) memcpy(chars, s.data(), s.size());
+        chars[s.size()] = '\0';
+
+        m_by_id.push_back(h);
+        return h;
+    }
+
+    // NOTE: only the header pointers move, the hashes are stored, no string is hashed again
+    void rehash(size_type slot_count) {
+        vector<const header*> slots(slot_count, nullptr);
+        size_type mask = slot_count - 1;
+
+        for (const header* h : m_by_id) {
+            size_type slot = h->hash & mask;
+            while (slots[slot] != nullptr)
+                slot = (slot + 1) & mask;
+            slots[slot] = h;
+        }
+
+        m_slots = lw_std::move(slots);
+    }
+
+    void release() {
+        for (const auto& b : m_blocks)
+            m_allocator.deallocate(b.data, b.words);
+    }
+};
+
+}  // namespace lw_std
\ No newline at end of file
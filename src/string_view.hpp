@@ -0,0 +1,599 @@
+// string_view header https://en.cppreference.com/w/cpp/header/string_view
+#pragma once
+
+#include "algorithm.hpp"
+#include "impl/char_traits.hpp"
+#include "limits.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+// basic_string_view https://en.cppreference.com/w/cpp/string/basic_string_view
+// NOTE: a pointer and a length into characters owned by someone else, e.g. a field of a received frame,
+//       which can be passed around, compared, searched and split without copying;
+//       the iterators are plain pointers
+template <typename CharT>
+class basic_string_view {
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    using traits_type = char_traits<CharT>;
+    using value_type = CharT;
+    using pointer = CharT*;
+    using const_pointer = const CharT*;
+    using reference = CharT&;
+    using const_reference = const CharT&;
+    using const_iterator = const CharT*;
+    using iterator = const_iterator;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+
+    // npos https://en.cppreference.com/w/cpp/string/basic_string_view/npos
+    static constexpr size_type npos = numeric_limits<size_type>::max();
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    // (constructor) (1) https://en.cppreference.com/w/cpp/string/basic_string_view/basic_string_view
+    constexpr basic_string_view() noexcept = default;
+
+    // (constructor) (2) https://en.cppreference.com/w/cpp/string/basic_string_view/basic_string_view
+    constexpr basic_string_view(const basic_string_view& other) noexcept = default;
+
+    // (constructor) (3) https://en.cppreference.com/w/cpp/string/basic_string_view/basic_string_view
+    constexpr basic_string_view(const_pointer s, size_type count)
+        : m_data(s), m_size(count) {}
+
+    // (constructor) (4) https://en.cppreference.com/w/cpp/string/basic_string_view/basic_string_view
+    constexpr basic_string_view(const_pointer s)
+        : m_data(s), m_size(traits_type::length(s)) {}
+
+    // (constructor) (5) https://en.cppreference.com/w/cpp/string/basic_string_view/basic_string_view
+    // NOTE: pointers only, the characters have to be contiguous
+    constexpr basic_string_view(const_pointer first, const_pointer last)
+        : m_data(first), m_size(static_cast<size_type>(last - first)) {}
+
+    // FIXME: (constructor) (6) https://en.cppreference.com/w/cpp/string/basic_string_view/basic_string_view
+
+    // (constructor) (7) https://en.cppreference.com/w/cpp/string/basic_string_view/basic_string_view
+    constexpr basic_string_view(decltype(nullptr)) = delete;
+
+    // operator= https://en.cppreference.com/w/cpp/string/basic_string_view/operator%3D
+    constexpr basic_string_view& operator=(const basic_string_view& view) noexcept = default;
+
+    /*
+        Iterators
+    */
+
+    // begin https://en.cppreference.com/w/cpp/string/basic_string_view/begin
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return m_data;
+    }
+
+    // cbegin https://en.cppreference.com/w/cpp/string/basic_string_view/begin
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return m_data;
+    }
+
+    // end https://en.cppreference.com/w/cpp/string/basic_string_view/end
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return m_data + m_size;
+    }
+
+    // cend https://en.cppreference.com/w/cpp/string/basic_string_view/end
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return m_data + m_size;
+    }
+
+    // FIXME: rbegin https://en.cppreference.com/w/cpp/string/basic_string_view/rbegin
+    // FIXME: rend https://en.cppreference.com/w/cpp/string/basic_string_view/rend
+
+    /*
+        Element access
+    */
+
+    // operator[] https://en.cppreference.com/w/cpp/string/basic_string_view/operator_at
+    [[nodiscard]] constexpr const_reference operator[](size_type pos) const {
+        return m_data[pos];
+    }
+
+    // at https://en.cppreference.com/w/cpp/string/basic_string_view/at
+    // NOTE: 'at' should throw if pos is out of range, but lw_std works without exceptions,
+    //       a view has no terminator to fall back to, so out of range it returns the last character
+    //       (and a null character if the view is empty)
+    [[nodiscard]] constexpr const_reference at(size_type pos) const {
+        if (m_size == 0) return null_char;
+        return m_data[min_of(pos, m_size - 1)];
+    }
+
+    // front https://en.cppreference.com/w/cpp/string/basic_string_view/front
+    [[nodiscard]] constexpr const_reference front() const {
+        return m_data[0];
+    }
+
+    // back https://en.cppreference.com/w/cpp/string/basic_string_view/back
+    [[nodiscard]] constexpr const_reference back() const {
+        return m_data[m_size - 1];
+    }
+
+    // data https://en.cppreference.com/w/cpp/string/basic_string_view/data
+    // NOTE: not null terminated in general
+    [[nodiscard]] constexpr const_pointer data() const noexcept {
+        return m_data;
+    }
+
+    /*
+        Capacity
+    */
+
+    // size https://en.cppreference.com/w/cpp/string/basic_string_view/size
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return m_size;
+    }
+
+    // length https://en.cppreference.com/w/cpp/string/basic_string_view/size
+    [[nodiscard]] constexpr size_type length() const noexcept {
+        return m_size;
+    }
+
+    // max_size https://en.cppreference.com/w/cpp/string/basic_string_view/max_size
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return numeric_limits<size_type>::max() / sizeof(value_type);
+    }
+
+    // empty https://en.cppreference.com/w/cpp/string/basic_string_view/empty
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    /*
+        Modifiers
+    */
+
+    // remove_prefix https://en.cppreference.com/w/cpp/string/basic_string_view/remove_prefix
+    constexpr void remove_prefix(size_type n) {
+        m_data += n;
+        m_size -= n;
+    }
+
+    // remove_suffix https://en.cppreference.com/w/cpp/string/basic_string_view/remove_suffix
+    constexpr void remove_suffix(size_type n) {
+        m_size -= n;
+    }
+
+    // swap https://en.cppreference.com/w/cpp/string/basic_string_view/swap
+    constexpr void swap(basic_string_view& v) noexcept {
+        lw_std::swap(m_data, v.m_data);
+        lw_std::swap(m_size, v.m_size);
+    }
+
+    /*
+        Operations
+    */
+
+    // copy https://en.cppreference.com/w/cpp/string/basic_string_view/copy
+    constexpr size_type copy(pointer dest, size_type count, size_type pos = 0) const {
+        pos = min_of(pos, m_size);
+        count = min_of(count, m_size - pos);
+        traits_type::copy(dest, m_data + pos, count);
+        return count;
+    }
+
+    // substr https://en.cppreference.com/w/cpp/string/basic_string_view/substr
+    // NOTE: no exceptions, pos past the end is clamped to the end
+    [[nodiscard]] constexpr basic_string_view substr(size_type pos = 0, size_type count = npos) const {
+        pos = min_of(pos, m_size);
+        return basic_string_view(m_data + pos, min_of(count, m_size - pos));
+    }
+
+    // compare (1) https://en.cppreference.com/w/cpp/string/basic_string_view/compare
+    [[nodiscard]] constexpr int compare(basic_string_view v) const noexcept {
+        if (int res = traits_type::compare(m_data, v.m_data, min_of(m_size, v.m_size)); res != 0) return res;
+        return m_size < v.m_size ? -1 : (m_size > v.m_size ? 1 : 0);
+    }
+
+    // compare (2) https://en.cppreference.com/w/cpp/string/basic_string_view/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, basic_string_view v) const {
+        return substr(pos1, count1).compare(v);
+    }
+
+    // compare (3) https://en.cppreference.com/w/cpp/string/basic_string_view/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, basic_string_view v, size_type pos2, size_type count2) const {
+        return substr(pos1, count1).compare(v.substr(pos2, count2));
+    }
+
+    // compare (4) https://en.cppreference.com/w/cpp/string/basic_string_view/compare
+    [[nodiscard]] constexpr int compare(const_pointer s) const {
+        return compare(basic_string_view(s));
+    }
+
+    // compare (5) https://en.cppreference.com/w/cpp/string/basic_string_view/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, const_pointer s) const {
+        return substr(pos1, count1).compare(basic_string_view(s));
+    }
+
+    // compare (6) https://en.cppreference.com/w/cpp/string/basic_string_view/compare
+    [[nodiscard]] constexpr int compare(size_type pos1, size_type count1, const_pointer s, size_type count2) const {
+        return substr(pos1, count1).compare(basic_string_view(s, count2));
+    }
+
+    // starts_with (1) https://en.cppreference.com/w/cpp/string/basic_string_view/starts_with
+    [[nodiscard]] constexpr bool starts_with(basic_string_view sv) const noexcept {
+        return m_size >= sv.m_size && traits_type::compare(m_data, sv.m_data, sv.m_size) == 0;
+    }
+
+    // starts_with (2) https://en.cppreference.com/w/cpp/string/basic_string_view/starts_with
+    [[nodiscard]] constexpr bool starts_with(value_type ch) const noexcept {
+        return m_size > 0 && traits_type::eq(m_data[0], ch);
+    }
+
+    // starts_with (3) https://en.cppreference.com/w/cpp/string/basic_string_view/starts_with
+    [[nodiscard]] constexpr bool starts_with(const_pointer s) const {
+        return starts_with(basic_string_view(s));
+    }
+
+    // ends_with (1) https://en.cppreference.com/w/cpp/string/basic_string_view/ends_with
+    [[nodiscard]] constexpr bool ends_with(basic_string_view sv) const noexcept {
+        return m_size >= sv.m_size && traits_type::compare(m_data + m_size - sv.m_size, sv.m_data, sv.m_size) == 0;
+    }
+
+    // ends_with (2) https://en.cppreference.com/w/cpp/string/basic_string_view/ends_with
+    [[nodiscard]] constexpr bool ends_with(value_type ch) const noexcept {
+        return m_size > 0 && traits_type::eq(m_data[m_size - 1], ch);
+    }
+
+    // ends_with (3) https://en.cppreference.com/w/cpp/string/basic_string_view/ends_with
+    [[nodiscard]] constexpr bool ends_with(const_pointer s) const {
+        return ends_with(basic_string_view(s));
+    }
+
+    // contains (1) https://en.cppreference.com/w/cpp/string/basic_string_view/contains
+    [[nodiscard]] constexpr bool contains(basic_string_view sv) const noexcept {
+        return find(sv) != npos;
+    }
+
+    // contains (2) https://en.cppreference.com/w/cpp/string/basic_string_view/contains
+    [[nodiscard]] constexpr bool contains(value_type ch) const noexcept {
+        return find(ch) != npos;
+    }
+
+    // contains (3) https://en.cppreference.com/w/cpp/string/basic_string_view/contains
+    [[nodiscard]] constexpr bool contains(const_pointer s) const {
+        return find(s) != npos;
+    }
+
+    /*
+        Search
+    */
+
+    // find (1) https://en.cppreference.com/w/cpp/string/basic_string_view/find
+    // NOTE: the first character of v is searched with traits_type::find (memchr or SIMD for chars), then the rest compared
+    [[nodiscard]] constexpr size_type find(basic_string_view v, size_type pos = 0) const noexcept {
+        if (v.m_size == 0) return pos <= m_size ? pos : npos;
+        if (pos >= m_size || v.m_size > m_size - pos) return npos;
+
+        const_pointer last = m_data + m_size - v.m_size + 1;
+        for (const_pointer it = m_data + pos;; ++it) {
+            it = traits_type::find(it, static_cast<size_type>(last - it), v.m_data[0]);
+            if (it == nullptr) return npos;
+            if (traits_type::compare(it + 1, v.m_data + 1, v.m_size - 1) == 0) return static_cast<size_type>(it - m_data);
+        }
+    }
+
+    // find (2) https://en.cppreference.com/w/cpp/string/basic_string_view/find
+    [[nodiscard]] constexpr size_type find(value_type ch, size_type pos = 0) const noexcept {
+        if (pos >= m_size) return npos;
+
+        const_pointer it = traits_type::find(m_data + pos, m_size - pos, ch);
+        return it == nullptr ? npos : static_cast<size_type>(it - m_data);
+    }
+
+    // find (3) https://en.cppreference.com/w/cpp/string/basic_string_view/find
+    [[nodiscard]] constexpr size_type find(const_pointer s, size_type pos, size_type count) const {
+        return find(basic_string_view(s, count), pos);
+    }
+
+    // find (4) https://en.cppreference.com/w/cpp/string/basic_string_view/find
+    [[nodiscard]] constexpr size_type find(const_pointer s, size_type pos = 0) const {
+        return find(basic_string_view(s), pos);
+    }
+
+    // rfind (1) https://en.cppreference.com/w/cpp/string/basic_string_view/rfind
+    [[nodiscard]] constexpr size_type rfind(basic_string_view v, size_type pos = npos) const noexcept {
+        if (v.m_size > m_size) return npos;
+
+        for (size_type i = min_of(pos, m_size - v.m_size) + 1; i-- > 0;)
+            if (traits_type::compare(m_data + i, v.m_data, v.m_size) == 0) return i;
+        return npos;
+    }
+
+    // rfind (2) https://en.cppreference.com/w/cpp/string/basic_string_view/rfind
+    [[nodiscard]] constexpr size_type rfind(value_type ch, size_type pos = npos) const noexcept {
+        return rfind(basic_string_view(&ch, 1), pos);
+    }
+
+    // rfind (3) https://en.cppreference.com/w/cpp/string/basic_string_view/rfind
+    [[nodiscard]] constexpr size_type rfind(const_pointer s, size_type pos, size_type count) const {
+        return rfind(basic_string_view(s, count), pos);
+    }
+
+    // rfind (4) https://en.cppreference.com/w/cpp/string/basic_string_view/rfind
+    [[nodiscard]] constexpr size_type rfind(const_pointer s, size_type pos = npos) const {
+        return rfind(basic_string_view(s), pos);
+    }
+
+    // find_first_of (1) https://en.cppreference.com/w/cpp/string/basic_string_view/find_first_of
+    // NOTE: a single character is searched with find (memchr or SIMD for chars)
+    [[nodiscard]] constexpr size_type find_first_of(basic_string_view v, size_type pos = 0) const noexcept {
+        if (v.m_size == 1) return find(v.m_data[0], pos);
+
+        for (size_type i = pos; i < m_size; ++i)
+            if (v.has(m_data[i])) return i;
+        return npos;
+    }
+
+    // find_first_of (2) https://en.cppreference.com/w/cpp/string/basic_string_view/find_first_of
+    [[nodiscard]] constexpr size_type find_first_of(value_type ch, size_type pos = 0) const noexcept {
+        return find(ch, pos);
+    }
+
+    // find_first_of (3) https://en.cppreference.com/w/cpp/string/basic_string_view/find_first_of
+    [[nodiscard]] constexpr size_type find_first_of(const_pointer s, size_type pos, size_type count) const {
+        return find_first_of(basic_string_view(s, count), pos);
+    }
+
+    // find_first_of (4) https://en.cppreference.com/w/cpp/string/basic_string_view/find_first_of
+    [[nodiscard]] constexpr size_type find_first_of(const_pointer s, size_type pos = 0) const {
+        return find_first_of(basic_string_view(s), pos);
+    }
+
+    // find_last_of (1) https://en.cppreference.com/w/cpp/string/basic_string_view/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(basic_string_view v, size_type pos = npos) const noexcept {
+        if (m_size == 0) return npos;
+
+        for (size_type i = min_of(pos, m_size - 1) + 1; i-- > 0;)
+            if (v.has(m_data[i])) return i;
+        return npos;
+    }
+
+    // find_last_of (2) https://en.cppreference.com/w/cpp/string/basic_string_view/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(value_type ch, size_type pos = npos) const noexcept {
+        return rfind(ch, pos);
+    }
+
+    // find_last_of (3) https://en.cppreference.com/w/cpp/string/basic_string_view/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(const_pointer s, size_type pos, size_type count) const {
+        return find_last_of(basic_string_view(s, count), pos);
+    }
+
+    // find_last_of (4) https://en.cppreference.com/w/cpp/string/basic_string_view/find_last_of
+    [[nodiscard]] constexpr size_type find_last_of(const_pointer s, size_type pos = npos) const {
+        return find_last_of(basic_string_view(s), pos);
+    }
+
+    // find_first_not_of (1) https://en.cppreference.com/w/cpp/string/basic_string_view/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(basic_string_view v, size_type pos = 0) const noexcept {
+        for (size_type i = pos; i < m_size; ++i)
+            if (!v.has(m_data[i])) return i;
+        return npos;
+    }
+
+    // find_first_not_of (2) https://en.cppreference.com/w/cpp/string/basic_string_view/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(value_type ch, size_type pos = 0) const noexcept {
+        return find_first_not_of(basic_string_view(&ch, 1), pos);
+    }
+
+    // find_first_not_of (3) https://en.cppreference.com/w/cpp/string/basic_string_view/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(const_pointer s, size_type pos, size_type count) const {
+        return find_first_not_of(basic_string_view(s, count), pos);
+    }
+
+    // find_first_not_of (4) https://en.cppreference.com/w/cpp/string/basic_string_view/find_first_not_of
+    [[nodiscard]] constexpr size_type find_first_not_of(const_pointer s, size_type pos = 0) const {
+        return find_first_not_of(basic_string_view(s), pos);
+    }
+
+    // find_last_not_of (1) https://en.cppreference.com/w/cpp/string/basic_string_view/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(basic_string_view v, size_type pos = npos) const noexcept {
+        if (m_size == 0) return npos;
+
+        for (size_type i = min_of(pos, m_size - 1) + 1; i-- > 0;)
+            if (!v.has(m_data[i])) return i;
+        return npos;
+    }
+
+    // find_last_not_of (2) https://en.cppreference.com/w/cpp/string/basic_string_view/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(value_type ch, size_type pos = npos) const noexcept {
+        return find_last_not_of(basic_string_view(&ch, 1), pos);
+    }
+
+    // find_last_not_of (3) https://en.cppreference.com/w/cpp/string/basic_string_view/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(const_pointer s, size_type pos, size_type count) const {
+        return find_last_not_of(basic_string_view(s, count), pos);
+    }
+
+    // find_last_not_of (4) https://en.cppreference.com/w/cpp/string/basic_string_view/find_last_not_of
+    [[nodiscard]] constexpr size_type find_last_not_of(const_pointer s, size_type pos = npos) const {
+        return find_last_not_of(basic_string_view(s), pos);
+    }
+
+    /*
+        NON-MEMBER FUNCTIONS
+    */
+
+    // NOTE: hidden friends, so one side may be anything that converts to a view (a string or a const CharT*),
+    //       which the standard spells as "sufficient additional overloads"
+
+    // operator== https://en.cppreference.com/w/cpp/string/basic_string_view/operator_cmp
+    [[nodiscard]] friend constexpr bool operator==(basic_string_view lhs, basic_string_view rhs) noexcept {
+        return lhs.m_size == rhs.m_size && traits_type::compare(lhs.m_data, rhs.m_data, lhs.m_size) == 0;
+    }
+
+    // operator!= https://en.cppreference.com/w/cpp/string/basic_string_view/operator_cmp
+    [[nodiscard]] friend constexpr bool operator!=(basic_string_view lhs, basic_string_view rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    // operator< https://en.cppreference.com/w/cpp/string/basic_string_view/operator_cmp
+    [[nodiscard]] friend constexpr bool operator<(basic_string_view lhs, basic_string_view rhs) noexcept {
+        return lhs.compare(rhs) < 0;
+    }
+
+    // operator<= https://en.cppreference.com/w/cpp/string/basic_string_view/operator_cmp
+    [[nodiscard]] friend constexpr bool operator<=(basic_string_view lhs, basic_string_view rhs) noexcept {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    // operator> https://en.cppreference.com/w/cpp/string/basic_string_view/operator_cmp
+    [[nodiscard]] friend constexpr bool operator>(basic_string_view lhs, basic_string_view rhs) noexcept {
+        return lhs.compare(rhs) > 0;
+    }
+
+    // operator>= https://en.cppreference.com/w/cpp/string/basic_string_view/operator_cmp
+    [[nodiscard]] friend constexpr bool operator>=(basic_string_view lhs, basic_string_view rhs) noexcept {
+        return lhs.compare(rhs) >= 0;
+    }
+
+   private:
+    // NOTE: what at returns for an empty view, it has no character to refer to
+    static constexpr value_type null_char{};
+
+    const_pointer m_data{nullptr};
+    size_type m_size{0};
+
+    [[nodiscard]] constexpr bool has(value_type ch) const {
+        for (size_type i = 0; i < m_size; ++i)
+            if (traits_type::eq(m_data[i], ch)) return true;
+        return false;
+    }
+};
+
+// string_view https://en.cppreference.com/w/cpp/string/basic_string_view
+using string_view = basic_string_view<char>;
+
+// wstring_view https://en.cppreference.com/w/cpp/string/basic_string_view
+using wstring_view = basic_string_view<wchar_t>;
+
+// u16string_view https://en.cppreference.com/w/cpp/string/basic_string_view
+using u16string_view = basic_string_view<char16_t>;
+
+// u32string_view https://en.cppreference.com/w/cpp/string/basic_string_view
+using u32string_view = basic_string_view<char32_t>;
+
+// NOTE: non-standard, the tokens of a view as views into it, found lazily while iterating, nothing is allocated;
+//       AnyOf = false: the text between occurrences of the delimiter sequence, empty tokens included (like views::split),
+//       AnyOf = true: the runs of characters that are not one of the delimiters, empty tokens skipped (like strtok)
+template <typename CharT, bool AnyOf>
+class basic_split_range {
+   public:
+    using view_type = basic_string_view<CharT>;
+    using size_type = size_t;
+
+    class iterator {
+        friend basic_split_range;
+
+       public:
+        using value_type = view_type;
+        using difference_type = ptrdiff_t;
+        using pointer = const view_type*;
+        using reference = const view_type&;
+        using iterator_category = forward_iterator_tag;
+
+        constexpr iterator() = default;
+
+        [[nodiscard]] constexpr reference operator*() const {
+            return m_token;
+        }
+
+        [[nodiscard]] constexpr pointer operator->() const {
+            return &m_token;
+        }
+
+        constexpr iterator& operator++() {
+            m_range->advance(*this);
+            return *this;
+        }
+
+        constexpr iterator operator++(int) {
+            iterator res = *this;
+            ++*this;
+            return res;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) {
+            return lhs.m_end == rhs.m_end && (lhs.m_end || lhs.m_token.data() == rhs.m_token.data());
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+       private:
+        const basic_split_range* m_range{nullptr};
+        view_type m_token;
+        bool m_end{true};
+    };
+
+    constexpr basic_split_range(view_type text, view_type delimiters)
+        : m_text(text), m_delimiters(delimiters) {}
+
+    [[nodiscard]] constexpr iterator begin() const {
+        iterator it;
+        it.m_range = this;
+        it.m_end = false;
+        token_from(it, 0);
+        return it;
+    }
+
+    [[nodiscard]] constexpr iterator end() const {
+        iterator it;
+        it.m_range = this;
+        return it;
+    }
+
+   private:
+    view_type m_text;
+    view_type m_delimiters;
+
+    // NOTE: the token that starts at or, for AnyOf, after pos
+    constexpr void token_from(iterator& it, size_type pos) const {
+        if constexpr (AnyOf) {
+            pos = m_text.find_first_not_of(m_delimiters, pos);
+            if (pos == view_type::npos) {
+                it.m_end = true;
+                return;
+            }
+            it.m_token = m_text.substr(pos, m_text.find_first_of(m_delimiters, pos) - pos);
+        } else {
+            // NOTE: an empty delimiter never separates, the whole text is one token
+            size_type next = m_delimiters.empty() ? view_type::npos : m_text.find(m_delimiters, pos);
+            it.m_token = m_text.substr(pos, next == view_type::npos ? view_type::npos : next - pos);
+        }
+    }
+
+    constexpr void advance(iterator& it) const {
+        size_type token_end = static_cast<size_type>(it.m_token.data() - m_text.data()) + it.m_token.size();
+        if (token_end == m_text.size()) {
+            it.m_end = true;
+            return;
+        }
+
+        token_from(it, token_end + (AnyOf ? 1 : m_delimiters.size()));
+    }
+};
+
+// NOTE: non-standard, e.g. for (string_view field : split(line, ",")), "a,,b," gives "a", "", "b" and "";
+//       for chars only, so that strings and literals convert (the other character types use basic_split_range)
+[[nodiscard]] constexpr basic_split_range<char, false> split(string_view text, string_view delimiter) {
+    return basic_split_range<char, false>(text, delimiter);
+}
+
+// NOTE: non-standard, e.g. for (string_view word : tokenize(line, " \t")), "  a b\t" gives "a" and "b"
+[[nodiscard]] constexpr basic_split_range<char, true> tokenize(string_view text, string_view delimiters) {
+    return basic_split_range<char, true>(text, delimiters);
+}
+
+}  // namespace lw_std
\ No newline at end of file
@@ -0,0 +1,292 @@
+// type_traits header https://en.cppreference.com/w/cpp/header/type_traits
+#pragma once
+
+#include "utility.hpp"
+
+namespace lw_std {
+
+/*
+    CLASSES
+*/
+
+/*
+    Helper classes
+*/
+
+// integral_constant https://en.cppreference.com/w/cpp/types/integral_constant
+template <typename T, T v>
+struct integral_constant {
+    static constexpr T value = v;
+
+    using value_type = T;
+    using type = integral_constant;
+
+    [[nodiscard]] constexpr operator value_type() const noexcept {
+        return value;
+    }
+
+    [[nodiscard]] constexpr value_type operator()() const noexcept {
+        return value;
+    }
+};
+
+template <bool B>
+using bool_constant = integral_constant<bool, B>;
+
+using true_type = bool_constant<true>;
+using false_type = bool_constant<false>;
+
+/*
+    Type relationships
+*/
+
+// is_same https://en.cppreference.com/w/cpp/types/is_same
+template <typename T, typename U>
+struct is_same : false_type {};
+
+template <typename T>
+struct is_same<T, T> : true_type {};
+
+template <typename T, typename U>
+inline constexpr bool is_same_v = is_same<T, U>::value;
+
+// is_base_of https://en.cppreference.com/w/cpp/types/is_base_of
+// NOTE: there is no portable way to write this without compiler support, gcc, clang and msvc all provide the builtin
+template <typename Base, typename Derived>
+struct is_base_of : bool_constant<__is_base_of(Base, Derived)> {};
+
+template <typename Base, typename Derived>
+inline constexpr bool is_base_of_v = is_base_of<Base, Derived>::value;
+
+/*
+    Const-volatility specifiers
+*/
+
+// remove_cv https://en.cppreference.com/w/cpp/types/remove_cv
+template <typename T>
+struct remove_cv { typedef T type; };
+template <typename T>
+struct remove_cv<const T> { typedef T type; };
+template <typename T>
+struct remove_cv<volatile T> { typedef T type; };
+template <typename T>
+struct remove_cv<const volatile T> { typedef T type; };
+
+template <typename T>
+using remove_cv_t = typename remove_cv<T>::type;
+
+/*
+    References
+*/
+
+// NOTE: remove_reference is defined in impl/move.hpp, it is needed by move and forward
+
+template <typename T>
+using remove_reference_t = typename remove_reference<T>::type;
+
+/*
+    Pointers
+*/
+
+// remove_pointer https://en.cppreference.com/w/cpp/types/remove_pointer
+template <typename T>
+struct remove_pointer { typedef T type; };
+template <typename T>
+struct remove_pointer<T*> { typedef T type; };
+template <typename T>
+struct remove_pointer<T* const> { typedef T type; };
+template <typename T>
+struct remove_pointer<T* volatile> { typedef T type; };
+template <typename T>
+struct remove_pointer<T* const volatile> { typedef T type; };
+
+template <typename T>
+using remove_pointer_t = typename remove_pointer<T>::type;
+
+/*
+    Primary type categories
+*/
+
+// is_integral https://en.cppreference.com/w/cpp/types/is_integral
+template <typename T>
+struct is_integral_base : false_type {};
+
+template <> struct is_integral_base<bool> : true_type {};
+template <> struct is_integral_base<char> : true_type {};
+template <> struct is_integral_base<signed char> : true_type {};
+template <> struct is_integral_base<unsigned char> : true_type {};
+template <> struct is_integral_base<wchar_t> : true_type {};
+template <> struct is_integral_base<char16_t> : true_type {};
+template <> struct is_integral_base<char32_t> : true_type {};
+template <> struct is_integral_base<short> : true_type {};
+template <> struct is_integral_base<unsigned short> : true_type {};
+template <> struct is_integral_base<int> : true_type {};
+template <> struct is_integral_base<unsigned int> : true_type {};
+template <> struct is_integral_base<long> : true_type {};
+template <> struct is_integral_base<unsigned long> : true_type {};
+template <> struct is_integral_base<long long> : true_type {};
+template <> struct is_integral_base<unsigned long long> : true_type {};
+
+template <typename T>
+struct is_integral : is_integral_base<remove_cv_t<T>> {};
+
+template <typename T>
+inline constexpr bool is_integral_v = is_integral<T>::value;
+
+// is_pointer https://en.cppreference.com/w/cpp/types/is_pointer
+template <typename T>
+struct is_pointer_base : false_type {};
+
+template <typename T>
+struct is_pointer_base<T*> : true_type {};
+
+template <typename T>
+struct is_pointer : is_pointer_base<remove_cv_t<T>> {};
+
+template <typename T>
+inline constexpr bool is_pointer_v = is_pointer<T>::value;
+
+// is_array https://en.cppreference.com/w/cpp/types/is_array
+template <typename T>
+struct is_array : false_type {};
+
+template <typename T>
+struct is_array<T[]> : true_type {};
+
+template <typename T, size_t N>
+struct is_array<T[N]> : true_type {};
+
+template <typename T>
+inline constexpr bool is_array_v = is_array<T>::value;
+
+/*
+    Type properties
+*/
+
+// is_signed https://en.cppreference.com/w/cpp/types/is_signed
+// NOTE: integral types only, there is no is_floating_point yet
+template <typename T, bool = is_integral_v<T>>
+struct is_signed_base : false_type {};
+
+template <typename T>
+struct is_signed_base<T, true> : bool_constant<T(-1) < T(0)> {};
+
+template <typename T>
+struct is_signed : is_signed_base<remove_cv_t<T>> {};
+
+template <typename T>
+inline constexpr bool is_signed_v = is_signed<T>::value;
+
+// is_empty https://en.cppreference.com/w/cpp/types/is_empty
+// NOTE: needs compiler support, gcc, clang and msvc all provide the builtin
+template <typename T>
+struct is_empty : bool_constant<__is_empty(T)> {};
+
+template <typename T>
+inline constexpr bool is_empty_v = is_empty<T>::value;
+
+// is_final https://en.cppreference.com/w/cpp/types/is_final
+// NOTE: needs compiler support, gcc, clang and msvc all provide the builtin
+template <typename T>
+struct is_final : bool_constant<__is_final(T)> {};
+
+template <typename T>
+inline constexpr bool is_final_v = is_final<T>::value;
+
+/*
+    Supported operations
+*/
+
+// is_trivially_default_constructible https://en.cppreference.com/w/cpp/types/is_default_constructible
+// NOTE: needs compiler support, gcc, clang and msvc all provide the builtin
+template <typename T>
+struct is_trivially_default_constructible : bool_constant<__is_trivially_constructible(T)> {};
+
+template <typename T>
+inline constexpr bool is_trivially_default_constructible_v = is_trivially_default_constructible<T>::value;
+
+/*
+    Miscellaneous transformations
+*/
+
+// enable_if https://en.cppreference.com/w/cpp/types/enable_if
+template <bool B, typename T = void>
+struct enable_if {};
+
+template <typename T>
+struct enable_if<true, T> { typedef T type; };
+
+template <bool B, typename T = void>
+using enable_if_t = typename enable_if<B, T>::type;
+
+// conditional https://en.cppreference.com/w/cpp/types/conditional
+template <bool B, typename T, typename F>
+struct conditional { typedef T type; };
+
+template <typename T, typename F>
+struct conditional<false, T, F> { typedef F type; };
+
+template <bool B, typename T, typename F>
+using conditional_t = typename conditional<B, T, F>::type;
+
+/*
+    Arrays
+*/
+
+// remove_extent https://en.cppreference.com/w/cpp/types/remove_extent
+template <typename T>
+struct remove_extent { typedef T type; };
+
+template <typename T>
+struct remove_extent<T[]> { typedef T type; };
+
+template <typename T, size_t N>
+struct remove_extent<T[N]> { typedef T type; };
+
+template <typename T>
+using remove_extent_t = typename remove_extent<T>::type;
+
+/*
+    Sign modifiers
+*/
+
+// make_unsigned https://en.cppreference.com/w/cpp/types/make_unsigned
+// NOTE: cv qualifiers are not kept, the character types without a sign map to the unsigned type of their size
+template <typename T>
+struct make_unsigned;
+
+template <> struct make_unsigned<char> { typedef unsigned char type; };
+template <> struct make_unsigned<signed char> { typedef unsigned char type; };
+template <> struct make_unsigned<unsigned char> { typedef unsigned char type; };
+template <> struct make_unsigned<short> { typedef unsigned short type; };
+template <> struct make_unsigned<unsigned short> { typedef unsigned short type; };
+template <> struct make_unsigned<int> { typedef unsigned int type; };
+template <> struct make_unsigned<unsigned int> { typedef unsigned int type; };
+template <> struct make_unsigned<long> { typedef unsigned long type; };
+template <> struct make_unsigned<unsigned long> { typedef unsigned long type; };
+template <> struct make_unsigned<long long> { typedef unsigned long long type; };
+template <> struct make_unsigned<unsigned long long> { typedef unsigned long long type; };
+
+template <> struct make_unsigned<wchar_t> { typedef conditional_t<sizeof(wchar_t) == 2, uint16_t, uint32_t> type; };
+template <> struct make_unsigned<char16_t> { typedef uint_least16_t type; };
+template <> struct make_unsigned<char32_t> { typedef uint_least32_t type; };
+
+template <typename T>
+using make_unsigned_t = typename make_unsigned<T>::type;
+
+/*
+    FUNCTIONS
+*/
+
+// is_constant_evaluated https://en.cppreference.com/w/cpp/types/is_constant_evaluated
+// NOTE: needs compiler support (gcc >= 9, clang >= 9), older compilers (e.g. avr-gcc 7) always get false,
+//       so functions that use it to pick a runtime only path can't be constant evaluated there
+[[nodiscard]] constexpr bool is_constant_evaluated() noexcept {
+#if defined(__clang__) && __clang_major__ >= 9 || !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 9
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+}  // namespace lw_std
@@ -9,7 +9,7 @@ namespace lw_std {
 template <typename T, typename U, typename Hash = hash<T>, typename Equal = equal_to<T>, typename Allocator = allocator<pair<const T, U>>>
 class unordered_map : public hash_container_impl<unordered_map<T, U, Hash, Equal, Allocator>, pair<const T, U>, T, Hash, Equal, Allocator> {
    private:
-    using underlying_type = hash_container_impl<unordered_map<T, U, Hash, Equal, Allocator>, pair<const T, U>, T, Hash, Equal>;
+    using underlying_type = hash_container_impl<unordered_map<T, U, Hash, Equal, Allocator>, pair<const T, U>, T, Hash, Equal, Allocator>;
     friend underlying_type;
 
    public:
@@ -39,14 +39,14 @@ class unordered_map : public hash_container_impl<unordered_map<T, U, Hash, Equal
 
     // operator[] (1) https://en.cppreference.com/w/cpp/container/unordered_map/operator_at
     constexpr mapped_type& operator[](const typename underlying_type::key_type& key) {
-        typename underlying_type::iterator res = &underlying_type::find_hash(*static_cast<underlying_type*>(this), key, this->hash_element(key));
+        typename underlying_type::iterator res = this->iterator_at(underlying_type::find_hash(*static_cast<underlying_type*>(this), key, this->hash_element(key)));
         if (res == this->end()) return this->emplace(lw_std::move(typename underlying_type::value_type{key, {}})).first->second;
         else return res->second;
     }
 
     // operator[] (2) https://en.cppreference.com/w/cpp/container/unordered_map/operator_at
     constexpr mapped_type& operator[](typename underlying_type::key_type&& key) {
-        typename underlying_type::iterator res = &underlying_type::find_hash(*static_cast<underlying_type*>(this), key, this->hash_element(key));
+        typename underlying_type::iterator res = this->iterator_at(underlying_type::find_hash(*static_cast<underlying_type*>(this), key, this->hash_element(key)));
         if (res == this->end()) return this->emplace(lw_std::move(typename underlying_type::value_type{lw_std::move(key), {}})).first->second;
         else return res->second;
     }
@@ -57,4 +57,14 @@ class unordered_map : public hash_container_impl<unordered_map<T, U, Hash, Equal
     }
 };
 
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// erase_if https://en.cppreference.com/w/cpp/container/unordered_map/erase_if
+template <typename T, typename U, typename Hash, typename Equal, typename Allocator, typename Pred>
+constexpr typename unordered_map<T, U, Hash, Equal, Allocator>::size_type erase_if(unordered_map<T, U, Hash, Equal, Allocator>& c, Pred pred) {
+    return c.erase_if(pred);
+}
+
 }  // namespace lw_std
\ No newline at end of file
@@ -9,7 +9,7 @@ namespace lw_std {
 template <typename T, typename Hash = hash<T>, typename Equal = equal_to<T>, typename Allocator = allocator<T>>
 class unordered_set : public hash_container_impl<unordered_set<T, Hash, Equal, Allocator>, T, T, Hash, Equal, Allocator> {
    private:
-    using underlying_type = hash_container_impl<unordered_set<T, Hash, Equal, Allocator>, T, T, Hash, Equal>;
+    using underlying_type = hash_container_impl<unordered_set<T, Hash, Equal, Allocator>, T, T, Hash, Equal, Allocator>;
     friend underlying_type;
 
     static constexpr const typename underlying_type::key_type& key_access_proxy(typename underlying_type::const_reference elt) {
@@ -17,4 +17,14 @@ class unordered_set : public hash_container_impl<unordered_set<T, Hash, Equal, A
     }
 };
 
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+// erase_if https://en.cppreference.com/w/cpp/container/unordered_set/erase_if
+template <typename T, typename Hash, typename Equal, typename Allocator, typename Pred>
+constexpr typename unordered_set<T, Hash, Equal, Allocator>::size_type erase_if(unordered_set<T, Hash, Equal, Allocator>& c, Pred pred) {
+    return c.erase_if(pred);
+}
+
 }  // namespace lw_std
\ No newline at end of file
@@ -0,0 +1,612 @@
+// unrolled_list header (non-standard)
+#pragma once
+
+#include "algorithm.hpp"
+#include "impl/iterator.hpp"
+#include "impl/member_types.hpp"
+#include "iterator.hpp"
+#include "limits.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+namespace lw_std {
+
+// NOTE: non-standard, the default number of elements per node of an unrolled_list, about one cache line of them
+template <typename T>
+inline constexpr size_t unrolled_list_default_node_capacity = sizeof(T) * 4 < 64 ? 64 / sizeof(T) : 4;
+
+// NOTE: non-standard, a doubly linked list of nodes that hold up to K elements each in a small array, so a traversal
+//       touches one node (and its two links) per K elements; inserting into a full node splits it in half and an
+//       erase merges a node into its predecessor once both fit into one node, so nodes stay at least about half full;
+//       elements are moved within (and between) nodes, so every insert or erase invalidates all iterators
+template <typename T, size_t K = unrolled_list_default_node_capacity<T>, typename Allocator = allocator<T>>
+class unrolled_list {
+    static_assert(K >= 2, "unrolled_list needs room for at least two elements per node");
+
+   protected:
+    struct node {
+        node* prev{nullptr};
+        node* next{nullptr};
+        size_t count{0};
+        alignas(T) unsigned char storage[K * sizeof(T)];
+
+        [[nodiscard]] T* values() {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        [[nodiscard]] const T* values() const {
+            return reinterpret_cast<const T*>(storage);
+        }
+    };
+
+    typedef typename Allocator::template rebind<node>::other node_allocator_t;
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def;
+
+    // NOTE: node, index in the node and the list, which --end() needs to find the back node
+    struct iterator_data_t {
+        node* n;
+        size_t index;
+        const unrolled_list* owner;
+    };
+
+   public:
+    /*
+        MEMBER TYPES
+    */
+
+    LWSTD_COMMON_VALUE_TYPES(T)
+
+    using allocator_type = Allocator;
+    using iterator = iterator_impl<iterator_def<T, iterator_data_t>, iterator_def<T, iterator_data_t>>;
+    using const_iterator = iterator_impl<iterator_def<const T, iterator_data_t>, iterator>;
+
+    static constexpr size_type node_capacity = K;
+
+    /*
+        MEMBER FUNCTIONS
+    */
+
+    constexpr unrolled_list() = default;
+
+    constexpr unrolled_list(const unrolled_list& other) {
+        operator=(other);
+    }
+
+    constexpr unrolled_list(unrolled_list&& other) {
+        operator=(lw_std::move(other));
+    }
+
+    ~unrolled_list() {
+        clear();
+    }
+
+    constexpr unrolled_list& operator=(const unrolled_list& other) {
+        if (&other != this) {
+            clear();
+            for (const auto& item : other)
+                push_back(item);
+        }
+
+        return *this;
+    }
+
+    constexpr unrolled_list& operator=(unrolled_list&& other) {
+        if (&other != this) {
+            lw_std::swap(m_front, other.m_front);
+            lw_std::swap(m_back, other.m_back);
+            lw_std::swap(m_size, other.m_size);
+        }
+        return *this;
+    }
+
+    constexpr void assign(size_type count, const_reference value) {
+        clear();
+        for (size_type i = 0; i < count; ++i)
+            push_back(value);
+    }
+
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr void assign(InputIt first, InputIt last) {
+        clear();
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return m_element_allocator;
+    }
+
+    /*
+        Element access
+    */
+
+    [[nodiscard]] constexpr reference front() {
+        return m_front->values()[0];
+    }
+
+    [[nodiscard]] constexpr const_reference front() const {
+        return m_front->values()[0];
+    }
+
+    [[nodiscard]] constexpr reference back() {
+        return m_back->values()[m_back->count - 1];
+    }
+
+    [[nodiscard]] constexpr const_reference back() const {
+        return m_back->values()[m_back->count - 1];
+    }
+
+    /*
+        Iterators
+    */
+
+    [[nodiscard]] constexpr iterator begin() noexcept {
+        return iterator_at(m_front, 0);
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept {
+        return iterator_at(m_front, 0);
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept {
+        return iterator_at(m_front, 0);
+    }
+
+    [[nodiscard]] constexpr iterator end() noexcept {
+        return iterator_at(nullptr, 0);
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept {
+        return iterator_at(nullptr, 0);
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept {
+        return iterator_at(nullptr, 0);
+    }
+
+    /*
+        Capacity
+    */
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_size == 0;
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return m_size;
+    }
+
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        return numeric_limits<size_type>::max();
+    }
+
+    /*
+        Modifiers
+    */
+
+    constexpr void clear() noexcept {
+        while (m_front != nullptr) {
+            node* next = m_front->next;
+            for (size_type i = 0; i < m_front->count; ++i)
+                m_element_allocator.destroy(&m_front->values()[i]);
+
+            free_node(m_front);
+            m_front = next;
+        }
+
+        m_back = nullptr;
+        m_size = 0;
+    }
+
+    constexpr iterator insert(const_iterator pos, const_reference value) {
+        // NOTE: value might be an element of this list, which is moved when room is made
+        T copy(value);
+        return emplace(pos, lw_std::move(copy));
+    }
+
+    constexpr iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, lw_std::move(value));
+    }
+
+    constexpr iterator insert(const_iterator pos, size_type count, const_reference value) {
+        T copy(value);
+
+        // NOTE: inserting in front of the previously inserted element keeps the returned iterator valid
+        iterator res = to_non_const_iterator(pos);
+        for (size_type i = 0; i < count; ++i)
+            res = emplace(res, copy);
+
+        return res;
+    }
+
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+    constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        iterator current = to_non_const_iterator(pos);
+        difference_type count = 0;
+
+        for (; first != last; ++first, ++count)
+            current = ++emplace(current, *first);
+
+        // NOTE: earlier iterators are invalidated by each insert, so walk back from the current one
+        return lw_std::prev(current, count);
+    }
+
+    // NOTE: args must not refer to elements of this list, insert takes care of that for values
+    template <typename... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        node* n = node_of(pos);
+        size_type index = static_cast<const typename const_iterator::underlying_type&>(pos).m_data.index;
+
+        if (n == nullptr) {
+            // NOTE: at the end, fill up the back node first
+            n = m_back;
+            if (n == nullptr || n->count == K)
+                n = insert_node_after(m_back);
+            index = n->count;
+        } else if (n->count == K) {
+            split(n);
+            if (index > n->count) {
+                index -= n->count;
+                n = n->next;
+            }
+        }
+
+        open_slot(n, index);
+        m_element_allocator.construct(&n->values()[index], lw_std::forward<Args>(args)...);
+        n->count++;
+        m_size++;
+
+        return iterator_at(n, index);
+    }
+
+    constexpr iterator erase(const_iterator pos) {
+        node* n = node_of(pos);
+        size_type index = static_cast<const typename const_iterator::underlying_type&>(pos).m_data.index;
+
+        T* values = n->values();
+        for (size_type i = index; i + 1 < n->count; ++i)
+            values[i] = lw_std::move(values[i + 1]);
+
+        m_element_allocator.destroy(&values[--n->count]);
+        m_size--;
+
+        if (n->count == 0) {
+            node* next = n->next;
+            unlink_node(n);
+            return iterator_at(next, 0);
+        }
+
+        // NOTE: keep the nodes dense, merge into the predecessor once both fit into it
+        if (n->prev != nullptr && n->prev->count + n->count <= K) {
+            node* prev = n->prev;
+            index += prev->count;
+            move_all_into(prev, n);
+            n = prev;
+        }
+
+        if (index == n->count)
+            return iterator_at(n->next, 0);
+
+        return iterator_at(n, index);
+    }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        // NOTE: last is invalidated by the first erase, so count the elements instead
+        auto count = lw_std::distance(first, last);
+
+        iterator current = to_non_const_iterator(first);
+        for (; count > 0; --count)
+            current = erase(current);
+
+        return current;
+    }
+
+    constexpr void push_back(const_reference value) {
+        emplace_back(value);
+    }
+
+    constexpr void push_back(T&& value) {
+        emplace_back(lw_std::move(value));
+    }
+
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        return *emplace(cend(), lw_std::forward<Args>(args)...);
+    }
+
+    constexpr void pop_back() {
+        if (!empty())
+            erase(iterator_at(m_back, m_back->count - 1));
+    }
+
+    constexpr void push_front(const_reference value) {
+        emplace_front(value);
+    }
+
+    constexpr void push_front(T&& value) {
+        emplace_front(lw_std::move(value));
+    }
+
+    template <typename... Args>
+    constexpr reference emplace_front(Args&&... args) {
+        return *emplace(cbegin(), lw_std::forward<Args>(args)...);
+    }
+
+    constexpr void pop_front() {
+        if (!empty())
+            erase(cbegin());
+    }
+
+    constexpr void swap(unrolled_list& other) {
+        lw_std::swap(*this, other);
+    }
+
+    /*
+        Operations
+    */
+
+    constexpr size_type remove(const T& value) {
+        // NOTE: value might be an element of this list, which is overwritten while compacting
+        T copy(value);
+        return remove_if([&copy](const T& element) { return element == copy; });
+    }
+
+    // NOTE: one pass that moves the kept elements forward into the slots already in use, the nodes before the last
+    //       written one keep their counts and the ones after it are freed
+    template <typename UnaryPredicate>
+    constexpr size_type remove_if(UnaryPredicate p) {
+        node* write = m_front;
+        size_type write_index = 0;
+
+        for (node* read = m_front; read != nullptr; read = read->next) {
+            for (size_type i = 0; i < read->count; ++i) {
+                T& element = read->values()[i];
+                if (p(element)) continue;
+
+                if (write_index == write->count) {
+                    write = write->next;
+                    write_index = 0;
+                }
+
+                if (write != read || write_index != i)
+                    write->values()[write_index] = lw_std::move(element);
+                ++write_index;
+            }
+        }
+
+        size_type old_size = m_size;
+        if (write_index == 0) {
+            clear();
+            return old_size;
+        }
+
+        for (size_type i = write_index; i < write->count; ++i)
+            m_element_allocator.destroy(&write->values()[i]);
+        m_size -= write->count - write_index;
+        write->count = write_index;
+
+        while (write->next != nullptr) {
+            node* n = write->next;
+            for (size_type i = 0; i < n->count; ++i)
+                m_element_allocator.destroy(&n->values()[i]);
+            m_size -= n->count;
+            unlink_node(n);
+        }
+
+        if (write->prev != nullptr && write->prev->count + write->count <= K)
+            move_all_into(write->prev, write);
+
+        return old_size - m_size;
+    }
+
+   private:
+    template <typename P, typename IT_P>
+    class iterator_def {
+        friend unrolled_list;
+
+       protected:
+        typedef P value_type;
+        typedef IT_P data_type;
+        typedef bidirectional_iterator_tag iterator_category;
+
+        constexpr iterator_def() = default;
+
+        constexpr iterator_def(const IT_P& data)
+            : m_data(data) {}
+
+        template <typename Q, typename IT_Q>
+        constexpr iterator_def(const iterator_def<Q, IT_Q>& other)
+            : m_data(other.m_data) {}
+
+        constexpr iterator_def(const iterator_def& other) {
+            operator=(other);
+        }
+
+        constexpr iterator_def(iterator_def&& other) {
+            operator=(lw_std::move(other));
+        }
+
+        constexpr iterator_def& operator=(const iterator_def& other) {
+            m_data = other.m_data;
+            return *this;
+        }
+
+        constexpr iterator_def& operator=(iterator_def&& other) {
+            m_data = lw_std::move(other.m_data);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool equal(const iterator_def& other) const {
+            return m_data.n == other.m_data.n && m_data.index == other.m_data.index;
+        }
+
+        [[nodiscard]] constexpr P* get() {
+            return &m_data.n->values()[m_data.index];
+        }
+
+        [[nodiscard]] constexpr const P* get() const {
+            return &m_data.n->values()[m_data.index];
+        }
+
+        // NOTE: skips whole nodes where it can
+        constexpr void advance(ptrdiff_t n) {
+            while (n > 0 && m_data.n != nullptr) {
+                auto left_in_node = static_cast<ptrdiff_t>(m_data.n->count - m_data.index);
+                if (n < left_in_node) {
+                    m_data.index += static_cast<size_t>(n);
+                    return;
+                }
+
+                n -= left_in_node;
+                m_data.n = m_data.n->next;
+                m_data.index = 0;
+            }
+
+            while (n < 0) {
+                if (m_data.n == nullptr) {
+                    m_data.n = m_data.owner->m_back;
+                    m_data.index = m_data.n->count;
+                }
+
+                if (static_cast<ptrdiff_t>(m_data.index) >= -n) {
+                    m_data.index -= static_cast<size_t>(-n);
+                    return;
+                }
+
+                n += static_cast<ptrdiff_t>(m_data.index);
+                m_data.n = m_data.n->prev;
+                m_data.index = m_data.n->count;
+            }
+        }
+
+       private:
+        IT_P m_data{nullptr, 0, nullptr};
+    };
+
+    node_allocator_t m_node_allocator{};
+    allocator_type m_element_allocator{};
+
+    node* m_front = nullptr;
+    node* m_back = nullptr;
+
+    size_type m_size = 0;
+
+    [[nodiscard]] constexpr iterator iterator_at(node* n, size_type index) const {
+        return iterator(iterator_data_t{n, index, this});
+    }
+
+    [[nodiscard]] static node* node_of(const const_iterator& pos) {
+        return static_cast<const typename const_iterator::underlying_type&>(pos).m_data.n;
+    }
+
+    static iterator to_non_const_iterator(const const_iterator& pos) {
+        return iterator(static_cast<const typename const_iterator::underlying_type&>(pos).m_data);
+    }
+
+    constexpr node* insert_node_after(node* prev) {
+        node* n = m_node_allocator.allocate(1);
+        m_node_allocator.construct(n);
+
+        n->prev = prev;
+        n->next = prev != nullptr ? prev->next : m_front;
+
+        if (n->next != nullptr)
+            n->next->prev = n;
+        else
+            m_back = n;
+
+        if (prev != nullptr)
+            prev->next = n;
+        else
+            m_front = n;
+
+        return n;
+    }
+
+    constexpr void unlink_node(node* n) {
+        if (n->prev != nullptr)
+            n->prev->next = n->next;
+        else
+            m_front = n->next;
+
+        if (n->next != nullptr)
+            n->next->prev = n->prev;
+        else
+            m_back = n->prev;
+
+        free_node(n);
+    }
+
+    constexpr void free_node(node* n) {
+        m_node_allocator.destroy(n);
+        m_node_allocator.deallocate(n, 1);
+    }
+
+    // NOTE: moves the upper half of a full node into a new node after it
+    constexpr void split(node* n) {
+        node* upper = insert_node_after(n);
+        size_type keep = K / 2;
+
+        for (size_type i = keep; i < K; ++i) {
+            m_element_allocator.construct(&upper->values()[i - keep], lw_std::move(n->values()[i]));
+            m_element_allocator.destroy(&n->values()[i]);
+        }
+
+        upper->count = K - keep;
+        n->count = keep;
+    }
+
+    // NOTE: makes room at index of a node that is not full and leaves that slot unconstructed
+    constexpr void open_slot(node* n, size_type index) {
+        T* values = n->values();
+        if (index == n->count) return;
+
+        m_element_allocator.construct(&values[n->count], lw_std::move(values[n->count - 1]));
+        for (size_type i = n->count - 1; i > index; --i)
+            values[i] = lw_std::move(values[i - 1]);
+
+        m_element_allocator.destroy(&values[index]);
+    }
+
+    // NOTE: appends all elements of from to to and frees from
+    constexpr void move_all_into(node* to, node* from) {
+        for (size_type i = 0; i < from->count; ++i) {
+            m_element_allocator.construct(&to->values()[to->count + i], lw_std::move(from->values()[i]));
+            m_element_allocator.destroy(&from->values()[i]);
+        }
+
+        to->count += from->count;
+        from->count = 0;
+        unlink_node(from);
+    }
+};
+
+/*
+    NON-MEMBER FUNCTIONS
+*/
+
+template <typename T, size_t K, typename Allocator>
+[[nodiscard]] constexpr bool operator==(const unrolled_list<T, K, Allocator>& lhs, const unrolled_list<T, K, Allocator>& rhs) {
+    return lhs.size() == rhs.size() && lw_std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, size_t K, typename Allocator>
+[[nodiscard]] constexpr bool operator!=(const unrolled_list<T, K, Allocator>& lhs, const unrolled_list<T, K, Allocator>& rhs) {
+    return !operator==(lhs, rhs);
+}
+
+template <typename T, size_t K, typename Allocator, typename U>
+constexpr typename unrolled_list<T, K, Allocator>::size_type erase(unrolled_list<T, K, Allocator>& c, const U& value) {
+    return c.remove_if([&value](const T& element) { return element == value; });
+}
+
+template <typename T, size_t K, typename Allocator, typename Pred>
+constexpr typename unrolled_list<T, K, Allocator>::size_type erase_if(unrolled_list<T, K, Allocator>& c, Pred pred) {
+    return c.remove_if(pred);
+}
+
+}  // namespace lw_std
\ No newline at end of file
@@ -28,6 +28,11 @@ constexpr void swap(T& a, T& b) {
 
 // FIXME: swap (2) https://en.cppreference.com/w/cpp/algorithm/swap
 
+// declval https://en.cppreference.com/w/cpp/utility/declval
+// NOTE: only for unevaluated operands (decltype, sizeof), it has no definition
+template <typename T>
+T&& declval() noexcept;
+
 }  // namespace lw_std
 
 /*
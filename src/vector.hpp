@@ -1,11 +1,19 @@
 // vector header https://en.cppreference.com/w/cpp/header/vector
 #pragma once
 
+#ifdef ARDUINO
+#    include <string.h>
+#else
+#    include <cstring>
+#endif
+
 #include "algorithm.hpp"
 #include "impl/iterator.hpp"
 #include "impl/member_types.hpp"
+#include "iterator.hpp"
 #include "limits.hpp"
 #include "memory.hpp"
+#include "type_traits.hpp"
 #include "utility.hpp"
 
 namespace lw_std {
@@ -41,21 +49,22 @@ class vector {
         resize(count);
     }
 
-    // FIXME: (constructor) (5) https://en.cppreference.com/w/cpp/container/vector/vector
-    template <class InputIt>
+    // (constructor) (5) https://en.cppreference.com/w/cpp/container/vector/vector
+    // NOTE: integral InputIt is excluded, so vector(5, 1) picks (3)
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
     constexpr vector(InputIt first, InputIt last) {
         insert(begin(), first, last);
     }
 
     // (constructor) (6) https://en.cppreference.com/w/cpp/container/vector/vector
-    constexpr vector(const vector<T>& other) {
+    constexpr vector(const vector& other) {
         operator=(other);
     }
 
     // FIXME: (constructor) (7) https://en.cppreference.com/w/cpp/container/vector/vector
 
     // (constructor) (8) https://en.cppreference.com/w/cpp/container/vector/vector
-    constexpr vector(vector<T>&& other) {
+    constexpr vector(vector&& other) {
         operator=(lw_std::move(other));
     }
 
@@ -69,7 +78,7 @@ class vector {
     }
 
     // operator= (1) https://en.cppreference.com/w/cpp/container/vector/operator%3D
-    constexpr vector& operator=(const vector<T>& other) {
+    constexpr vector& operator=(const vector& other) {
         if (&other != this) {
             reserve(other.size());
 
@@ -86,7 +95,7 @@ class vector {
     }
 
     // operator= (2) https://en.cppreference.com/w/cpp/container/vector/operator%3D
-    constexpr vector& operator=(vector<T>&& other) {
+    constexpr vector& operator=(vector&& other) {
         if (&other != this) {
             lw_std::swap(m_data, other.m_data);
             lw_std::swap(m_size, other.m_size);
@@ -105,12 +114,10 @@ class vector {
     }
 
     // assign (2) https://en.cppreference.com/w/cpp/container/vector/assign
-    // FIXME: this can be done better (allocate once?)
-    template <typename InputIt>
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
     constexpr void assign(InputIt first, InputIt last) {
         clear();
-        for (; first != last; ++first)
-            push_back(*first);
+        insert(begin(), first, last);
     }
 
     // FIXME: assign (3) https://en.cppreference.com/w/cpp/container/vector/assign
@@ -268,6 +275,10 @@ class vector {
 
     // insert (1) https://en.cppreference.com/w/cpp/container/vector/insert
     constexpr iterator insert(const_iterator pos, const_reference value) {
+        // NOTE: a copy of an element behind pos has to be taken before that element is moved
+        if (m_size != m_allocated_size && is_element_from(&value, index_from_iterator(pos)))
+            return emplace(pos, T(value));
+
         return emplace(pos, value);
     }
 
@@ -280,43 +291,60 @@ class vector {
     constexpr iterator insert(const_iterator pos, size_type count, const_reference value) {
         auto index = index_from_iterator(pos);
 
-        for (size_type i = 0; i < count; ++i)
-            pos = emplace(pos, value);
+        // NOTE: value might be an element of this vector, which is moved when the gap is opened
+        T copy(value);
+        open_gap(index, count);
 
+        for (size_type i = index; i < index + count; ++i)
+            m_allocator.construct(&m_data[i], copy);
+
+        m_size += count;
         return &m_data[index];
     }
 
     // insert (4) https://en.cppreference.com/w/cpp/container/vector/insert
-    template <typename InputIt>
+    template <typename InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
     constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
         auto index = index_from_iterator(pos);
-        auto start_index = index;
 
-        while (first != last) {
-            emplace(&m_data[index++], *first);
-            first++;
+        if constexpr (is_base_of_v<forward_iterator_tag, typename iterator_traits<InputIt>::iterator_category>) {
+            // NOTE: the range can be walked twice, size the gap first (in O(1) for random access iterators)
+            auto count = static_cast<size_type>(lw_std::distance(first, last));
+            open_gap(index, count);
+
+            for (size_type i = index; first != last; ++first, ++i)
+                m_allocator.construct(&m_data[i], *first);
+
+            m_size += count;
+        } else {
+            // NOTE: single pass input, the size is not known up front
+            for (size_type i = index; first != last; ++first, ++i)
+                emplace(begin() + static_cast<difference_type>(i), *first);
         }
 
-        return &m_data[start_index];
+        return &m_data[index];
     }
 
     // FIXME: insert (5) https://en.cppreference.com/w/cpp/container/vector/insert
 
     // emplace https://en.cppreference.com/w/cpp/container/vector/emplace
+    // NOTE: the new element is constructed right in its slot, without a temporary; if the storage is full it is
+    //       constructed first, so args may refer to elements, otherwise args must not refer to elements behind pos
+    //       (these are moved before the construction, insert (1) takes care of that case)
     template <typename... Args>
     constexpr iterator emplace(const_iterator pos, Args&&... args) {
         // NOTE: iterator might get invalidated on grow, so store index now
         auto index = index_from_iterator(pos);
 
-        if (m_size == m_allocated_size)
-            resize_impl(m_size + 8);
+        if (m_size == m_allocated_size) {
+            auto new_capacity = grown_capacity(m_size + 1);
+            auto new_data = m_allocator.allocate(new_capacity);
 
-        if (m_size == index) {
-            m_allocator.construct(&m_data[m_size], lw_std::forward<Args>(args)...);
+            m_allocator.construct(&new_data[index], lw_std::forward<Args>(args)...);
+            relocate(new_data, new_capacity, index, 1);
         } else {
-            m_allocator.construct(&m_data[m_size], lw_std::move(m_data[m_size - 1]));
-            shift(m_size - 1, index, -1);
-            m_data[index] = lw_std::move(T(lw_std::forward<Args>(args)...));
+            open_gap(index, 1);
+            m_allocator.construct(&m_data[index], lw_std::forward<Args>(args)...);
         }
 
         m_size++;
@@ -375,12 +403,50 @@ class vector {
 
     // resize (1) https://en.cppreference.com/w/cpp/container/vector/resize
     constexpr void resize(size_type count) {
-        resize_impl(count, T());
+        destroy_from(count);
+        reserve(count);
+
+        if constexpr (is_integral_v<T> || is_pointer_v<T>) {
+            // NOTE: value initialized integers and pointers are all zero bytes
+            if (count > m_size)
+                memset(static_cast<void*>(&m_data[m_size]), 0, (count - m_size) * sizeof(T));
+        } else {
+            for (size_type i = m_size; i < count; ++i)
+                m_allocator.construct(&m_data[i]);
+        }
+
+        m_size = count;
     }
 
     // resize (2) https://en.cppreference.com/w/cpp/container/vector/resize
     constexpr void resize(size_type count, const_reference value) {
-        resize_impl(count, value);
+        // NOTE: value might be an element of this vector, which is moved if reserve reallocates
+        T copy(value);
+        destroy_from(count);
+        reserve(count);
+
+        if constexpr (is_integral_v<T> && sizeof(T) == 1) {
+            if (count > m_size)
+                memset(static_cast<void*>(&m_data[m_size]), static_cast<unsigned char>(copy), count - m_size);
+        } else {
+            for (size_type i = m_size; i < count; ++i)
+                m_allocator.construct(&m_data[i], copy);
+        }
+
+        m_size = count;
+    }
+
+    // NOTE: non-standard, like resize (1) but the new elements are default initialized, so trivial types (e.g. the bytes
+    //       of a receive buffer that is filled right after) are left uninitialized instead of being zeroed first
+    constexpr void resize_for_overwrite(size_type count) {
+        destroy_from(count);
+        reserve(count);
+
+        if constexpr (!is_trivially_default_constructible_v<T>)
+            for (size_type i = m_size; i < count; ++i)
+                new (static_cast<void*>(&m_data[i])) T;
+
+        m_size = count;
     }
 
     // swap https://en.cppreference.com/w/cpp/container/vector/swap
@@ -396,6 +462,7 @@ class vector {
        protected:
         typedef P value_type;
         typedef IT_P data_type;
+        typedef random_access_iterator_tag iterator_category;
 
         constexpr iterator_def() = default;
 
@@ -436,10 +503,14 @@ class vector {
             return m_data;
         }
 
-        constexpr void advance(int n) {
+        constexpr void advance(ptrdiff_t n) {
             m_data += n;
         }
 
+        [[nodiscard]] constexpr ptrdiff_t distance_to(const iterator_def& other) const {
+            return other.m_data - m_data;
+        }
+
        private:
         IT_P m_data{nullptr};
     };
@@ -458,13 +529,65 @@ class vector {
         }
     }
 
+    // NOTE: grow geometrically, so n push_backs cost O(n) moves in total
+    [[nodiscard]] constexpr size_type grown_capacity(size_type min_capacity) const {
+        return max_of(min_capacity, max_of(2 * m_allocated_size, size_type{8}));
+    }
+
+    // NOTE: makes room for count elements at index and leaves these slots unconstructed,
+    //       every element behind index is moved exactly once and the storage is reallocated at most once
+    constexpr void open_gap(size_type index, size_type count) {
+        if (count == 0) return;
+
+        if (m_size + count > m_allocated_size) {
+            auto new_capacity = grown_capacity(m_size + count);
+            relocate(m_allocator.allocate(new_capacity), new_capacity, index, count);
+            return;
+        }
+
+        // NOTE: back to front, slots at or past m_size are unconstructed, the vacated slots are destroyed afterwards
+        for (size_type i = m_size; i > index; --i) {
+            if (i - 1 + count >= m_size)
+                m_allocator.construct(&m_data[i - 1 + count], lw_std::move(m_data[i - 1]));
+            else
+                m_data[i - 1 + count] = lw_std::move(m_data[i - 1]);
+        }
+
+        for (size_type i = index; i < index + count && i < m_size; ++i)
+            m_allocator.destroy(&m_data[i]);
+    }
+
+    // NOTE: moves every element straight into its final slot in new_data, leaving count slots at index for the caller
+    constexpr void relocate(pointer new_data, size_type new_capacity, size_type index, size_type count) {
+        for (size_type i = 0; i < m_size; ++i) {
+            m_allocator.construct(&new_data[i < index ? i : i + count], lw_std::move(m_data[i]));
+            m_allocator.destroy(&m_data[i]);
+        }
+
+        if (m_allocated_size != 0)
+            m_allocator.deallocate(m_data, m_allocated_size);
+
+        m_allocated_size = new_capacity;
+        m_data = new_data;
+    }
+
+    [[nodiscard]] constexpr bool is_element_from(const_pointer p, size_type index) const {
+        // NOTE: addresses can't be compared in constant expressions, there every value counts as an element,
+        //       which only costs insert a copy
+        if (is_constant_evaluated()) return true;
+
+        // NOTE: comparing pointers into different arrays is unspecified, so compare the addresses
+        auto address = reinterpret_cast<uintptr_t>(p);
+        return address >= reinterpret_cast<uintptr_t>(m_data + index) && address < reinterpret_cast<uintptr_t>(m_data + m_size);
+    }
+
     constexpr void resize_impl(size_type new_size) {
         auto new_data = new_size > 0 ? m_allocator.allocate(new_size) : nullptr;
 
         for (size_type i = 0; i < m_size && i < new_size; ++i)
             m_allocator.construct(&new_data[i], lw_std::move(m_data[i]));
 
-        for (size_type i = new_size; i < m_size; ++i)
+        for (size_type i = 0; i < m_size; ++i)
             m_allocator.destroy(&m_data[i]);
 
         if (m_allocated_size != 0)
@@ -475,12 +598,9 @@ class vector {
         m_data = new_data;
     }
 
-    constexpr void resize_impl(size_type count, const_reference value) {
-        resize_impl(count);
-
-        while (m_size < count) {
-            emplace_back(value);
-        }
+    constexpr void destroy_from(size_type index) {
+        while (m_size > index)
+            m_allocator.destroy(&m_data[--m_size]);
     }
 
     [[nodiscard]] constexpr size_type index_from_iterator(const_iterator& it) const {
@@ -495,7 +615,8 @@ class vector {
 // operator== (1) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
 template <typename T>
 [[nodiscard]] constexpr bool operator==(const vector<T>& lhs, const vector<T>& rhs) {
-    return lhs.size() == rhs.size() && equal(lhs.begin(), lhs.end(), rhs.begin());
+    // NOTE: compare the underlying arrays, contiguous ranges of e.g. integers are compared with memcmp
+    return lhs.size() == rhs.size() && lw_std::equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
 }
 
 // operator== (2) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
@@ -504,34 +625,59 @@ template <typename T>
     return !operator==(lhs, rhs);
 }
 
+// NOTE: operator<=> (7) https://en.cppreference.com/w/cpp/container/vector/operator_cmp as C++17 overload of synthesized_cmp_three_way,
+//       every pair of elements is compared once, contiguous ranges of e.g. integers are compared a block at a time
+template <typename T>
+[[nodiscard]] constexpr int synthesized_cmp_three_way(const vector<T>& lhs, const vector<T>& rhs) {
+    return lw_std::lexicographical_compare_three_way(lhs.data(), lhs.data() + lhs.size(), rhs.data(), rhs.data() + rhs.size());
+}
+
 // operator< (3) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
 template <typename T>
 [[nodiscard]] constexpr bool operator<(const vector<T>& lhs, const vector<T>& rhs) {
-    return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), synthesized_cmp_less<T, T>);
+    return synthesized_cmp_three_way(lhs, rhs) < 0;
 }
 
 // operator<= (4) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
 template <typename T>
 [[nodiscard]] constexpr bool operator<=(const vector<T>& lhs, const vector<T>& rhs) {
-    return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), synthesized_cmp_less_equal<T, T>);
+    return synthesized_cmp_three_way(lhs, rhs) <= 0;
 }
 
 // operator> (5) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
 template <typename T>
 [[nodiscard]] constexpr bool operator>(const vector<T>& lhs, const vector<T>& rhs) {
-    return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), synthesized_cmp_greater<T, T>);
+    return synthesized_cmp_three_way(lhs, rhs) > 0;
 }
 
 // operator>= (6) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
 template <typename T>
 [[nodiscard]] constexpr bool operator>=(const vector<T>& lhs, const vector<T>& rhs) {
-    return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), synthesized_cmp_greater_equal<T, T>);
+    return synthesized_cmp_three_way(lhs, rhs) >= 0;
 }
 
-// FIXME: operator<=> (7) https://en.cppreference.com/w/cpp/container/vector/operator_cmp
-
 // NOTE: no extra specialization: swap https://en.cppreference.com/w/cpp/container/vector/swap2
-// NOTE: no extra specialization: erase (1) https://en.cppreference.com/w/cpp/container/vector/erase2
-// NOTE: no extra specialization: erase (2) https://en.cppreference.com/w/cpp/container/vector/erase2
 
-}  // namespace lw_std
\ No newline at end of file
+// erase_if (2) https://en.cppreference.com/w/cpp/container/vector/erase2
+template <typename T, typename Allocator, typename Pred>
+constexpr typename vector<T, Allocator>::size_type erase_if(vector<T, Allocator>& c, Pred pred) {
+    // NOTE: one pass over the raw array moves the kept elements to the front, then the tail is destroyed at once
+    T* last = c.data() + c.size();
+    T* new_last = lw_std::remove_if(c.data(), last, pred);
+    auto count = static_cast<typename vector<T, Allocator>::size_type>(last - new_last);
+
+    c.erase(new_last, last);
+    return count;
+}
+
+// erase (1) https://en.cppreference.com/w/cpp/container/vector/erase2
+template <typename T, typename Allocator, typename U>
+constexpr typename vector<T, Allocator>::size_type erase(vector<T, Allocator>& c, const U& value) {
+    return lw_std::erase_if(c, [&value](const T& element) { return element == value; });
+}
+
+}  // namespace lw_std
+
+// NOTE: the vector<bool> specialization is built on dynamic_bitset, which itself stores its blocks in a vector,
+//       so it can only be included once the primary template is complete
+#include "dynamic_bitset.hpp"
\ No newline at end of file
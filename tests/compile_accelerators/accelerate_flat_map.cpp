@@ -0,0 +1,7 @@
+#include <map>
+
+#include "../test_lw_flat_map.hpp"
+#include "flat_map.hpp"
+
+LWSTD_TEST_ACCELERATE_VERIFY_WITH(TestLwFlatMap, flat_map, map, int, int);
+LWSTD_TEST_ACCELERATE_VERIFY_WITH(TestLwFlatMap, flat_map, map, int, NonTrivial);
@@ -0,0 +1,6 @@
+#include <set>
+
+#include "../test_lw_flat_set.hpp"
+#include "flat_set.hpp"
+
+LWSTD_TEST_ACCELERATE_VERIFY_WITH(TestLwFlatSet, flat_set, set, int);
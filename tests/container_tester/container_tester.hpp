@@ -171,6 +171,14 @@ class ContainerTester {
         return modify_by_move_templated(tc, vc);
     }
 
+    static TestLogging::test_result modify_by_sort(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t&, const value_generator_t&) {
+        return modify_by_sort_templated(tc, vc);
+    }
+
+    static TestLogging::test_result modify_by_reverse(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t&, const value_generator_t&) {
+        return modify_by_reverse_templated(tc, vc);
+    }
+
     static TestLogging::test_result modify_by_assign(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t& sg, const value_generator_t& gen) {
         return modify_by_assign_templated(tc, vc, gen, sg);
     }
@@ -303,6 +311,30 @@ class ContainerTester {
         return shrink_by_erase_by_range_templated(tc, vc, sg);
     }
 
+    static TestLogging::test_result shrink_by_erase_free(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t& sg) {
+        return shrink_by_erase_free_templated(tc, vc, sg);
+    }
+
+    static TestLogging::test_result shrink_by_remove(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t& sg) {
+        return shrink_by_remove_templated(tc, vc, sg);
+    }
+
+    static TestLogging::test_result shrink_by_unique(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t&) {
+        return shrink_by_unique_templated(tc, vc);
+    }
+
+    static TestLogging::test_result shrink_by_erase_if(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t& sg) {
+        return shrink_by_erase_if_templated(tc, vc, sg);
+    }
+
+    static TestLogging::test_result shrink_by_erase_if_no_pos(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t& sg) {
+        return shrink_by_erase_if_no_pos_templated(tc, vc, sg, [](const auto& element) -> const auto& { return element; });
+    }
+
+    static TestLogging::test_result shrink_by_erase_if_for_map(test_container_t& tc, verify_container_t& vc, const tc_size_getter_t& sg) {
+        return shrink_by_erase_if_no_pos_templated(tc, vc, sg, [](const auto& element) -> const auto& { return element.first; });
+    }
+
     static TestLogging::test_result verify_size(const test_container_t& tc, const verify_container_t& vc, const tc_size_getter_t& tc_sg, const vc_size_getter_t& vc_sg) {
         return verify_size_templated(tc, vc, tc_sg, vc_sg);
     }
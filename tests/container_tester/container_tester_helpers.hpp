@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <ftest/test_logging.hpp>
+#include <functional>
 
 #include "../non_trivial.hpp"
 
@@ -158,6 +160,22 @@ TestLogging::test_result modify_by_move_templated(TestContainer_& tc, VerifyCont
     return {"move", true};
 }
 
+template <typename TestContainer_, typename VerifyContainer_>
+TestLogging::test_result modify_by_sort_templated(TestContainer_& tc, VerifyContainer_& vc) {
+    tc.sort();
+    vc.sort();
+
+    return {"sort", true};
+}
+
+template <typename TestContainer_, typename VerifyContainer_>
+TestLogging::test_result modify_by_reverse_templated(TestContainer_& tc, VerifyContainer_& vc) {
+    tc.reverse();
+    vc.reverse();
+
+    return {"reverse", true};
+}
+
 template <typename TestContainer_, typename VerifyContainer_, typename Generator, typename TestContainerSizeGetter>
 TestLogging::test_result modify_by_assign_templated(TestContainer_& tc, VerifyContainer_& vc, const Generator& gen, const TestContainerSizeGetter& size_getter) {
     auto size = size_getter(tc);
@@ -520,6 +538,73 @@ TestLogging::test_result shrink_by_erase_by_range_templated(TestContainer_& tc,
                                "erase range from " + to_string(min) + " to " + to_string(max));
 }
 
+template <typename TestContainer_, typename VerifyContainer_, typename TestContainerSizeGetter>
+TestLogging::test_result shrink_by_erase_free_templated(TestContainer_& tc, VerifyContainer_& vc, const TestContainerSizeGetter& size_getter) {
+    auto idx = random_index(tc, size_getter);
+    auto value = *advance_copy(tc.begin(), idx);
+
+    // NOTE: std::erase is C++20, so the verify container uses the erase-remove idiom
+    auto vc_it = std::remove(vc.begin(), vc.end(), value);
+    auto vc_count = static_cast<typename VerifyContainer_::size_type>(std::distance(vc_it, vc.end()));
+    vc.erase(vc_it, vc.end());
+
+    return return_result_check(tc, vc, erase(tc, value), vc_count, "erase (free) value " + to_string(value));
+}
+
+template <typename TestContainer_, typename VerifyContainer_, typename TestContainerSizeGetter>
+TestLogging::test_result shrink_by_remove_templated(TestContainer_& tc, VerifyContainer_& vc, const TestContainerSizeGetter& size_getter) {
+    auto idx = random_index(tc, size_getter);
+    auto value = *advance_copy(tc.begin(), idx);
+
+    // NOTE: passes a reference into the container itself, remove has to keep it alive until the end
+    auto tc_count = tc.remove(*advance_copy(tc.begin(), idx));
+    auto vc_size = vc.size();
+    vc.remove(value);
+
+    return return_result_check(tc, vc, tc_count, vc_size - vc.size(), "remove value " + to_string(value));
+}
+
+template <typename TestContainer_, typename VerifyContainer_>
+TestLogging::test_result shrink_by_unique_templated(TestContainer_& tc, VerifyContainer_& vc) {
+    auto vc_size = vc.size();
+    vc.unique();
+
+    return return_result_check(tc, vc, tc.unique(), vc_size - vc.size(), "unique");
+}
+
+template <typename TestContainer_, typename VerifyContainer_, typename TestContainerSizeGetter>
+TestLogging::test_result shrink_by_erase_if_templated(TestContainer_& tc, VerifyContainer_& vc, const TestContainerSizeGetter& size_getter) {
+    auto a = *advance_copy(tc.begin(), random_index(tc, size_getter));
+    auto b = *advance_copy(tc.begin(), random_index(tc, size_getter));
+    auto pred = [&a, &b](const auto& element) { return element == a || element == b; };
+
+    auto vc_it = std::remove_if(vc.begin(), vc.end(), pred);
+    auto vc_count = static_cast<typename VerifyContainer_::size_type>(std::distance(vc_it, vc.end()));
+    vc.erase(vc_it, vc.end());
+
+    return return_result_check(tc, vc, erase_if(tc, pred), vc_count, "erase_if values " + to_string(a) + " or " + to_string(b));
+}
+
+template <typename TestContainer_, typename VerifyContainer_, typename TestContainerSizeGetter, typename KeyAccess>
+TestLogging::test_result shrink_by_erase_if_no_pos_templated(TestContainer_& tc, VerifyContainer_& vc, const TestContainerSizeGetter& size_getter, const KeyAccess& key) {
+    // NOTE: drops every element whose key hashes into the same residue class as a random one, so several go at once
+    auto modulus = urand() % 4 + 2;
+    auto residue = std::hash<std::decay_t<decltype(key(*tc.begin()))>>{}(key(*advance_copy(tc.begin(), random_index(tc, size_getter)))) % modulus;
+    auto pred = [&](const auto& element) { return std::hash<std::decay_t<decltype(key(element))>>{}(key(element)) % modulus == residue; };
+
+    typename VerifyContainer_::size_type vc_count = 0;
+    for (auto it = vc.begin(); it != vc.end();) {
+        if (pred(*it)) {
+            it = vc.erase(it);
+            vc_count++;
+        } else {
+            ++it;
+        }
+    }
+
+    return return_result_check(tc, vc, erase_if(tc, pred), vc_count, "erase_if residue " + to_string(residue) + " mod " + to_string(modulus));
+}
+
 template <typename TestContainer_, typename VerifyContainer_, typename TestContainerSizeGetter, typename VerifyContainerSizeGetter>
 TestLogging::test_result verify_size_templated(const TestContainer_& tc, const VerifyContainer_& vc, const TestContainerSizeGetter& tc_size_getter, const VerifyContainerSizeGetter& vc_size_getter) {
     if (tc_size_getter(tc) != vc_size_getter(vc))
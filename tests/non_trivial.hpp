@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 
 /*
@@ -8,12 +9,27 @@
 
 class NonTrivial {
    public:
+    // NOTE: counts the special member calls, so tests can check how many of them an operation needs
+    struct Counters {
+        size_t constructions{0};
+        size_t copies{0};
+        size_t moves{0};
+        size_t destructions{0};
+    };
+
+    static Counters& counters() {
+        static Counters c;
+        return c;
+    }
+
     NonTrivial() {
         m_data = new unsigned{-1u};
+        counters().constructions++;
     }
 
     NonTrivial(unsigned a) {
         m_data = new unsigned{a};
+        counters().constructions++;
     }
 
     // NonTrivial(const NonTrivial&) = delete;
@@ -27,9 +43,12 @@ class NonTrivial {
 
     ~NonTrivial() {
         clear();
+        counters().destructions++;
     }
 
+    // NOTE: the copy and move constructors go through these, so they count as well
     NonTrivial& operator=(const NonTrivial& other) {
+        counters().copies++;
         if (this != &other) {
             clear();
             if (other.m_data)
@@ -39,6 +58,7 @@ class NonTrivial {
     }
 
     NonTrivial& operator=(NonTrivial&& other) {
+        counters().moves++;
         if (this != &other) {
             clear();
             m_data = other.m_data;
@@ -56,6 +76,10 @@ class NonTrivial {
         return !operator==(rhs);
     }
 
+    bool operator<(const NonTrivial& rhs) const {
+        return *m_data < *rhs.m_data;
+    }
+
     unsigned data() const {
         return *m_data;
     }
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <ftest/test_logging.hpp>
+#include <random>
+#include <vector>
+
+#include "algorithm.hpp"
+#include "list.hpp"
+#include "vector.hpp"
+
+class TestLwAlgorithm {
+   public:
+    static TestLogging::test_result run_binary_search() {
+        std::vector<int> sorted{1, 2, 2, 2, 3, 5, 8, 8, 13};
+        const int* first = sorted.data();
+        const int* last = sorted.data() + sorted.size();
+
+        for (int value = 0; value < 15; ++value) {
+            auto expected_lower = std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin();
+            auto expected_upper = std::upper_bound(sorted.begin(), sorted.end(), value) - sorted.begin();
+
+            if (lw_std::lower_bound(first, last, value) - first != expected_lower) return {"lower_bound"};
+            if (lw_std::branchless_lower_bound(first, last, value) - first != expected_lower) return {"branchless_lower_bound"};
+            if (lw_std::upper_bound(first, last, value) - first != expected_upper) return {"upper_bound"};
+
+            auto range = lw_std::equal_range(first, last, value);
+            if (range.first - first != expected_lower || range.second - first != expected_upper) return {"equal_range"};
+
+            if (lw_std::binary_search(first, last, value) != std::binary_search(sorted.begin(), sorted.end(), value)) return {"binary_search"};
+        }
+
+        if (lw_std::branchless_lower_bound(first, first, 0) != first) return {"branchless_lower_bound (empty)"};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_vectorized() {
+        for (auto failed : {run_vectorized_templated<uint8_t>(), run_vectorized_templated<int8_t>(), run_vectorized_templated<uint16_t>(),
+                            run_vectorized_templated<int32_t>(), run_vectorized_templated<uint64_t>()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_comparison() {
+        for (auto failed : {run_comparison_templated<lw_std::vector<int>, int>(), run_comparison_templated<lw_std::vector<uint8_t>, uint8_t>(),
+                            run_comparison_templated<lw_std::vector<int8_t>, int8_t>(), run_comparison_templated<lw_std::list<int>, int>()})
+            if (failed != nullptr) return {failed};
+
+        lw_std::vector<int> inner;
+        inner.push_back(1);
+        lw_std::vector<lw_std::vector<int>> nested_a(2, inner);
+        auto nested_b = nested_a;
+        nested_b[1].push_back(0);
+        if (!(nested_a < nested_b) || nested_b <= nested_a || lw_std::synthesized_cmp_three_way(nested_a, nested_a) != 0) return {"nested vector"};
+
+        for (int a = 0; a < 3; ++a) {
+            for (int b = 0; b < 3; ++b) {
+                lw_std::pair<int, int> lhs{a / 2, a % 2};
+                lw_std::pair<int, int> rhs{b / 2, b % 2};
+                std::pair<int, int> std_lhs{a / 2, a % 2};
+                std::pair<int, int> std_rhs{b / 2, b % 2};
+
+                if ((lhs < rhs) != (std_lhs < std_rhs) || (lhs <= rhs) != (std_lhs <= std_rhs) ||
+                    (lhs > rhs) != (std_lhs > std_rhs) || (lhs >= rhs) != (std_lhs >= std_rhs))
+                    return {"pair"};
+            }
+        }
+
+        return {};
+    }
+
+   private:
+    template <typename Container, typename T>
+    static const char* run_comparison_templated() {
+        std::mt19937 rng(2);
+        std::uniform_int_distribution<int> dist(-1, 1);
+        std::uniform_int_distribution<size_t> size_dist(0, 40);
+
+        for (size_t i = 0; i < 2000; ++i) {
+            Container a;
+            Container b;
+            std::vector<T> std_a;
+            std::vector<T> std_b;
+
+            // NOTE: b starts as a copy of a, so equal prefixes are common
+            auto size = size_dist(rng);
+            for (size_t j = 0; j < size; ++j) {
+                auto value = static_cast<T>(dist(rng));
+                a.push_back(value);
+                std_a.push_back(value);
+            }
+            for (size_t j = 0; j < size; ++j) {
+                auto value = std_a[j];
+                if (dist(rng) == 0 && dist(rng) == 0) value = static_cast<T>(dist(rng));
+                b.push_back(value);
+                std_b.push_back(value);
+            }
+            if (dist(rng) == 0) {
+                b.push_back(T{});
+                std_b.push_back(T{});
+            }
+
+            if ((a == b) != (std_a == std_b) || (a != b) != (std_a != std_b)) return "operator==/!=";
+            if ((a < b) != (std_a < std_b) || (b < a) != (std_b < std_a)) return "operator<";
+            if ((a <= b) != (std_a <= std_b) || (a > b) != (std_a > std_b) || (a >= b) != (std_a >= std_b)) return "operator<=/>/>=";
+
+            int expected = std_a < std_b ? -1 : (std_b < std_a ? 1 : 0);
+            int res = lw_std::lexicographical_compare_three_way(std_a.begin(), std_a.end(), std_b.begin(), std_b.end());
+            if ((res < 0) != (expected < 0) || (res > 0) != (expected > 0)) return "lexicographical_compare_three_way";
+
+            if (lw_std::lexicographical_compare(std_a.begin(), std_a.end(), std_b.begin(), std_b.end()) != (std_a < std_b))
+                return "lexicographical_compare";
+        }
+
+        return nullptr;
+    }
+
+    // NOTE: returns the name of the failed check or nullptr
+    template <typename T>
+    static const char* run_vectorized_templated() {
+        std::mt19937 rng(1);
+        // NOTE: few distinct values, so there are hits, misses and long equal prefixes; sizes cross several blocks
+        std::uniform_int_distribution<int> dist(-2, 2);
+
+        for (size_t size = 0; size < 150; ++size) {
+            std::vector<T> a(size);
+            for (auto& element : a)
+                element = static_cast<T>(dist(rng));
+
+            const T* first = a.data();
+            const T* last = a.data() + a.size();
+
+            for (int v = -3; v <= 3; ++v) {
+                auto value = static_cast<T>(v);
+
+                if (lw_std::find(first, last, value) - first != std::find(a.begin(), a.end(), value) - a.begin()) return "find";
+                if (lw_std::count(first, last, value) != std::count(a.begin(), a.end(), value)) return "count";
+            }
+
+            for (size_t change = 0; change <= size; ++change) {
+                auto b = a;
+                if (change < size) b[change] = static_cast<T>(b[change] + 1);
+                if (change == size) b.push_back(0);
+
+                const T* b_first = b.data();
+                const T* b_last = b.data() + b.size();
+
+                if (lw_std::equal(first, last, b_first) != std::equal(a.begin(), a.end(), b.begin())) return "equal (1)";
+                if (lw_std::equal(first, last, b_first, b_last) != std::equal(a.begin(), a.end(), b.begin(), b.end())) return "equal (5)";
+
+                if (lw_std::lexicographical_compare(first, last, b_first, b_last) != std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()))
+                    return "lexicographical_compare";
+                if (lw_std::lexicographical_compare(b_first, b_last, first, last) != std::lexicographical_compare(b.begin(), b.end(), a.begin(), a.end()))
+                    return "lexicographical_compare (swapped)";
+            }
+        }
+
+        return nullptr;
+    }
+};
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <type_traits>
+
+#include "arena_list.hpp"
+#include "container_test_mixin.hpp"
+
+// NOTE: few enough nodes for 16-bit links
+template <typename T>
+using arena_list_16 = lw_std::arena_list<T, 60000>;
+
+class TestLwArenaList : public ContainerTestDefaultMixin<TestLwArenaList, arena_list_16, std::list> {
+    friend ContainerTestDefaultMixin;
+
+   public:
+    static TestLogging::test_result run_arena() {
+        for (auto failed : {run_index_type(), run_growth(), run_free_list(), run_full()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    static const char* run_index_type() {
+        if (!std::is_same_v<lw_std::arena_list<int, 65534>::index_type, uint16_t>) return "uint16_t links up to 65534 nodes";
+        if (!std::is_same_v<lw_std::arena_list<int, 65535>::index_type, uint32_t>) return "uint32_t links from 65535 nodes on";
+        if (!std::is_same_v<lw_std::arena_list<int>::index_type, uint32_t>) return "uint32_t links by default";
+
+        return nullptr;
+    }
+
+    static const char* run_growth() {
+        arena_list_16<NonTrivial> c;
+        c.push_back(NonTrivial(1));
+        auto first = c.begin();
+
+        // NOTE: iterators are indices, so they survive the arena growing underneath
+        for (unsigned i = 2; i <= 100; ++i)
+            c.push_back(NonTrivial(i));
+
+        if (c.size() != 100 || c.capacity() < 100 || first != c.begin() || first->data() != 1) return "iterator after growth";
+
+        // NOTE: an element of the list itself, while the arena is full and has to grow
+        while (c.size() < c.capacity())
+            c.push_back(NonTrivial(0));
+        c.push_back(c.front());
+        if (c.back().data() != 1) return "push_back (element of the list, growth)";
+
+        unsigned expected = 1;
+        for (auto it = c.begin(); expected <= 100; ++it, ++expected)
+            if (it->data() != expected) return "order after growth";
+
+        return nullptr;
+    }
+
+    static const char* run_free_list() {
+        arena_list_16<int> c;
+        c.reserve(16);
+        for (int i = 0; i < 16; ++i)
+            c.push_back(i);
+
+        // NOTE: erased nodes are reused before the arena grows
+        c.remove_if([](int x) { return x % 2 == 0; });
+        for (int i = 0; i < 8; ++i)
+            c.push_front(-i);
+
+        if (c.size() != 16 || c.capacity() != 16) return "free list reuse";
+
+        c.clear();
+        if (!c.empty() || c.capacity() != 16 || c.begin() != c.end()) return "clear keeps the arena";
+
+        c.assign(16, 5);
+        if (c.size() != 16 || c.capacity() != 16 || c.front() != 5 || c.back() != 5) return "assign after clear";
+
+        return nullptr;
+    }
+
+    static const char* run_full() {
+        lw_std::arena_list<int, 5> c;
+        for (int i = 0; i < 5; ++i)
+            c.push_back(i);
+
+        // NOTE: no exceptions, a full list inserts nothing and returns end()
+        if (c.insert(c.begin(), 7) != c.end() || c.size() != 5 || c.capacity() != 5 || c.front() != 0) return "insert into a full list";
+
+        c.pop_front();
+        auto inserted = c.insert(c.begin(), 7);
+        if (inserted != c.begin() || c.front() != 7 || c.size() != 5) return "insert after erase";
+
+        // NOTE: push_back and push_front of an rvalue do nothing either
+        c.push_back(8);
+        c.push_front(9);
+        if (c.size() != 5 || c.front() != 7 || c.back() != 4) return "push_back/push_front (rvalue) into a full list";
+
+        // NOTE: emplace_back and emplace_front need a free node, they fill the list up to max_size() and no further
+        c.pop_back();
+        int& back = c.emplace_back(10);
+        if (&back != &c.back() || back != 10 || c.size() != c.max_size()) return "emplace_back into the last free node";
+
+        c.pop_front();
+        int& front = c.emplace_front(11);
+        if (&front != &c.front() || front != 11 || c.size() != c.max_size() || c.capacity() != 5) return "emplace_front into the last free node";
+
+        return nullptr;
+    }
+
+    template <typename ContainerTestType>
+    static TestLogging::test_result run_templated(ContainerTestType& tester, size_t operation_count) {
+        tester.set_test_container_size_getter(ContainerTestType::default_test_container_size_getter);
+        tester.set_verify_container_size_getter(ContainerTestType::default_verify_container_size_getter);
+
+        tester.set_test_container_printer(ContainerTestType::default_test_container_printer);
+        tester.set_verify_container_printer(ContainerTestType::default_verify_container_printer);
+
+        tester.add_neutral_modifier("operator=(const T&)", ContainerTestType::modify_by_copy);
+        tester.add_neutral_modifier("operator=(T&&)", ContainerTestType::modify_by_move);
+
+        tester.add_neutral_modifier("assign", ContainerTestType::modify_by_assign);
+        tester.add_neutral_modifier("assign (range)", ContainerTestType::modify_by_assign_range);
+
+        tester.add_verifier("front", ContainerTestType::verify_front);
+        tester.add_verifier("back", ContainerTestType::verify_back);
+
+        tester.add_verifier("element position (iterator)", ContainerTestType::verify_element_position_with_iterator);
+
+        (void)tester.tc().empty();  // just test if it compiles
+        tester.add_verifier("size", ContainerTestType::verify_size);
+        (void)tester.tc().max_size();  // just test if it compiles
+
+        tester.add_shrink_modifier("clear", ContainerTestType::shrink_by_clear);
+
+        tester.add_grow_modifier("insert", ContainerTestType::grow_by_insert);
+        tester.add_grow_modifier("insert (rvalue)", ContainerTestType::grow_by_insert_rvalue);
+        tester.add_grow_modifier("insert (count)", ContainerTestType::grow_by_insert_count);
+        tester.add_grow_modifier("insert (range)", ContainerTestType::grow_by_insert_range);
+
+        tester.add_grow_modifier("emplace", ContainerTestType::grow_by_emplace);
+
+        tester.add_shrink_modifier("erase", ContainerTestType::shrink_by_erase_by_iterator);
+        tester.add_shrink_modifier("erase (range)", ContainerTestType::shrink_by_erase_by_range);
+        tester.add_shrink_modifier("erase (free)", ContainerTestType::shrink_by_erase_free);
+        tester.add_shrink_modifier("erase_if", ContainerTestType::shrink_by_erase_if);
+        tester.add_shrink_modifier("remove", ContainerTestType::shrink_by_remove);
+
+        tester.add_neutral_modifier("reverse", ContainerTestType::modify_by_reverse);
+
+        tester.add_grow_modifier("push_back", ContainerTestType::grow_by_push_back);
+        tester.add_grow_modifier("push_back (rvalue)", ContainerTestType::grow_by_push_back_rvalue);
+
+        tester.add_grow_modifier("emplace_back", ContainerTestType::grow_by_emplace_back);
+
+        tester.add_shrink_modifier("pop_back", ContainerTestType::shrink_by_pop_back);
+
+        tester.add_grow_modifier("push_front", ContainerTestType::grow_by_push_front);
+        tester.add_grow_modifier("push_front (rvalue)", ContainerTestType::grow_by_push_front_rvalue);
+
+        tester.add_grow_modifier("emplace_front", ContainerTestType::grow_by_emplace_front);
+
+        tester.add_shrink_modifier("pop_front", ContainerTestType::shrink_by_pop_front);
+
+        return tester.run_operations(operation_count);
+    }
+};
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ftest/test_logging.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "charconv.hpp"
+#include "string.hpp"
+#include "vector.hpp"
+
+class TestLwCharconv {
+   public:
+    static TestLogging::test_result run_integers() {
+        char buffer[72];
+        auto text = [&](lw_std::to_chars_result res) { return std::string(buffer, res.ptr); };
+
+        if (text(lw_std::to_chars(buffer, buffer + 72, 0)) != "0" || text(lw_std::to_chars(buffer, buffer + 72, -42)) != "-42") return {"to_chars"};
+        if (text(lw_std::to_chars(buffer, buffer + 72, INT64_MIN)) != "-9223372036854775808") return {"to_chars (INT64_MIN)"};
+        if (text(lw_std::to_chars(buffer, buffer + 72, int8_t{-128})) != "-128" || text(lw_std::to_chars(buffer, buffer + 72, uint8_t{255})) != "255") return {"to_chars (8 bit)"};
+        if (text(lw_std::to_chars(buffer, buffer + 72, 255, 16)) != "ff" || text(lw_std::to_chars(buffer, buffer + 72, -5, 2)) != "-101" || text(lw_std::to_chars(buffer, buffer + 72, 35u, 36)) != "z") return {"to_chars (bases)"};
+
+        // NOTE: on error ptr is last
+        auto res = lw_std::to_chars(buffer, buffer + 3, 1000);
+        if (res.ec != lw_std::errc::value_too_large || res.ptr != buffer + 3) return {"to_chars (buffer too small)"};
+        if (lw_std::to_chars(buffer, buffer + 3, 999).ec != lw_std::errc{}) return {"to_chars (buffer just large enough)"};
+
+        auto parse = [](const char* s, auto& value, int base = 10) { return lw_std::from_chars(s, s + strlen(s), value, base); };
+
+        int value = 7;
+        if (parse("-123abc", value).ptr[0] != 'a' || value != -123) return {"from_chars"};
+        if (parse("ff", value, 16).ec != lw_std::errc{} || value != 255 || parse("Zz", value, 36).ec != lw_std::errc{} || value != 35 * 36 + 35) return {"from_chars (bases)"};
+        if (parse("-2147483648", value).ec != lw_std::errc{} || value != INT32_MIN) return {"from_chars (INT32_MIN)"};
+
+        // NOTE: like std, no '+', no whitespace, no '-' for unsigned types; on error value is unchanged
+        unsigned u = 7;
+        for (const char* invalid : {"", "+1", " 1", "-1", "x"}) {
+            auto r = parse(invalid, u);
+            if (r.ec != lw_std::errc::invalid_argument || r.ptr != invalid || u != 7) return {"from_chars (invalid)"};
+        }
+
+        uint8_t byte = 7;
+        const char* too_large = "256 ";
+        auto r = parse(too_large, byte);
+        if (r.ec != lw_std::errc::result_out_of_range || r.ptr != too_large + 3 || byte != 7) return {"from_chars (out of range)"};
+        if (parse("-2147483649", value).ec != lw_std::errc::result_out_of_range || parse("2147483648", value).ec != lw_std::errc::result_out_of_range) return {"from_chars (int range)"};
+
+        for (auto failed : {run_random_integers<int8_t>(), run_random_integers<uint16_t>(), run_random_integers<int32_t>(), run_random_integers<uint32_t>(),
+                            run_random_integers<int64_t>(), run_random_integers<uint64_t>()})
+            if (failed != nullptr) return {failed};
+
+        // NOTE: to_string goes through to_chars
+        if (lw_std::to_string(-1234567) != "-1234567" || lw_std::to_string(true) != "1" || lw_std::to_string(uint64_t{18446744073709551615u}) != "18446744073709551615") return {"to_string"};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_floating_point() {
+        char buffer[64];
+        auto text = [&](auto value) { return std::string(buffer, lw_std::to_chars(buffer, buffer + 64, value).ptr); };
+
+        if (text(0.0) != "0" || text(-0.0) != "-0" || text(1.5) != "1.5" || text(-0.1) != "-0.1" || text(100.0) != "100") return {"to_chars (double)"};
+        if (text(1e21) != "1e+21" || text(1e-7) != "1e-07" || text(0.001) != "0.001" || text(123456.789) != "123456.789") return {"to_chars (notation)"};
+        if (text(1.7976931348623157e308) != "1.7976931348623157e+308" || text(5e-324) != "5e-324") return {"to_chars (limits)"};
+        if (text(0.1f) != "0.1" || text(16777216.0f) != "16777216" || text(3.4028235e38f) != "3.4028235e+38") return {"to_chars (float)"};
+        if (text(HUGE_VAL) != "inf" || text(-HUGE_VAL) != "-inf" || text(std::nan("")) != "nan") return {"to_chars (inf, nan)"};
+
+        auto res = lw_std::to_chars(buffer, buffer + 3, 3.25);
+        if (res.ec != lw_std::errc::value_too_large || res.ptr != buffer + 3) return {"to_chars (buffer too small)"};
+
+        auto parse = [](const char* s, auto& value) { return lw_std::from_chars(s, s + strlen(s), value); };
+
+        double d = 7;
+        if (parse("1.5e3x", d).ptr[0] != 'x' || d != 1500) return {"from_chars"};
+        if (parse("-.5", d).ec != lw_std::errc{} || d != -0.5 || parse("5.", d).ec != lw_std::errc{} || d != 5) return {"from_chars (point)"};
+        if (*parse("2e", d).ptr != 'e' || d != 2 || *parse("3e+x", d).ptr != 'e' || d != 3) return {"from_chars (exponent without digits)"};
+        if (parse("0.1", d).ec != lw_std::errc{} || d != 0.1 || parse("123456789012345678901234567890", d).ec != lw_std::errc{} || d != 123456789012345678901234567890.0) return {"from_chars (slow path)"};
+        if (parse("-INFINITY", d).ec != lw_std::errc{} || d != -HUGE_VAL || parse("nan(0x1)", d).ptr[-1] != ')' || d == d) return {"from_chars (inf, nan)"};
+
+        d = 7;
+        for (const char* invalid : {"", ".", "+1", " 1", "-", "e5", "in"}) {
+            auto r = parse(invalid, d);
+            if (r.ec != lw_std::errc::invalid_argument || r.ptr != invalid || d != 7) return {"from_chars (invalid)"};
+        }
+        if (parse("1e400", d).ec != lw_std::errc::result_out_of_range || parse("1e-400", d).ec != lw_std::errc::result_out_of_range || d != 7) return {"from_chars (out of range)"};
+        if (parse("0e99999", d).ec != lw_std::errc{} || d != 0) return {"from_chars (zero)"};
+
+        float f = 0;
+        if (parse("0.1", f).ec != lw_std::errc{} || f != 0.1f || parse("3.4028235e38", f).ec != lw_std::errc{} || parse("1e39", f).ec != lw_std::errc::result_out_of_range) return {"from_chars (float)"};
+
+        for (auto failed : {run_random_floating_point<double, uint64_t>(), run_random_floating_point<float, uint32_t>(), run_parse_precision(), run_parse_long()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_append() {
+        lw_std::vector<char> line;
+        for (int sample : {12, -7, 1000})
+            lw_std::append_chars(line, sample);
+        lw_std::append_chars(line, 0.25);
+        lw_std::append_chars(line, uint8_t{200});
+
+        if (std::string(line.data(), line.size()) != "12-710000.25200") return {"append_chars"};
+
+        // NOTE: the buffer grows geometrically, a long line of samples reallocates O(log n) times
+        lw_std::vector<char> samples;
+        size_t reallocations = 0;
+        for (int i = 0; i < 100000; ++i) {
+            size_t capacity = samples.capacity();
+            lw_std::append_chars(samples, i);
+            samples.push_back(' ');
+            if (samples.capacity() != capacity) ++reallocations;
+        }
+        if (reallocations > 40 || samples.capacity() > 4 * samples.size()) return {"append_chars (amortized growth)"};
+        if (std::string(samples.data() + samples.size() - 12, 12) != "99998 99999 ") return {"append_chars (long line)"};
+
+        return {};
+    }
+
+   private:
+    // NOTE: round trips of random values (of random magnitude), the text has to be the one of std::to_chars
+    template <typename T>
+    static const char* run_random_integers() {
+        std::mt19937_64 rng(8);
+
+        for (size_t i = 0; i < 2000; ++i) {
+            auto value = static_cast<T>(rng() >> (rng() % 64));
+            int base = i % 4 == 0 ? static_cast<int>(2 + rng() % 35) : 10;
+
+            char expected[72], buffer[72];
+            auto expected_end = std::to_chars(expected, expected + 72, value, base).ptr;
+            auto res = lw_std::to_chars(buffer, buffer + 72, value, base);
+            if (res.ec != lw_std::errc{} || std::string(buffer, res.ptr) != std::string(expected, expected_end)) return "to_chars (random)";
+
+            T parsed{};
+            auto parse_res = lw_std::from_chars(buffer, res.ptr, parsed, base);
+            if (parse_res.ec != lw_std::errc{} || parse_res.ptr != res.ptr || parsed != value) return "from_chars (random)";
+        }
+
+        return nullptr;
+    }
+
+    // NOTE: random bit patterns and the significands 0, 1 and all ones of every exponent (where the lower neighbour
+    //       is closer, subnormals), every text has to be the one of std::to_chars, same length and same digits, and
+    //       parse back to the same value (with lw_std and std); some hundred of them need the exact fallback of Grisu3
+    template <typename Float, typename Bits>
+    static const char* run_random_floating_point() {
+        using layout = lw_std::impl::float_layout<Float>;
+        std::mt19937_64 rng(9);
+        std::vector<Bits> patterns;
+
+        for (size_t i = 0; i < 20000; ++i)
+            patterns.push_back(static_cast<Bits>(rng()));
+        for (Bits exponent = 0; exponent < (layout::exponent_mask >> layout::significand_bits); ++exponent)
+            for (Bits significand : {Bits{0}, Bits{1}, layout::significand_mask})
+                patterns.push_back(static_cast<Bits>(exponent << layout::significand_bits) | significand);
+
+        for (auto bits : patterns) {
+            Float value;
+            memcpy(&value, &bits, sizeof(value));
+            if (value != value) continue;
+
+            char expected[64], buffer[64];
+            auto expected_end = std::to_chars(expected, expected + 64, value).ptr;
+            auto res = lw_std::to_chars(buffer, buffer + 64, value);
+            if (res.ec != lw_std::errc{}) return "to_chars (random floating point)";
+            if (std::string(buffer, res.ptr) != std::string(expected, expected_end)) return "to_chars (random floating point, not the shortest and closest digits)";
+
+            Float parsed{}, std_parsed{};
+            auto parse_res = lw_std::from_chars(buffer, res.ptr, parsed);
+            std::from_chars(buffer, res.ptr, std_parsed);
+            if (parse_res.ec != lw_std::errc{} || parse_res.ptr != res.ptr || memcmp(&parsed, &value, sizeof(value)) != 0 || memcmp(&std_parsed, &value, sizeof(value)) != 0) return "to_chars/from_chars (random floating point round trip)";
+        }
+
+        return nullptr;
+    }
+
+    // NOTE: fast and slow path of from_chars against std::from_chars, with 1 to 25 significant digits
+    static const char* run_parse_precision() {
+        std::mt19937_64 rng(10);
+        std::uniform_real_distribution<double> mantissa(1.0, 10.0);
+
+        for (size_t i = 0; i < 20000; ++i) {
+            double value = std::ldexp(mantissa(rng), static_cast<int>(rng() % 200) - 100);
+            int precision = static_cast<int>(rng() % 25);
+            auto format = i % 2 == 0 ? std::chars_format::scientific : std::chars_format::fixed;
+
+            char buffer[512];
+            auto end = std::to_chars(buffer, buffer + 512, value, format, format == std::chars_format::fixed ? precision % 12 : precision).ptr;
+
+            double expected = 0, parsed = 0;
+            std::from_chars(buffer, end, expected);
+            auto res = lw_std::from_chars(buffer, end, parsed);
+            if (res.ec != lw_std::errc{} || res.ptr != end || memcmp(&parsed, &expected, sizeof(parsed)) != 0) return "from_chars (random text)";
+
+            float expected_float = 0, parsed_float = 0;
+            std::from_chars(buffer, end, expected_float);
+            lw_std::from_chars(buffer, end, parsed_float);
+            if (memcmp(&parsed_float, &expected_float, sizeof(parsed_float)) != 0) return "from_chars (random text, float)";
+        }
+
+        return nullptr;
+    }
+
+    // NOTE: inputs of hundreds of characters, e.g. exact decimal expansions, against std::from_chars
+    static const char* run_parse_long() {
+        // NOTE: halfway between 2^53 and 2^53 + 2, the 1 far behind decides to round up (cut off, but not forgotten)
+        std::string halfway = "9007199254740993." + std::string(900, '0') + "1";
+        double d = 0;
+        auto res = lw_std::from_chars(halfway.data(), halfway.data() + halfway.size(), d);
+        if (res.ec != lw_std::errc{} || res.ptr != halfway.data() + halfway.size() || d != 9007199254740994.0) return "from_chars (long input, halfway)";
+
+        std::string exact = "0." + std::string(300, '0') + "1e300";
+        if (lw_std::from_chars(exact.data(), exact.data() + exact.size(), d).ec != lw_std::errc{} || d != 0.1) return "from_chars (long input, leading zeros)";
+
+        std::mt19937_64 rng(11);
+        for (size_t i = 0; i < 2000; ++i) {
+            auto bits = rng();
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            if (value != value || std::isinf(value)) continue;
+
+            char buffer[1200];
+            auto format = i % 2 == 0 ? std::chars_format::scientific : std::chars_format::fixed;
+            auto end = std::to_chars(buffer, buffer + sizeof(buffer), value, format, 200 + static_cast<int>(rng() % 700)).ptr;
+            if (end == buffer + sizeof(buffer) || end - buffer < 200) continue;
+
+            double expected = 0, parsed = 0;
+            std::from_chars(buffer, end, expected);
+            auto parse_res = lw_std::from_chars(buffer, end, parsed);
+            if (parse_res.ec != lw_std::errc{} || parse_res.ptr != end || memcmp(&parsed, &expected, sizeof(parsed)) != 0) return "from_chars (long input)";
+
+            float expected_float = 0, parsed_float = 0;
+            std::from_chars(buffer, end, expected_float);
+            lw_std::from_chars(buffer, end, parsed_float);
+            if (memcmp(&parsed_float, &expected_float, sizeof(parsed_float)) != 0) return "from_chars (long input, float)";
+        }
+
+        return nullptr;
+    }
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <ftest/test_logging.hpp>
+#include <thread>
+#include <vector>
+
+#include "concurrent_unordered_map.hpp"
+#include "non_trivial.hpp"
+
+class TestLwConcurrentUnorderedMap {
+   public:
+    static TestLogging::test_result run() {
+        for (auto failed : {run_single_thread(), run_shards(), run_threads()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    static const char* run_single_thread() {
+        lw_std::concurrent_unordered_map<int, NonTrivial, 4> c;
+        if (!c.empty()) return "empty";
+
+        for (unsigned i = 0; i < 100; ++i)
+            if (!c.insert(static_cast<int>(i), NonTrivial(i))) return "insert";
+
+        if (c.insert(5, NonTrivial(500)) || c.size() != 100) return "insert (existing key)";
+
+        NonTrivial value(0);
+        if (!c.find(5, value) || value.data() != 5) return "find";
+        if (c.find(100, value) || value.data() != 5) return "find (missing key)";
+        if (!c.contains(99) || c.contains(-1)) return "contains";
+
+        if (!c.update(7, [](NonTrivial& x) { x = NonTrivial(x.data() * 10); }) || !c.find(7, value) || value.data() != 70) return "update";
+        if (c.update(-1, [](NonTrivial&) {})) return "update (missing key)";
+
+        if (c.erase(7) != 1 || c.erase(7) != 0 || c.contains(7) || c.size() != 99) return "erase";
+        if (!c.emplace(7, 77u) || !c.find(7, value) || value.data() != 77) return "emplace";
+
+        unsigned sum = 0;
+        size_t count = 0;
+        c.for_each([&](const auto& element) {
+            sum += element.second.data();
+            ++count;
+        });
+        if (count != 100 || sum != 99 * 100 / 2 - 7 + 77) return "for_each";
+
+        c.clear();
+        if (!c.empty() || c.contains(0)) return "clear";
+
+        return nullptr;
+    }
+
+    static const char* run_shards() {
+        using map_type = lw_std::concurrent_unordered_map<int, int, 16>;
+
+        // NOTE: consecutive integers (identity hash) still spread over all shards
+        size_t per_shard[map_type::shard_count] = {};
+        for (int i = 0; i < 1600; ++i)
+            ++per_shard[map_type::shard_index(i)];
+
+        for (auto count : per_shard)
+            if (count < 50 || count > 150) return "shard_index spreads consecutive keys";
+
+        if (lw_std::concurrent_unordered_map<int, int, 1>::shard_index(12345) != 0) return "shard_index (one shard)";
+
+        return nullptr;
+    }
+
+    static const char* run_threads() {
+        static constexpr int thread_count = 8;
+        static constexpr int keys = 64;
+        static constexpr int increments = 2048;
+
+        lw_std::concurrent_unordered_map<int, int, 8> c;
+        for (int key = 0; key < keys; ++key)
+            c.insert(key, 0);
+
+        // NOTE: every thread increments every key, and inserts and erases keys of its own
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; ++t)
+            threads.emplace_back([&c, t] {
+                for (int i = 0; i < increments; ++i) {
+                    c.update(i % keys, [](int& x) { ++x; });
+                    c.update_or_insert(keys + t, 1, [](int& x) { ++x; });
+
+                    int own = 1000 + t * increments + i;
+                    c.insert(own, i);
+                    if (i % 2 == 0) c.erase(own);
+                }
+            });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        int value = 0;
+        for (int key = 0; key < keys; ++key)
+            if (!c.find(key, value) || value != thread_count * increments / keys) return "update from several threads";
+
+        for (int t = 0; t < thread_count; ++t)
+            if (!c.find(keys + t, value) || value != increments) return "update_or_insert from several threads";
+
+        if (c.size() != static_cast<size_t>(keys + thread_count + thread_count * increments / 2)) return "insert/erase from several threads";
+
+        return nullptr;
+    }
+};
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <algorithm>
+#include <ftest/test_logging.hpp>
+#include <random>
+#include <vector>
+
+#include "dynamic_bitset.hpp"
+#include "vector.hpp"
+
+class TestLwDynamicBitset {
+   public:
+    static TestLogging::test_result run() {
+        for (auto failed : {run_single_bits(), run_find(), run_bitwise(), run_resize()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_vector_bool() {
+        std::mt19937 rng(7);
+        lw_std::vector<bool> c;
+        std::vector<bool> verify;
+
+        for (int i = 0; i < 1000; ++i) {
+            bool value = (rng() & 1) != 0;
+            c.push_back(value);
+            verify.push_back(value);
+        }
+
+        for (int i = 0; i < 300; ++i) {
+            c.pop_back();
+            verify.pop_back();
+        }
+
+        c[5] = !c[5];
+        verify[5] = !verify[5];
+        c.back() = true;
+        verify.back() = true;
+
+        if (!equals(c, verify)) return {"push_back/pop_back/operator[]"};
+
+        auto it = c.begin();
+        it += 10;
+        *it = !*it;
+        verify[10] = !verify[10];
+        if (c.end() - c.begin() != static_cast<ptrdiff_t>(verify.size()) || !equals(c, verify)) return {"iterator"};
+
+        c.flip();
+        verify.flip();
+        if (!equals(c, verify)) return {"flip"};
+
+        auto copy = c;
+        if (copy != c) return {"copy/operator=="};
+        copy[0] = !copy[0];
+        if (copy == c) return {"operator!="};
+
+        lw_std::vector<bool> filled(70, true);
+        if (filled.size() != 70 || !filled.front() || !filled.back() || filled.bits().count() != 70) return {"vector(count, value)"};
+
+        lw_std::vector<bool> from_range(verify.begin(), verify.end());
+        if (!equals(from_range, verify)) return {"vector(first, last)"};
+
+        // NOTE: 8 flags per byte instead of one
+        lw_std::vector<bool> flags;
+        flags.resize(100000);
+        if (flags.capacity() > 100000 + 64) return {"bit packed storage"};
+
+        for (auto failed : {run_vector_bool_insert_erase(), run_vector_bool_compare()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    // NOTE: random inserts and erases of single bits and of ranges (across block borders) against std::vector<bool>
+    static const char* run_vector_bool_insert_erase() {
+        std::mt19937 rng(11);
+        lw_std::vector<bool> c(100, true);
+        std::vector<bool> verify(100, true);
+
+        for (int i = 0; i < 2000; ++i) {
+            auto pos = rng() % (verify.size() + 1);
+            auto count = rng() % (i % 3 == 0 ? 150 : 3);
+            bool value = (rng() & 1) != 0;
+            auto at = static_cast<ptrdiff_t>(pos);
+
+            switch (rng() % 5) {
+                case 0: {
+                    auto it = c.insert(c.cbegin() + at, count, value);
+                    verify.insert(verify.begin() + at, count, value);
+                    if (it != c.begin() + at) return "vector<bool>::insert (count) iterator";
+                    break;
+                }
+                case 1: {
+                    std::vector<bool> range;
+                    for (size_t k = 0; k < count; ++k)
+                        range.push_back((rng() & 1) != 0);
+                    c.insert(c.cbegin() + at, range.begin(), range.end());
+                    verify.insert(verify.begin() + at, range.begin(), range.end());
+                    break;
+                }
+                case 2:
+                    c.emplace(c.cbegin() + at, value);
+                    verify.emplace(verify.begin() + at, value);
+                    break;
+                case 3: {
+                    if (pos == verify.size()) break;
+                    auto it = c.erase(c.cbegin() + at);
+                    verify.erase(verify.begin() + at);
+                    if (it != c.begin() + at) return "vector<bool>::erase iterator";
+                    break;
+                }
+                default: {
+                    auto last = static_cast<ptrdiff_t>(pos + std::min<size_t>(count, verify.size() - pos));
+                    c.erase(c.cbegin() + at, c.cbegin() + last);
+                    verify.erase(verify.begin() + at, verify.begin() + last);
+                    break;
+                }
+            }
+
+            if (!equals(c, verify)) return "vector<bool>::insert/emplace/erase";
+            if (c.bits().count() != static_cast<size_t>(std::count(verify.begin(), verify.end(), true))) return "vector<bool>::insert/erase (bits past size)";
+        }
+
+        auto removed = lw_std::erase_if(c, [](bool value) { return value; });
+        auto expected = static_cast<size_t>(std::count(verify.begin(), verify.end(), true));
+        verify.erase(std::remove(verify.begin(), verify.end(), true), verify.end());
+        if (removed != expected || !equals(c, verify)) return "erase_if (vector<bool>)";
+
+        c.assign(130, true);
+        c[3] = false;
+        c[129] = false;
+        if (lw_std::erase(c, false) != 2 || c.size() != 128 || !c.bits().all()) return "erase (vector<bool>)";
+
+        return nullptr;
+    }
+
+    // NOTE: all relational operators of random vectors (many of them prefixes of each other) against std::vector<bool>
+    static const char* run_vector_bool_compare() {
+        std::mt19937 rng(12);
+
+        for (int i = 0; i < 2000; ++i) {
+            std::vector<bool> lhs(rng() % 150, true), rhs;
+            for (size_t k = 0; k < lhs.size(); ++k)
+                lhs[k] = (rng() % 8) != 0;
+
+            rhs = lhs;
+            rhs.resize(rng() % 150, (rng() & 1) != 0);
+            if (!rhs.empty() && rng() % 2 == 0) rhs[rng() % rhs.size()].flip();
+
+            lw_std::vector<bool> a(lhs.begin(), lhs.end()), b(rhs.begin(), rhs.end());
+            if ((a < b) != (lhs < rhs) || (a <= b) != (lhs <= rhs) || (a > b) != (lhs > rhs) || (a >= b) != (lhs >= rhs) || (a == b) != (lhs == rhs))
+                return "vector<bool> relational operators";
+        }
+
+        return nullptr;
+    }
+
+    template <typename Bits>
+    static bool equals(const Bits& c, const std::vector<bool>& verify) {
+        if (c.size() != verify.size()) return false;
+
+        size_t i = 0;
+        for (bool value : c)
+            if (value != verify[i++]) return false;
+
+        return true;
+    }
+
+    static const char* run_single_bits() {
+        lw_std::dynamic_bitset bits(130);
+        if (bits.size() != 130 || bits.num_blocks() != 3 || bits.any() || !bits.none()) return "constructor";
+
+        bits.set(0).set(63).set(64).set(129);
+        if (!bits.test(0) || !bits.test(63) || !bits.test(64) || !bits.test(129) || bits.test(1) || bits.count() != 4) return "set/test";
+
+        bits.reset(63);
+        bits.flip(1);
+        bits[2] = true;
+        if (bits.test(63) || !bits.test(1) || !bits[2] || bits.count() != 5) return "reset/flip/operator[]";
+
+        // NOTE: bits past size() stay zero
+        bits.flip();
+        if (bits.count() != 125 || bits.blocks()[2] != 0b01) return "flip (all)";
+
+        bits.set();
+        if (!bits.all() || bits.count() != 130) return "set (all)";
+
+        bits.reset();
+        if (bits.any()) return "reset (all)";
+
+        return nullptr;
+    }
+
+    static const char* run_find() {
+        lw_std::dynamic_bitset bits(1000);
+        if (bits.find_first() != lw_std::dynamic_bitset::npos) return "find_first (none)";
+
+        std::vector<size_t> set_bits{3, 63, 64, 65, 127, 500, 999};
+        for (auto pos : set_bits)
+            bits.set(pos);
+
+        size_t i = 0;
+        for (auto pos = bits.find_first(); pos != lw_std::dynamic_bitset::npos; pos = bits.find_next(pos)) {
+            if (i == set_bits.size() || pos != set_bits[i]) return "find_first/find_next";
+            ++i;
+        }
+        if (i != set_bits.size()) return "find_next (end)";
+
+        if (bits.find_next(999) != lw_std::dynamic_bitset::npos || bits.find_next(lw_std::dynamic_bitset::npos) != lw_std::dynamic_bitset::npos) return "find_next (past the end)";
+
+        return nullptr;
+    }
+
+    static const char* run_bitwise() {
+        std::mt19937 rng(3);
+
+        // NOTE: sizes around the block and SIMD register widths, so both the vector and the scalar tail are covered
+        for (size_t size : {size_t{1}, size_t{63}, size_t{64}, size_t{200}, size_t{511}, size_t{1000}}) {
+            lw_std::dynamic_bitset a(size), b(size);
+            std::vector<bool> verify_a(size), verify_b(size);
+
+            for (size_t i = 0; i < size; ++i) {
+                verify_a[i] = (rng() & 1) != 0;
+                verify_b[i] = (rng() & 1) != 0;
+                a.set(i, verify_a[i]);
+                b.set(i, verify_b[i]);
+            }
+
+            auto and_bits = a & b;
+            auto or_bits = a | b;
+            auto xor_bits = a ^ b;
+            auto not_bits = ~a;
+
+            std::vector<bool> verify_and(size), verify_or(size), verify_xor(size), verify_not(size);
+            size_t verify_count = 0;
+            for (size_t i = 0; i < size; ++i) {
+                verify_and[i] = verify_a[i] && verify_b[i];
+                verify_or[i] = verify_a[i] || verify_b[i];
+                verify_xor[i] = verify_a[i] != verify_b[i];
+                verify_not[i] = !verify_a[i];
+                if (verify_a[i]) ++verify_count;
+            }
+
+            if (!equals(and_bits, verify_and)) return "operator&";
+            if (!equals(or_bits, verify_or)) return "operator|";
+            if (!equals(xor_bits, verify_xor)) return "operator^";
+            if (!equals(not_bits, verify_not)) return "operator~";
+            if (a.count() != verify_count || not_bits.count() != size - verify_count) return "count";
+
+            a ^= a;
+            if (a.any()) return "operator^= (self)";
+        }
+
+        return nullptr;
+    }
+
+    static const char* run_resize() {
+        lw_std::dynamic_bitset bits;
+        std::vector<bool> verify;
+
+        for (size_t size : {size_t{10}, size_t{100}, size_t{70}, size_t{200}, size_t{3}, size_t{0}, size_t{65}}) {
+            bool value = size % 2 == 0;
+            bits.resize(size, value);
+            verify.resize(size, value);
+            if (!equals(bits, verify) || bits.count() != static_cast<size_t>(std::count(verify.begin(), verify.end(), true))) return "resize";
+        }
+
+        for (int i = 0; i < 70; ++i) {
+            bits.pop_back();
+            verify.pop_back();
+            if (!equals(bits, verify) || bits.num_blocks() != (verify.size() + 63) / 64) return "pop_back";
+            if (verify.empty()) break;
+        }
+
+        return nullptr;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <set>
+
+#include "compile_accelerators/accelerator_defs.hpp"
+#include "container_test_mixin.hpp"
+#include "flat_set.hpp"
+
+class TestLwFlatSet : public ContainerTestDefaultMixin<TestLwFlatSet, lw_std::flat_set, std::set> {
+    friend ContainerTestDefaultMixin;
+
+   private:
+    template <typename ContainerTestType>
+    static TestLogging::test_result run_templated(ContainerTestType& tester, size_t operation_count) {
+        tester.set_test_container_size_getter(ContainerTestType::default_test_container_size_getter);
+        tester.set_verify_container_size_getter(ContainerTestType::default_verify_container_size_getter);
+
+        tester.set_test_container_printer(ContainerTestType::default_test_container_printer);
+        tester.set_verify_container_printer(ContainerTestType::default_verify_container_printer);
+
+        tester.add_neutral_modifier("operator=(const T&)", ContainerTestType::modify_by_copy);
+        tester.add_neutral_modifier("operator=(T&&)", ContainerTestType::modify_by_move);
+
+        tester.add_verifier("element position (iterator)", ContainerTestType::verify_element_position_with_iterator);
+
+        (void)tester.tc().empty();  // just test if it compiles
+        tester.add_verifier("size", ContainerTestType::verify_size);
+        (void)tester.tc().max_size();  // just test if it compiles
+
+        tester.add_shrink_modifier("clear", ContainerTestType::shrink_by_clear);
+
+        tester.add_grow_modifier("insert", ContainerTestType::grow_by_insert_no_pos);
+        tester.add_grow_modifier("insert (rvalue)", ContainerTestType::grow_by_insert_rvalue_no_pos);
+        tester.add_grow_modifier("insert (range)", ContainerTestType::grow_by_insert_range_no_pos);
+
+        tester.add_grow_modifier("emplace", ContainerTestType::grow_by_emplace_no_pos);
+
+        tester.add_shrink_modifier("erase", ContainerTestType::shrink_by_erase_by_iterator_no_pos);
+        tester.add_shrink_modifier("erase (value)", ContainerTestType::shrink_by_erase_by_value);
+
+        (void)tester.tc().count(0);  // just test if it compiles
+        tester.add_verifier("find (existing)", ContainerTestType::verify_find_existing_element);
+        tester.add_verifier("find (element inclusion)", ContainerTestType::verify_element_inclusion);
+        (void)tester.tc().contains(0);  // just test if it compiles
+
+        (void)tester.tc().lower_bound(0);  // just test if it compiles
+        (void)tester.tc().upper_bound(0);  // just test if it compiles
+        (void)tester.tc().equal_range(0);  // just test if it compiles
+
+        tester.add_neutral_modifier("swap", ContainerTestType::modify_by_swap);
+
+        return tester.run_operations(operation_count);
+    }
+};
+
+extern LWSTD_TEST_ACCELERATE_VERIFY_WITH(TestLwFlatSet, flat_set, set, int);
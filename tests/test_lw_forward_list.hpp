@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <forward_list>
+#include <ftest/test_logging.hpp>
+#include <initializer_list>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "forward_list.hpp"
+#include "non_trivial.hpp"
+
+class TestLwForwardList {
+   public:
+    static TestLogging::test_result run(size_t operation_count) {
+        std::mt19937 rng(11);
+        lw_std::forward_list<NonTrivial> c;
+        std::forward_list<NonTrivial> verify;
+        size_t size = 0;
+
+        for (size_t op = 0; op < operation_count; ++op) {
+            // NOTE: the position is the element after which is inserted or erased, 0 is before_begin()
+            auto pos = static_cast<ptrdiff_t>(rng() % (size + 1));
+            auto value = static_cast<unsigned>(rng() % 100);
+
+            switch (rng() % 8) {
+                case 0:
+                case 1:
+                    c.push_front(NonTrivial(value));
+                    verify.push_front(NonTrivial(value));
+                    ++size;
+                    break;
+                case 2:
+                case 3:
+                    if (*c.insert_after(lw_std::next(c.cbefore_begin(), pos), NonTrivial(value)) != NonTrivial(value)) return {"insert_after (returned iterator)"};
+                    verify.insert_after(std::next(verify.cbefore_begin(), pos), NonTrivial(value));
+                    ++size;
+                    break;
+                case 4:
+                    c.insert_after(lw_std::next(c.cbefore_begin(), pos), 3, NonTrivial(value));
+                    verify.insert_after(std::next(verify.cbefore_begin(), pos), 3, NonTrivial(value));
+                    size += 3;
+                    break;
+                case 5:
+                    if (static_cast<size_t>(pos) < size) {
+                        c.erase_after(lw_std::next(c.cbefore_begin(), pos));
+                        verify.erase_after(std::next(verify.cbefore_begin(), pos));
+                        --size;
+                    }
+                    break;
+                case 6:
+                    if (!c.empty()) {
+                        c.pop_front();
+                        verify.pop_front();
+                        --size;
+                    }
+                    break;
+                case 7: {
+                    auto count = c.remove(NonTrivial(value));
+                    verify.remove(NonTrivial(value));
+                    size -= count;
+                    break;
+                }
+            }
+
+            if (!equals(c, verify)) return {"operation " + std::to_string(op)};
+        }
+
+        auto copy = c;
+        if (copy != c) return {"copy/operator=="};
+
+        c.erase_after(c.cbefore_begin(), c.cend());
+        if (!c.empty()) return {"erase_after (range)"};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_operations() {
+        for (auto failed : {run_splice_after(), run_merge(), run_sort()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    template <typename T, typename Verify>
+    static bool equals(const lw_std::forward_list<T>& c, const Verify& verify) {
+        auto it = c.begin();
+        for (const auto& value : verify)
+            if (it == c.end() || *it++ != value) return false;
+
+        return it == c.end();
+    }
+
+    static lw_std::forward_list<int> make_list(std::initializer_list<int> values) {
+        return lw_std::forward_list<int>(values.begin(), values.end());
+    }
+
+    static const char* run_splice_after() {
+        auto a = make_list({1, 2, 3});
+        auto b = make_list({10, 20, 30, 40});
+
+        // NOTE: moves the elements in (first, last)
+        a.splice_after(a.cbegin(), b, b.cbegin(), lw_std::next(b.cbegin(), 3));
+        if (!equals(a, std::vector<int>{1, 20, 30, 2, 3}) || !equals(b, std::vector<int>{10, 40})) return "splice_after (range)";
+
+        a.splice_after(a.cbefore_begin(), b, b.cbegin());
+        if (!equals(a, std::vector<int>{40, 1, 20, 30, 2, 3}) || !equals(b, std::vector<int>{10})) return "splice_after (one element)";
+
+        a.splice_after(lw_std::next(a.cbegin(), 5), a, a.cbefore_begin());
+        if (!equals(a, std::vector<int>{1, 20, 30, 2, 3, 40})) return "splice_after (one element, same list)";
+
+        a.splice_after(a.cbefore_begin(), a, a.cbefore_begin());
+        if (!equals(a, std::vector<int>{1, 20, 30, 2, 3, 40})) return "splice_after (onto itself)";
+
+        a.splice_after(a.cbegin(), lw_std::move(b));
+        if (!equals(a, std::vector<int>{1, 10, 20, 30, 2, 3, 40}) || !b.empty()) return "splice_after (list)";
+
+        b.splice_after(b.cbefore_begin(), a);
+        if (!a.empty() || !equals(b, std::vector<int>{1, 10, 20, 30, 2, 3, 40})) return "splice_after (into empty list)";
+
+        return nullptr;
+    }
+
+    static const char* run_merge() {
+        auto a = make_list({1, 4, 4, 9});
+        auto b = make_list({0, 4, 5, 12, 13});
+
+        a.merge(b);
+        if (!equals(a, std::vector<int>{0, 1, 4, 4, 4, 5, 9, 12, 13}) || !b.empty()) return "merge";
+
+        a.reverse();
+        if (!equals(a, std::vector<int>{13, 12, 9, 5, 4, 4, 4, 1, 0})) return "reverse";
+
+        if (a.unique() != 2 || !equals(a, std::vector<int>{13, 12, 9, 5, 4, 1, 0})) return "unique";
+        if (a.remove_if([](int x) { return x % 2 == 0; }) != 3 || !equals(a, std::vector<int>{13, 9, 5, 1})) return "remove_if";
+
+        return nullptr;
+    }
+
+    static const char* run_sort() {
+        // NOTE: stable, elements with the same key keep their order
+        lw_std::forward_list<std::pair<int, int>> pairs;
+        std::vector<std::pair<int, int>> verify;
+        for (int i = 0; i < 1000; ++i) {
+            pairs.push_front({(i * 7919) % 37, i});
+            verify.insert(verify.begin(), {(i * 7919) % 37, i});
+        }
+
+        auto by_key = [](const std::pair<int, int>& x, const std::pair<int, int>& y) { return x.first < y.first; };
+        pairs.sort(by_key);
+        std::stable_sort(verify.begin(), verify.end(), by_key);
+        if (!equals(pairs, verify)) return "sort (stable)";
+
+        // NOTE: only the links change, no element is constructed, copied or moved
+        lw_std::forward_list<NonTrivial> c;
+        for (unsigned i = 0; i < 100; ++i)
+            c.emplace_front((i * 31) % 100);
+
+        NonTrivial::counters() = {};
+        c.sort();
+        auto counters = NonTrivial::counters();
+        if (counters.constructions != 0 || counters.copies != 0 || counters.moves != 0) return "sort moves no element";
+
+        unsigned expected = 0;
+        for (const auto& element : c)
+            if (element.data() != expected++) return "sort";
+
+        return nullptr;
+    }
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <ftest/test_logging.hpp>
+#include <random>
+#include <unordered_set>
+
+#include "frozen_map.hpp"
+
+class TestLwFrozenMap {
+   public:
+    static TestLogging::test_result run() {
+        for (auto failed : {run_constexpr(), run_string_keys(), run_string_view_keys(), run_random()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    enum class reg { status, control, data, irq };
+
+    // NOTE: a key of its own with its own Hash, both usable in constant expressions
+    struct name {
+        const char* str;
+        size_t len;
+
+        constexpr name(const char* s = "") : str(s), len(0) {
+            while (s[len] != '\0')
+                ++len;
+        }
+
+        constexpr bool operator==(const name& other) const {
+            if (len != other.len) return false;
+            for (size_t i = 0; i < len; ++i)
+                if (str[i] != other.str[i]) return false;
+            return true;
+        }
+    };
+
+    struct name_hash {
+        constexpr size_t operator()(const name& key) const {
+            return lw_std::impl::hash_bytes(key.str, key.len);
+        }
+    };
+
+    static const char* run_constexpr() {
+        static constexpr auto registers = lw_std::make_frozen_map<reg, unsigned>({{reg::status, 0x10u}, {reg::control, 0x14u}, {reg::data, 0x18u}});
+
+        // NOTE: evaluated by the compiler, the table is built and searched in constant expressions
+        static_assert(registers.size() == 3);
+        static_assert(registers.find(reg::control)->second == 0x14u);
+        static_assert(!registers.contains(reg::irq) && registers.count(reg::data) == 1);
+        static_assert(registers.get_or(reg::irq, 0u) == 0u);
+
+        if (registers.find(reg::irq) != registers.end() || registers.find(reg::status)->second != 0x10u) return "find";
+
+        // NOTE: the entries keep the order they were given in
+        unsigned expected = 0x10u;
+        for (const auto& entry : registers) {
+            if (entry.second != expected) return "iteration order";
+            expected += 4;
+        }
+
+        return nullptr;
+    }
+
+    static const char* run_string_keys() {
+        static constexpr auto commands = lw_std::make_frozen_map<name, int, name_hash>({{"start", 1}, {"stop", 2}, {"reset", 3}, {"status", 4}, {"a", 5}, {"ab", 6}, {"abc", 7}, {"abcd", 8}, {"abcde", 9}});
+
+        static_assert(commands.get_or("reset", 0) == 3);
+        static_assert(commands.get_or("abcd", 0) == 8);
+        static_assert(!commands.contains("abcdef") && !commands.contains(""));
+
+        if (commands.get_or("status", 0) != 4 || commands.get_or("ab", 0) != 6 || commands.contains("sto")) return "string keys";
+
+        return nullptr;
+    }
+
+    // NOTE: hash<string_view> and equal_to<string_view> are constexpr, so the defaults build the table at compile time
+    static const char* run_string_view_keys() {
+        static constexpr auto commands = lw_std::make_frozen_map<lw_std::string_view, int>({{"start", 1}, {"stop", 2}, {"reset", 3}, {"status", 4}, {"", 5}, {"st", 6}});
+
+        static_assert(commands.size() == 6);
+        static_assert(commands.get_or("reset", 0) == 3 && commands.get_or("", 0) == 5);
+        static_assert(!commands.contains("sta") && !commands.contains("status "));
+
+        // NOTE: views into a longer buffer, as a command parser would pass them
+        const char line[] = "stop st";
+        if (commands.get_or(lw_std::string_view(line, 4), 0) != 2 || commands.get_or(lw_std::string_view(line + 5, 2), 0) != 6) return "string_view keys";
+        if (commands.contains(lw_std::string_view(line, 3))) return "string_view keys (prefix)";
+
+        return nullptr;
+    }
+
+    static const char* run_random() {
+        static constexpr size_t size = 700;
+
+        // NOTE: built at runtime, the same code the compiler runs for a constexpr table
+        std::mt19937 rng(5);
+        std::unordered_set<int> keys;
+        lw_std::pair<int, int> entries[size];
+        for (size_t i = 0; i < size;) {
+            int key = static_cast<int>(rng());
+            if (keys.insert(key).second) entries[i++] = {key, key / 2};
+        }
+
+        lw_std::frozen_map<int, int, size> c(entries);
+        for (const auto& entry : entries)
+            if (c.get_or(entry.first, 0) != entry.first / 2) return "find (random keys)";
+
+        for (size_t i = 0; i < 10000; ++i) {
+            int key = static_cast<int>(rng());
+            if (c.contains(key) != (keys.count(key) == 1)) return "contains (random keys)";
+        }
+
+        return nullptr;
+    }
+};
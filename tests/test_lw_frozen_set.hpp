@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <ftest/test_logging.hpp>
+
+#include "frozen_set.hpp"
+
+class TestLwFrozenSet {
+   public:
+    static TestLogging::test_result run() {
+        static constexpr auto opcodes = lw_std::make_frozen_set<uint8_t>({0x01, 0x3C, 0x7F, 0x80, 0xFF});
+
+        static_assert(opcodes.size() == 5);
+        static_assert(opcodes.contains(0x7F) && opcodes.contains(0xFF) && !opcodes.contains(0x00));
+
+        unsigned found = 0;
+        for (unsigned op = 0; op < 256; ++op)
+            found += static_cast<unsigned>(opcodes.count(static_cast<uint8_t>(op)));
+        if (found != 5) return {"count"};
+
+        if (*opcodes.find(0x3C) != 0x3C || opcodes.find(0x3D) != opcodes.end()) return {"find"};
+        if (*opcodes.begin() != 0x01 || opcodes.end() - opcodes.begin() != 5) return {"iteration"};
+
+        // NOTE: one key is the smallest table, every lookup lands on it
+        static constexpr auto single = lw_std::make_frozen_set<int>({42});
+        static_assert(single.contains(42) && !single.contains(0));
+
+        return {};
+    }
+};
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <ftest/test_logging.hpp>
+#include <list>
+
+#include "intrusive_list.hpp"
+#include "vector.hpp"
+
+class TestLwIntrusiveList {
+   public:
+    static TestLogging::test_result run() {
+        for (auto failed : {run_modifiers(), run_unlink(), run_move(), run_tags()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    struct Timer : lw_std::intrusive_list_hook<> {
+        explicit Timer(int timer_id)
+            : id(timer_id) {}
+
+        int id;
+    };
+
+    using TimerList = lw_std::intrusive_list<Timer>;
+
+    static bool equals(const TimerList& c, const std::list<int>& verify) {
+        if (c.size() != verify.size()) return false;
+
+        auto it = c.begin();
+        for (int id : verify) {
+            if (it->id != id) return false;
+            ++it;
+        }
+
+        // NOTE: and the same backwards
+        auto reverse_it = c.end();
+        for (auto verify_it = verify.rbegin(); verify_it != verify.rend(); ++verify_it)
+            if ((--reverse_it)->id != *verify_it) return false;
+
+        return it == c.end() && reverse_it == c.begin();
+    }
+
+    static const char* run_modifiers() {
+        lw_std::vector<Timer> timers;
+        timers.reserve(10);
+        for (int i = 0; i < 10; ++i)
+            timers.emplace_back(i);
+
+        TimerList c;
+        std::list<int> verify;
+        if (!c.empty() || c.begin() != c.end()) return "empty";
+
+        for (int i = 0; i < 5; ++i) {
+            c.push_back(timers[static_cast<size_t>(i)]);
+            verify.push_back(i);
+        }
+        c.push_front(timers[5]);
+        verify.push_front(5);
+        c.insert(lw_std::next(c.begin(), 3), timers[6]);
+        verify.insert(std::next(verify.begin(), 3), 6);
+        if (!equals(c, verify) || c.front().id != 5 || c.back().id != 4) return "push_back/push_front/insert";
+
+        auto it = c.erase(c.iterator_to(timers[6]));
+        verify.remove(6);
+        if (it->id != 2 || !equals(c, verify) || timers[6].is_linked()) return "erase";
+
+        c.pop_front();
+        c.pop_back();
+        verify.pop_front();
+        verify.pop_back();
+        if (!equals(c, verify)) return "pop_front/pop_back";
+
+        if (c.remove_if([](const Timer& timer) { return timer.id % 2 == 1; }) != 2) return "remove_if (count)";
+        verify.remove_if([](int id) { return id % 2 == 1; });
+        if (!equals(c, verify)) return "remove_if";
+
+        c.clear();
+        if (!c.empty() || timers[0].is_linked()) return "clear";
+
+        return nullptr;
+    }
+
+    static const char* run_unlink() {
+        TimerList c;
+        Timer a(1), b(2);
+        c.push_back(a);
+        c.push_back(b);
+
+        {
+            Timer temporary(3);
+            c.insert(c.iterator_to(b), temporary);
+            if (!equals(c, {1, 3, 2})) return "insert before iterator_to";
+        }
+        if (!equals(c, {1, 2})) return "destructor unlinks";
+
+        a.unlink();
+        if (!equals(c, {2}) || a.is_linked()) return "unlink from anywhere";
+
+        // NOTE: a copy is not linked, the original stays where it is
+        Timer copy(b);
+        if (copy.is_linked() || !equals(c, {2})) return "copy of a linked element";
+
+        return nullptr;
+    }
+
+    static const char* run_move() {
+        Timer a(1), b(2), d(4);
+        TimerList c;
+        c.push_back(a);
+        c.push_back(b);
+
+        TimerList moved(lw_std::move(c));
+        if (!c.empty() || !equals(moved, {1, 2})) return "move constructor";
+
+        TimerList other;
+        other.push_back(d);
+        other.swap(moved);
+        if (!equals(other, {1, 2}) || !equals(moved, {4})) return "swap";
+
+        moved = lw_std::move(other);
+        if (!equals(moved, {1, 2}) || !other.empty() || d.is_linked()) return "move assignment";
+
+        return nullptr;
+    }
+
+    struct by_deadline;
+    struct by_owner;
+
+    // NOTE: one hook per list, an element is in both lists at once
+    struct Task : lw_std::intrusive_list_hook<by_deadline>, lw_std::intrusive_list_hook<by_owner> {
+        explicit Task(int task_id)
+            : id(task_id) {}
+
+        int id;
+    };
+
+    static const char* run_tags() {
+        Task a(1), b(2), d(3);
+        lw_std::intrusive_list<Task, by_deadline> deadlines;
+        lw_std::intrusive_list<Task, by_owner> owned;
+
+        deadlines.push_back(a);
+        deadlines.push_back(b);
+        deadlines.push_back(d);
+        owned.push_back(d);
+        owned.push_back(a);
+        if (deadlines.front().id != 1 || deadlines.back().id != 3 || owned.front().id != 3 || owned.back().id != 1) return "two hooks";
+
+        a.lw_std::intrusive_list_hook<by_owner>::unlink();
+        if (deadlines.size() != 3 || owned.size() != 1 || &owned.front() != &d) return "unlink by tag";
+
+        return nullptr;
+    }
+};
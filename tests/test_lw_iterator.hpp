@@ -0,0 +1,160 @@
+#pragma once
+
+#include <ftest/test_logging.hpp>
+#include <list>
+#include <vector>
+
+#include "iterator.hpp"
+#include "list.hpp"
+#include "type_traits.hpp"
+#include "unordered_set.hpp"
+#include "vector.hpp"
+
+class TestLwIterator {
+   public:
+    static TestLogging::test_result run() {
+        static_assert(lw_std::is_same_v<lw_std::iterator_traits<lw_std::vector<int>::iterator>::iterator_category, lw_std::random_access_iterator_tag>);
+        static_assert(lw_std::is_same_v<lw_std::iterator_traits<lw_std::vector<int>::const_iterator>::value_type, int>);
+        static_assert(lw_std::is_same_v<lw_std::iterator_traits<lw_std::list<int>::iterator>::iterator_category, lw_std::bidirectional_iterator_tag>);
+        static_assert(lw_std::is_same_v<lw_std::iterator_traits<lw_std::unordered_set<int>::iterator>::iterator_category, lw_std::forward_iterator_tag>);
+        static_assert(lw_std::is_same_v<lw_std::iterator_traits<const int*>::iterator_category, lw_std::random_access_iterator_tag>);
+        static_assert(lw_std::is_same_v<lw_std::iterator_traits<const int*>::value_type, int>);
+
+        for (auto failed : {run_random_access(), run_bidirectional(), run_operations(), run_range_construction()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    // NOTE: only has what an input iterator needs, so containers have to take the single pass path
+    struct InputOnly {
+        using iterator_category = lw_std::input_iterator_tag;
+        using value_type = int;
+        using difference_type = ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        const int* current;
+
+        const int& operator*() const {
+            return *current;
+        }
+
+        InputOnly& operator++() {
+            ++current;
+            return *this;
+        }
+
+        bool operator!=(const InputOnly& other) const {
+            return current != other.current;
+        }
+    };
+
+    static const char* run_random_access() {
+        lw_std::vector<int> v;
+        for (int i = 0; i < 20; ++i)
+            v.push_back(i * i);
+
+        auto first = v.begin();
+        for (int i = 0; i <= 20; ++i) {
+            for (int j = 0; j <= 20; ++j) {
+                auto a = first + i;
+                auto b = first + j;
+
+                if (b - a != j - i) return "operator- (iterator)";
+                if ((a < b) != (i < j) || (a > b) != (i > j) || (a <= b) != (i <= j) || (a >= b) != (i >= j)) return "relational operators";
+                if (b - (j - i) != a) return "operator- (n)";
+            }
+
+            if (i < 20 && (first[i] != i * i || *(i + first) != i * i)) return "operator[]";
+        }
+
+        auto it = v.end();
+        --it;
+        if (*it != 19 * 19 || *(it--) != 19 * 19 || *it != 18 * 18) return "operator--";
+
+        it -= 5;
+        if (*it != 13 * 13) return "operator-=";
+        it += 2;
+        if (*it != 15 * 15) return "operator+=";
+
+        lw_std::vector<int>::const_iterator cit = v.begin() + 3;
+        if (v.cend() - cit != 17) return "const_iterator difference";
+
+        return nullptr;
+    }
+
+    static const char* run_bidirectional() {
+        lw_std::list<int> l;
+        std::list<int> verify;
+        for (int i = 0; i < 10; ++i) {
+            l.push_back(i);
+            verify.push_back(i);
+        }
+
+        auto it = l.end();
+        auto verify_it = verify.end();
+        while (verify_it != verify.begin()) {
+            --it;
+            --verify_it;
+            if (*it != *verify_it) return "list operator--";
+        }
+        if (it != l.begin()) return "list operator-- (begin)";
+
+        if (*lw_std::prev(l.end()) != 9 || *lw_std::prev(l.end(), 3) != 7) return "list prev";
+        if (*lw_std::next(l.begin(), 4) != 4) return "list next";
+
+        auto back = l.end();
+        lw_std::advance(back, -10);
+        if (back != l.begin()) return "list advance (negative)";
+
+        lw_std::list<int>::const_iterator cit = l.cend();
+        if (*--cit != 9) return "list const_iterator operator--";
+
+        return nullptr;
+    }
+
+    static const char* run_operations() {
+        lw_std::vector<int> v(7, 1);
+        if (lw_std::distance(v.begin(), v.end()) != 7 || lw_std::distance(v.data(), v.data() + 3) != 3) return "vector distance";
+        if (lw_std::next(v.begin(), 5) != v.begin() + 5 || lw_std::prev(v.end(), 2) != v.begin() + 5) return "vector next/prev";
+
+        lw_std::list<int> l;
+        for (int i = 0; i < 5; ++i)
+            l.push_back(i);
+        if (lw_std::distance(l.begin(), l.end()) != 5) return "list distance";
+
+        lw_std::unordered_set<int> s;
+        for (int i = 0; i < 30; ++i)
+            s.insert(i * 7);
+        if (lw_std::distance(s.begin(), s.end()) != 30) return "unordered_set distance";
+
+        return nullptr;
+    }
+
+    static const char* run_range_construction() {
+        lw_std::vector<int> counted(5, 7);
+        if (counted.size() != 5 || counted[4] != 7) return "vector(count, value) with int arguments";
+
+        std::vector<int> source{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+
+        lw_std::vector<int> from_pointers(source.data(), source.data() + source.size());
+        if (from_pointers.size() != source.size() || from_pointers.capacity() != source.size()) return "vector(first, last) allocates once";
+
+        lw_std::list<int> l;
+        l.assign(source.begin(), source.end());
+        lw_std::vector<int> from_list(l.begin(), l.end());
+        if (from_list.size() != source.size() || from_list.back() != 12) return "vector(first, last) from list";
+
+        lw_std::vector<int> assigned;
+        assigned.assign(l.begin(), l.end());
+        if (assigned.size() != source.size() || assigned.capacity() != source.size()) return "assign allocates once";
+
+        lw_std::vector<int> input(2, 0);
+        input.insert(input.begin() + 1, InputOnly{source.data()}, InputOnly{source.data() + 4});
+        if (input.size() != 6 || input[0] != 0 || input[1] != 1 || input[4] != 4 || input[5] != 0) return "insert (input iterators)";
+
+        return nullptr;
+    }
+};
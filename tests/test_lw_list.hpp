@@ -1,6 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <initializer_list>
 #include <list>
+#include <utility>
+#include <vector>
 
 #include "compile_accelerators/accelerator_defs.hpp"
 #include "container_test_mixin.hpp"
@@ -9,7 +13,145 @@
 class TestLwList : public ContainerTestDefaultMixin<TestLwList, lw_std::list, std::list> {
     friend ContainerTestDefaultMixin;
 
+   public:
+    static TestLogging::test_result run_operations() {
+        for (auto failed : {run_splice(), run_merge(), run_sort(), run_erase_allocator()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
    private:
+    static lw_std::list<int> make_list(std::initializer_list<int> values) {
+        lw_std::list<int> res;
+        res.assign(values.begin(), values.end());
+        return res;
+    }
+
+    template <typename T>
+    static bool equals(const lw_std::list<T>& c, std::initializer_list<T> verify) {
+        if (c.size() != verify.size() || !std::equal(c.begin(), c.end(), verify.begin(), verify.end())) return false;
+
+        // NOTE: the prev links and the back node have to be right as well
+        auto it = c.end();
+        for (auto verify_it = verify.end(); verify_it != verify.begin();)
+            if (*--it != *--verify_it) return false;
+
+        return it == c.begin();
+    }
+
+    static const char* run_splice() {
+        auto a = make_list({1, 2, 3});
+        auto b = make_list({10, 20, 30, 40});
+
+        a.splice(lw_std::next(a.begin()), b, lw_std::next(b.begin()), lw_std::prev(b.end()));
+        if (!equals(a, {1, 20, 30, 2, 3}) || !equals(b, {10, 40})) return "splice (range)";
+
+        a.splice(a.end(), b, b.begin());
+        if (!equals(a, {1, 20, 30, 2, 3, 10}) || !equals(b, {40})) return "splice (one element)";
+
+        a.splice(a.end(), b, b.begin());
+        if (!equals(a, {1, 20, 30, 2, 3, 10, 40}) || !b.empty()) return "splice (last element to the end)";
+
+        // NOTE: within one list, nodes are only relinked
+        a.splice(a.begin(), a, lw_std::prev(a.end()));
+        if (!equals(a, {40, 1, 20, 30, 2, 3, 10})) return "splice (one element, same list)";
+
+        a.splice(a.end(), a, a.begin(), lw_std::next(a.begin(), 3));
+        if (!equals(a, {30, 2, 3, 10, 40, 1, 20})) return "splice (range, same list)";
+
+        a.splice(a.begin(), a, a.begin());
+        if (!equals(a, {30, 2, 3, 10, 40, 1, 20})) return "splice (onto itself)";
+
+        b = make_list({7, 8});
+        a.splice(a.begin(), lw_std::move(b));
+        if (!equals(a, {7, 8, 30, 2, 3, 10, 40, 1, 20}) || !b.empty()) return "splice (list)";
+
+        b.splice(b.end(), a);
+        if (!a.empty() || b.size() != 9 || b.back() != 20) return "splice (into empty list)";
+
+        return nullptr;
+    }
+
+    static const char* run_merge() {
+        auto a = make_list({1, 4, 4, 9});
+        auto b = make_list({0, 4, 5, 12, 13});
+
+        a.merge(b);
+        if (!equals(a, {0, 1, 4, 4, 4, 5, 9, 12, 13}) || !b.empty()) return "merge";
+
+        b = make_list({3, 2});
+        a.reverse();
+        a.merge(b, [](int x, int y) { return x > y; });
+        if (!equals(a, {13, 12, 9, 5, 4, 4, 4, 3, 2, 1, 0})) return "merge (compare)";
+
+        a.merge(a);
+        if (a.size() != 11) return "merge (itself)";
+
+        if (a.unique() != 2 || !equals(a, {13, 12, 9, 5, 4, 3, 2, 1, 0})) return "unique";
+        if (a.unique([](int x, int y) { return x - y == 1; }) != 4 || !equals(a, {13, 9, 5, 3, 1})) return "unique (predicate)";
+
+        return nullptr;
+    }
+
+    static const char* run_sort() {
+        // NOTE: stable, elements with the same key keep their order
+        lw_std::list<std::pair<int, int>> pairs;
+        std::vector<std::pair<int, int>> verify;
+        for (int i = 0; i < 1000; ++i) {
+            pairs.push_back({(i * 7919) % 37, i});
+            verify.push_back({(i * 7919) % 37, i});
+        }
+
+        auto by_key = [](const std::pair<int, int>& x, const std::pair<int, int>& y) { return x.first < y.first; };
+        pairs.sort(by_key);
+        std::stable_sort(verify.begin(), verify.end(), by_key);
+        if (!std::equal(pairs.begin(), pairs.end(), verify.begin(), verify.end())) return "sort (stable)";
+        if (pairs.back() != verify.back() || *lw_std::prev(pairs.end(), 2) != verify[verify.size() - 2]) return "sort (back)";
+
+        // NOTE: only the links change, no element is constructed, copied or moved
+        lw_std::list<NonTrivial> c;
+        for (unsigned i = 0; i < 100; ++i)
+            c.emplace_back((i * 31) % 100);
+
+        NonTrivial::counters() = {};
+        c.sort();
+        auto counters = NonTrivial::counters();
+        if (counters.constructions != 0 || counters.copies != 0 || counters.moves != 0) return "sort moves no element";
+
+        unsigned expected = 0;
+        for (const auto& element : c)
+            if (element.data() != expected++) return "sort";
+
+        return nullptr;
+    }
+
+    // NOTE: stateless, but not the default allocator
+    template <typename T>
+    struct other_allocator : lw_std::allocator<T> {
+        template <typename U>
+        struct rebind {
+            typedef other_allocator<U> other;
+        };
+
+        other_allocator() = default;
+
+        template <typename U>
+        other_allocator(const other_allocator<U>&) {}
+    };
+
+    // NOTE: the free erase and erase_if take a list with any allocator
+    static const char* run_erase_allocator() {
+        lw_std::list<int, other_allocator<int>> c;
+        for (int i = 0; i < 10; ++i)
+            c.push_back(i % 4);
+
+        if (lw_std::erase(c, 3) != 2 || c.size() != 8) return "erase (custom allocator)";
+        if (lw_std::erase_if(c, [](int value) { return value % 2 == 1; }) != 3 || !std::equal(c.begin(), c.end(), std::vector<int>{0, 2, 0, 2, 0}.begin())) return "erase_if (custom allocator)";
+
+        return nullptr;
+    }
+
     template <typename ContainerTestType>
     static TestLogging::test_result run_templated(ContainerTestType& tester, size_t operation_count) {
         tester.set_test_container_size_getter(ContainerTestType::default_test_container_size_getter);
@@ -44,6 +186,13 @@ class TestLwList : public ContainerTestDefaultMixin<TestLwList, lw_std::list, st
 
         tester.add_shrink_modifier("erase", ContainerTestType::shrink_by_erase_by_iterator);
         tester.add_shrink_modifier("erase (range)", ContainerTestType::shrink_by_erase_by_range);
+        tester.add_shrink_modifier("erase (free)", ContainerTestType::shrink_by_erase_free);
+        tester.add_shrink_modifier("erase_if", ContainerTestType::shrink_by_erase_if);
+        tester.add_shrink_modifier("remove", ContainerTestType::shrink_by_remove);
+        tester.add_shrink_modifier("unique", ContainerTestType::shrink_by_unique);
+
+        tester.add_neutral_modifier("sort", ContainerTestType::modify_by_sort);
+        tester.add_neutral_modifier("reverse", ContainerTestType::modify_by_reverse);
 
         tester.add_grow_modifier("push_back", ContainerTestType::grow_by_push_back);
         tester.add_grow_modifier("push_back (rvalue)", ContainerTestType::grow_by_push_back_rvalue);
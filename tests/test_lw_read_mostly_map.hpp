@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <ftest/test_logging.hpp>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "non_trivial.hpp"
+#include "read_mostly_map.hpp"
+
+class TestLwReadMostlyMap {
+   public:
+    static TestLogging::test_result run() {
+        for (auto failed : {run_single_thread(), run_readers_and_writer()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    static const char* run_single_thread() {
+        lw_std::read_mostly_map<int, NonTrivial> c;
+        NonTrivial value(0);
+        if (!c.empty() || c.bucket_count() != 0 || c.find(1, value) || c.contains(1)) return "empty";
+
+        for (unsigned i = 0; i < 100; ++i)
+            if (!c.insert(static_cast<int>(i), NonTrivial(i))) return "insert";
+
+        if (c.insert(5, NonTrivial(500)) || c.size() != 100 || c.bucket_count() < 100) return "insert (existing key)";
+
+        if (!c.find(5, value) || value.data() != 5) return "find";
+        if (c.find(100, value) || value.data() != 5) return "find (missing key)";
+        if (!c.contains(99) || c.contains(-1)) return "contains";
+
+        if (c.insert_or_assign(7, NonTrivial(70)) || !c.find(7, value) || value.data() != 70 || c.size() != 100) return "insert_or_assign (assign)";
+        if (!c.insert_or_assign(100, NonTrivial(1000)) || !c.find(100, value) || value.data() != 1000 || c.size() != 101) return "insert_or_assign (insert)";
+
+        unsigned visited = 0;
+        if (!c.visit(100, [&](const NonTrivial& x) { visited = x.data(); }) || visited != 1000) return "visit";
+        if (c.visit(-1, [&](const NonTrivial&) { visited = 0; }) || visited != 1000) return "visit (missing key)";
+
+        if (c.erase(7) != 1 || c.erase(7) != 0 || c.contains(7) || c.size() != 100) return "erase";
+        for (int i = 0; i < 101; i += 2)
+            c.erase(i);
+        for (int i = 1; i < 100; i += 2)
+            if (i != 7 && (!c.find(i, value) || value.data() != static_cast<unsigned>(i))) return "erase keeps the other keys";
+
+        auto buckets = c.bucket_count();
+        c.reserve(4 * buckets);
+        if (c.bucket_count() != 4 * buckets || c.size() != 49 || !c.contains(99)) return "reserve";
+
+        c.clear();
+        if (!c.empty() || c.contains(1)) return "clear";
+        if (!c.insert(1, NonTrivial(1)) || !c.contains(1)) return "insert after clear";
+
+        return nullptr;
+    }
+
+    static const char* run_readers_and_writer() {
+        static constexpr int reader_count = 4;
+        static constexpr int keys = 256;
+
+        // NOTE: a value carries its key, so a reader can tell a torn value from a valid one,
+        //       a node that is freed too early is a use after free for the address sanitizer
+        lw_std::read_mostly_map<int, std::pair<int, unsigned>> c;
+        for (int key = 0; key < keys; key += 2)
+            c.insert(key, {key, 0});
+
+        std::atomic<bool> done{false};
+        std::atomic<int> errors{0};
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < reader_count; ++r)
+            readers.emplace_back([&c, &done, &errors, r] {
+                std::pair<int, unsigned> value;
+                for (int i = r; !done.load(); ++i) {
+                    int key = i % keys;
+                    if (c.find(key, value) && value.first != key) errors.fetch_add(1);
+                }
+            });
+
+        // NOTE: inserts grow the table, erases and assignments retire nodes while the readers walk them
+        for (unsigned version = 1; version < 200; ++version)
+            for (int key = 0; key < keys; ++key) {
+                if (key % 3 == 0) {
+                    c.insert_or_assign(key, {key, version});
+                } else if (key % 3 == 1) {
+                    if (version % 2 == 0) c.erase(key);
+                    else c.insert(key, {key, version});
+                }
+            }
+
+        done.store(true);
+        for (auto& reader : readers)
+            reader.join();
+
+        if (errors.load() != 0) return "readers see only valid values";
+
+        std::pair<int, unsigned> value;
+        for (int key = 0; key < keys; ++key) {
+            bool expected = key % 3 == 0 || key % 3 == 1 || key % 2 == 0;
+            if (c.find(key, value) != expected) return "keys after concurrent writes";
+            if (key % 3 == 0 && value.second != 199) return "values after concurrent writes";
+        }
+
+        return nullptr;
+    }
+};
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <ftest/test_logging.hpp>
+#include <thread>
+#include <vector>
+
+#include "intrusive_ptr.hpp"
+#include "memory.hpp"
+
+class TestLwSharedPtr {
+   public:
+    static TestLogging::test_result run() {
+        static_assert(sizeof(lw_std::shared_ptr<int>) == 2 * sizeof(int*) && sizeof(lw_std::weak_ptr<int>) == 2 * sizeof(int*));
+        static_assert(sizeof(lw_std::shared_ptr<int, lw_std::nonatomic_refcount>) == 2 * sizeof(int*));
+
+        int destroyed = 0;
+        {
+            auto p = lw_std::make_shared<tracked>(7, &destroyed);
+            if (p->value != 7 || p.use_count() != 1) return {"make_shared"};
+
+            auto q = p;
+            lw_std::shared_ptr<tracked> r(lw_std::move(q));
+            if (q || p.use_count() != 2 || r != p) return {"copy and move"};
+
+            r.reset();
+            if (p.use_count() != 1 || r != nullptr || destroyed != 0) return {"reset"};
+        }
+        if (destroyed != 1) return {"destructor"};
+
+        // NOTE: the object goes with the last shared_ptr, the control block with the last weak_ptr
+        lw_std::weak_ptr<tracked> weak;
+        {
+            auto p = lw_std::make_shared<tracked>(8, &destroyed);
+            weak = p;
+            auto locked = weak.lock();
+            if (weak.expired() || locked != p || p.use_count() != 2) return {"weak_ptr::lock"};
+        }
+        if (!weak.expired() || weak.lock() || destroyed != 2) return {"weak_ptr of a destroyed object"};
+        if (lw_std::shared_ptr<tracked>(weak)) return {"shared_ptr from an expired weak_ptr"};
+        weak.reset();
+
+        // NOTE: pointers to derived classes, aliasing and casts share the count
+        {
+            lw_std::shared_ptr<base> b = lw_std::make_shared<tracked>(9, &destroyed);
+            auto t = lw_std::static_pointer_cast<tracked>(b);
+            lw_std::shared_ptr<const int> member(t, &t->value);
+            b.reset();
+            t.reset();
+            if (*member != 9 || member.use_count() != 1 || destroyed != 2) return {"aliasing"};
+        }
+        if (destroyed != 3) return {"shared_ptr<base> destroys the derived object"};
+
+        int deleted = 0;
+        {
+            lw_std::shared_ptr<int> p(new int(3), [&deleted](int* ptr) {
+                ++deleted;
+                delete ptr;
+            });
+            lw_std::shared_ptr<int> from_unique = lw_std::make_unique<int>(4);
+            if (*p != 3 || *from_unique != 4 || from_unique.use_count() != 1) return {"shared_ptr from pointers"};
+        }
+        if (deleted != 1) return {"custom deleter"};
+
+        {
+            lw_std::shared_ptr<int, lw_std::nonatomic_refcount> p = lw_std::make_shared<int, lw_std::nonatomic_refcount>(5);
+            lw_std::weak_ptr<int, lw_std::nonatomic_refcount> w = p;
+            auto q = w.lock();
+            if (*q != 5 || p.use_count() != 2) return {"nonatomic_refcount"};
+        }
+
+        for (auto failed : {run_allocate_shared(), run_threads()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_intrusive() {
+        static_assert(sizeof(lw_std::intrusive_ptr<blob>) == sizeof(blob*));
+
+        int destroyed = 0;
+        {
+            auto p = lw_std::make_intrusive<blob>(&destroyed);
+            if (p->use_count() != 1) return {"make_intrusive"};
+
+            // NOTE: the count is in the object, a raw pointer shares it
+            lw_std::intrusive_ptr<const blob> q(p.get());
+            if (p->use_count() != 2 || q != p) return {"intrusive_ptr from a raw pointer"};
+
+            blob copy(*p);
+            if (copy.use_count() != 0) return {"copy of a counted object"};
+
+            const blob* raw = q.detach();
+            if (p->use_count() != 2) return {"detach"};
+            q.reset(raw, false);
+            if (p->use_count() != 2) return {"reset adopting a reference"};
+
+            q.reset();
+            if (p->use_count() != 1 || destroyed != 0) return {"reset"};
+        }
+        if (destroyed != 2) return {"the last intrusive_ptr deletes the object"};
+
+        // NOTE: many threads copying the same pointer, the object is deleted exactly once
+        {
+            auto shared = lw_std::make_intrusive<blob>(&destroyed);
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 4; ++t)
+                threads.emplace_back([shared] {
+                    for (int i = 0; i < 10000; ++i) {
+                        lw_std::intrusive_ptr<blob> copy = shared;
+                        if (copy->use_count() < 2) return;
+                    }
+                });
+            for (auto& thread : threads)
+                thread.join();
+            if (shared->use_count() != 1) return {"intrusive_ptr from threads"};
+        }
+        if (destroyed != 3) return {"intrusive_ptr from threads (destroyed)"};
+
+        return {};
+    }
+
+   private:
+    struct base {
+        virtual ~base() = default;
+    };
+
+    struct tracked : base {
+        tracked(int v, int* count)
+            : value(v), m_destroyed(count) {}
+
+        ~tracked() override {
+            ++*m_destroyed;
+        }
+
+        int value;
+        int* m_destroyed;
+    };
+
+    struct blob : lw_std::intrusive_ref_counter<blob> {
+        explicit blob(int* count)
+            : m_destroyed(count) {}
+
+        blob(const blob& other) = default;
+
+        ~blob() {
+            ++*m_destroyed;
+        }
+
+        int* m_destroyed;
+    };
+
+    // NOTE: stateless, counting what is in use
+    template <typename T>
+    struct counting_allocator : lw_std::allocator<T> {
+        inline static int in_use = 0;
+
+        template <typename U>
+        struct rebind {
+            typedef counting_allocator<U> other;
+        };
+
+        counting_allocator() = default;
+
+        template <typename U>
+        counting_allocator(const counting_allocator<U>&) {}
+
+        T* allocate(size_t n) {
+            ++counting_allocator<char>::in_use;
+            return lw_std::allocator<T>::allocate(n);
+        }
+
+        void deallocate(T* p, size_t n) {
+            --counting_allocator<char>::in_use;
+            lw_std::allocator<T>::deallocate(p, n);
+        }
+    };
+
+    static const char* run_allocate_shared() {
+        int destroyed = 0;
+        lw_std::weak_ptr<tracked> weak;
+        {
+            auto p = lw_std::allocate_shared<tracked>(counting_allocator<char>(), 1, &destroyed);
+            weak = p;
+            if (counting_allocator<char>::in_use != 1) return "allocate_shared: the object and the counts in one allocation";
+        }
+        if (destroyed != 1 || counting_allocator<char>::in_use != 1) return "allocate_shared: a weak_ptr keeps the allocation";
+        weak.reset();
+        if (counting_allocator<char>::in_use != 0) return "allocate_shared: freed through the allocator";
+
+        auto overwrite = lw_std::allocate_shared_for_overwrite<int>(counting_allocator<char>());
+        *overwrite = 2;
+        if (*overwrite != 2 || counting_allocator<char>::in_use != 1) return "allocate_shared_for_overwrite";
+
+        return nullptr;
+    }
+
+    // NOTE: copies and weak_ptr locks from many threads, the object is destroyed exactly once, after the last copy
+    static const char* run_threads() {
+        int destroyed = 0;
+        {
+            auto shared = lw_std::make_shared<tracked>(1, &destroyed);
+            lw_std::weak_ptr<tracked> weak = shared;
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 4; ++t)
+                threads.emplace_back([shared, weak] {
+                    for (int i = 0; i < 10000; ++i) {
+                        lw_std::shared_ptr<tracked> copy = i % 2 == 0 ? shared : weak.lock();
+                        if (copy->value != 1) return;
+                    }
+                });
+            for (auto& thread : threads)
+                thread.join();
+
+            if (shared.use_count() != 1 || destroyed != 0) return "shared_ptr from threads";
+        }
+        if (destroyed != 1) return "shared_ptr from threads (destroyed)";
+
+        return nullptr;
+    }
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <ftest/test_logging.hpp>
+
+#include "span.hpp"
+#include "string.hpp"
+#include "vector.hpp"
+
+class TestLwSpan {
+   public:
+    static TestLogging::test_result run() {
+        static_assert(sizeof(lw_std::span<int, 4>) == sizeof(int*));
+        static_assert(sizeof(lw_std::span<int>) == sizeof(int*) + sizeof(size_t));
+
+        // NOTE: a received frame: 2 byte id, 1 byte length, payload
+        lw_std::vector<uint8_t> frame;
+        for (uint8_t byte : {uint8_t{0x12}, uint8_t{0x34}, uint8_t{5}, uint8_t{'h'}, uint8_t{'e'}, uint8_t{'l'}, uint8_t{'l'}, uint8_t{'o'}})
+            frame.push_back(byte);
+
+        lw_std::span<const uint8_t> bytes = frame;
+        if (bytes.data() != frame.data() || bytes.size() != 8 || bytes.size_bytes() != 8 || bytes.empty()) return {"span of a vector"};
+
+        lw_std::span<const uint8_t, 2> id = bytes.first<2>();
+        static_assert(decltype(id)::extent == 2);
+        if (((id[0] << 8) | id[1]) != 0x1234) return {"first<2>"};
+
+        auto payload = bytes.subspan(3, bytes[2]);
+        if (payload.size() != 5 || payload.front() != 'h' || payload.back() != 'o' || lw_std::as_string_view(payload) != "hello") return {"subspan"};
+        if (bytes.last(2).front() != 'l' || bytes.last<1>()[0] != 'o' || bytes.subspan<3>().size() != 5) return {"last/subspan<Offset>"};
+
+        // NOTE: writes through a span change the vector
+        lw_std::span<uint8_t> writable = frame;
+        writable[0] = 0xAB;
+        for (auto& byte : writable.subspan(3))
+            byte = static_cast<uint8_t>(byte - 'a' + 'A');
+        if (frame[0] != 0xAB || frame[3] != 'H' || frame[7] != 'O') return {"writable span"};
+
+        int numbers[] = {1, 2, 3, 4};
+        lw_std::span fixed = numbers;
+        static_assert(decltype(fixed)::extent == 4);
+        lw_std::span<const int> dynamic = fixed;
+        int sum = 0;
+        for (int x : dynamic)
+            sum += x;
+        if (sum != 10 || dynamic.end() - dynamic.begin() != 4) return {"span of an array"};
+
+        lw_std::string text("abc");
+        lw_std::span<char> chars = text;
+        chars[1] = 'X';
+        if (text != "aXc" || lw_std::as_string_view(chars) != "aXc") return {"span of a string"};
+
+        lw_std::span<int> empty;
+        if (!empty.empty() || empty.data() != nullptr || lw_std::span<int>(numbers, numbers).size() != 0) return {"empty span"};
+
+        return {};
+    }
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <ftest/test_logging.hpp>
+#include <map>
+
+#include "static_search_index.hpp"
+#include "vector.hpp"
+
+class TestLwStaticSearchIndex {
+   public:
+    static TestLogging::test_result run() {
+        // NOTE: every size up to a few full levels, so both complete and partial last levels are covered
+        for (int n = 0; n < 70; ++n) {
+            lw_std::vector<int> keys;
+            lw_std::vector<int> values;
+            std::map<int, int> verify;
+
+            for (int i = 0; i < n; ++i) {
+                keys.push_back(3 * i);
+                values.push_back(-i);
+                verify[3 * i] = -i;
+            }
+
+            lw_std::static_search_index<int, int> index(keys, values);
+
+            if (index.size() != verify.size()) return {"size"};
+
+            auto it = index.begin();
+            for (const auto& [key, value] : verify) {
+                if (it == index.end() || (*it).first != key || (*it).second != value) return {"iteration order"};
+                ++it;
+            }
+            if (it != index.end()) return {"iteration end"};
+
+            for (int key = -1; key <= 3 * n; ++key) {
+                auto expected = verify.lower_bound(key);
+                auto lower = index.lower_bound(key);
+
+                if ((expected == verify.end()) != (lower == index.end())) return {"lower_bound (end)"};
+                if (expected != verify.end() && (lower->first != expected->first || lower->second != expected->second)) return {"lower_bound"};
+
+                auto found = index.find(key);
+                if ((verify.count(key) == 0) != (found == index.end())) return {"find"};
+                if (found != index.end() && found->second != verify[key]) return {"find (value)"};
+                if (index.contains(key) != (verify.count(key) != 0)) return {"contains"};
+            }
+        }
+
+        lw_std::flat_map<int, int> map;
+        map[5] = 50;
+        map[1] = 10;
+        lw_std::static_search_index<int, int> from_map(map);
+        if (from_map.size() != 2 || from_map.find(5)->second != 50 || from_map.begin()->first != 1) return {"from flat_map"};
+
+        return {};
+    }
+};
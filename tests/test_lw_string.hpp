@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstdint>
+#include <ftest/test_logging.hpp>
+#include <random>
+#include <string>
+
+#include "string.hpp"
+
+class TestLwString {
+   public:
+    static TestLogging::test_result run_random(size_t num_operations) {
+        std::mt19937 rng(3);
+        std::uniform_int_distribution<size_t> op_dist(0, 11);
+        std::uniform_int_distribution<size_t> length_dist(0, 40);
+        std::uniform_int_distribution<int> char_dist('a', 'e');
+
+        auto random_std = [&] {
+            std::string res(length_dist(rng), 'a');
+            for (auto& ch : res)
+                ch = static_cast<char>(char_dist(rng));
+            return res;
+        };
+
+        lw_std::string c;
+        std::string expected;
+
+        for (size_t i = 0; i < num_operations; ++i) {
+            std::string s = random_std();
+            size_t pos = expected.empty() ? 0 : rng() % (expected.size() + 1);
+            size_t count = length_dist(rng);
+
+            switch (op_dist(rng)) {
+                case 0:
+                    c.append(s.data(), s.size());
+                    expected.append(s);
+                    break;
+                case 1:
+                    c.push_back(s.empty() ? 'x' : s[0]);
+                    expected.push_back(s.empty() ? 'x' : s[0]);
+                    break;
+                case 2:
+                    c.insert(pos, s.c_str());
+                    expected.insert(pos, s);
+                    break;
+                case 3:
+                    c.erase(pos, count);
+                    expected.erase(pos, count);
+                    break;
+                case 4:
+                    c.replace(pos, count, s.c_str());
+                    expected.replace(pos, count, s);
+                    break;
+                case 5:
+                    c.resize(count, 'z');
+                    expected.resize(count, 'z');
+                    break;
+                case 6:
+                    c = s.c_str();
+                    expected = s;
+                    break;
+                case 7:
+                    c.insert(pos, count % 4, 'y');
+                    expected.insert(pos, count % 4, 'y');
+                    break;
+                case 8:
+                    if (c.substr(pos, count) != expected.substr(pos, count).c_str()) return {"substr"};
+                    break;
+                case 9:
+                    if (c.find(s.c_str(), pos, s.size() % 3) != expected.find(s.c_str(), pos, s.size() % 3)) return {"find"};
+                    if (c.rfind(s.c_str(), pos, s.size() % 3) != expected.rfind(s.c_str(), pos, s.size() % 3)) return {"rfind"};
+                    break;
+                case 10:
+                    if (c.find_first_of(s.c_str(), pos, 2) != expected.find_first_of(s.c_str(), pos, 2)) return {"find_first_of"};
+                    if (c.find_last_not_of(s.c_str(), pos, 2) != expected.find_last_not_of(s.c_str(), pos, 2)) return {"find_last_not_of"};
+                    break;
+                case 11:
+                    if (sign(c.compare(s.c_str())) != sign(expected.compare(s))) return {"compare"};
+                    c.shrink_to_fit();
+                    break;
+            }
+
+            if (c.size() != expected.size() || c.capacity() < c.size() || c.c_str()[c.size()] != '\0') return {"size"};
+            if (std::string(c.data(), c.size()) != expected) return {"content"};
+        }
+
+        return {};
+    }
+
+    static TestLogging::test_result run_small_strings() {
+        static_assert(lw_std::string::sso_capacity == 2 * sizeof(size_t) - 1);
+        static_assert(sizeof(lw_std::string) == 4 * sizeof(size_t));
+
+        lw_std::string c("fits inline");
+        if (!is_inline(c) || c.capacity() != lw_std::string::sso_capacity) return {"short strings are inline"};
+
+        c.append(lw_std::string::sso_capacity - c.size(), '!');
+        if (!is_inline(c) || c.size() != lw_std::string::sso_capacity) return {"full inline buffer"};
+
+        c.push_back('.');
+        if (is_inline(c) || c.capacity() < 2 * lw_std::string::sso_capacity || c.back() != '.') return {"growing moves to the heap"};
+
+        c.erase(4);
+        c.shrink_to_fit();
+        if (!is_inline(c) || c != "fits") return {"shrink_to_fit moves back inline"};
+
+        // NOTE: moving an inline string copies the characters, moving a heap string steals the buffer
+        lw_std::string heap(100, 'h');
+        const char* heap_data = heap.data();
+        lw_std::string moved(lw_std::move(heap));
+        if (moved.data() != heap_data || !heap.empty() || !is_inline(heap) || heap.c_str()[0] != '\0') return {"move (heap)"};
+
+        lw_std::string moved_inline(lw_std::move(c));
+        if (!is_inline(moved_inline) || moved_inline != "fits" || !c.empty()) return {"move (inline)"};
+
+        moved_inline.swap(moved);
+        if (moved_inline.size() != 100 || moved != "fits") return {"swap"};
+
+        // NOTE: the inline capacity is configurable, 23 chars in a string of 40 bytes
+        lw_std::basic_string<char, 23> wide("twenty three characters");
+        if (wide.size() != 23 || !is_inline(wide)) return {"configurable inline capacity"};
+
+        // NOTE: geometric growth, appending char by char reallocates O(log n) times
+        lw_std::string grown;
+        size_t reallocations = 0;
+        for (size_t i = 0; i < 10000; ++i) {
+            const char* before = grown.data();
+            grown.push_back('g');
+            reallocations += before != grown.data() ? size_t{1} : size_t{0};
+        }
+        if (reallocations > 12) return {"geometric growth"};
+
+        lw_std::string reserved;
+        reserved.reserve(1000);
+        const char* reserved_data = reserved.data();
+        for (size_t i = 0; i < 100; ++i)
+            reserved.append("0123456789");
+        if (reserved.data() != reserved_data || reserved.capacity() != 1000) return {"append within the reserved capacity"};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_operations() {
+        // NOTE: arguments that point into the string itself
+        lw_std::string c("abcdef");
+        c.append(c.c_str());
+        if (c != "abcdefabcdef") return {"append (self)"};
+
+        c.append(c.c_str() + 3, 3);
+        if (c != "abcdefabcdefdef") return {"append (part of self)"};
+        c.resize(6);
+        c.insert(3, c.c_str() + 1, 2);
+        if (c != "abcbcdef") return {"insert (self)"};
+
+        c.replace(0, 2, c.c_str() + 4);
+        if (c != "cdefcbcdef") return {"replace (self)"};
+
+        lw_std::string long_string(40, 'x');
+        long_string.append(long_string);
+        if (long_string.size() != 80 || long_string.find_first_not_of('x') != lw_std::string::npos) return {"append (self, reallocating)"};
+
+        // NOTE: concatenation, the rvalue overloads reuse the left buffer
+        lw_std::string a("left");
+        lw_std::string sum = a + " " + lw_std::string("right") + '!';
+        if (sum != "left right!" || "left right!" != sum || !(a < sum) || !(a < "lefz")) return {"operator+"};
+
+        lw_std::string b("\xff");
+        if (!(a < b)) return {"characters compare unsigned"};
+
+        if (!sum.starts_with("left") || !sum.starts_with('l') || sum.starts_with("right")) return {"starts_with"};
+        if (!sum.ends_with("right!") || !sum.ends_with('!') || sum.ends_with("left")) return {"ends_with"};
+        if (!sum.contains("t r") || sum.contains("tr") || !sum.contains('!')) return {"contains"};
+
+        if (sum.find("right") != 5 || sum.find("") != 0 || sum.find("", 11) != 11 || sum.find("", 12) != lw_std::string::npos) return {"find"};
+        if (sum.rfind('t') != 9 || sum.rfind('t', 8) != 3 || sum.rfind('q') != lw_std::string::npos) return {"rfind"};
+        if (sum.find_last_of("ef") != 2 || sum.find_first_not_of("left") != 4) return {"find_first_not_of/find_last_of"};
+
+        if (sum.at(100) != '\0' || sum.at(0) != 'l') return {"at"};
+
+        char buffer[8] = {};
+        if (sum.copy(buffer, 5, 6) != 5 || lw_std::string(buffer) != "ight!") return {"copy"};
+
+        // NOTE: iterator interface and the common erase_if
+        lw_std::string digits("a1b2c3");
+        lw_std::erase_if(digits, [](char ch) { return ch >= '0' && ch <= '9'; });
+        if (digits != "abc") return {"erase_if"};
+
+        digits.insert(digits.begin() + 1, '-');
+        digits.erase(digits.end() - 1);
+        if (digits != "a-b" || lw_std::string(digits.begin(), digits.end()) != digits) return {"iterators"};
+
+        if (lw_std::to_string(0) != "0" || lw_std::to_string(-1234) != "-1234" || lw_std::to_string(INT64_MIN) != "-9223372036854775808") return {"to_string (integer)"};
+        if (lw_std::to_string(UINT64_MAX) != "18446744073709551615" || lw_std::to_string(uint8_t{255}) != "255") return {"to_string (unsigned)"};
+        if (lw_std::to_string(1.5) != "1.500000") return {"to_string (floating point)"};
+
+#ifdef LWSTD_BUILD_STD_COMPATIBILITY
+        std::string std_string = "from std";
+        lw_std::string converted = std_string;
+        if (converted != "from std" || static_cast<std::string>(converted) != std_string) return {"std::string conversion"};
+#endif
+
+        lw_std::u32string wide(3, U'é');
+        wide += U'x';
+        if (wide.size() != 4 || wide.find(U'x') != 3 || wide.compare(U"éééx") != 0) return {"u32string"};
+
+        return {};
+    }
+
+   private:
+    template <typename S>
+    static bool is_inline(const S& s) {
+        auto address = reinterpret_cast<uintptr_t>(s.data());
+        return address >= reinterpret_cast<uintptr_t>(&s) && address < reinterpret_cast<uintptr_t>(&s + 1);
+    }
+
+    static int sign(int x) {
+        return (x > 0) - (x < 0);
+    }
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <ftest/test_logging.hpp>
+#include <string>
+#include <vector>
+
+#include "string.hpp"
+#include "string_interner.hpp"
+#include "unordered_map.hpp"
+
+class TestLwStringInterner {
+   public:
+    static TestLogging::test_result run() {
+        // NOTE: a small block size, so the strings spread over many blocks
+        lw_std::string_interner interner(64);
+        if (!interner.empty() || interner.find("a") || interner.contains("")) return {"empty"};
+
+        lw_std::interned_string temperature = interner.intern("sensor.temperature");
+        lw_std::string name("sensor.");
+        name += "temperature";
+        if (interner.intern(name) != temperature || interner.size() != 1) return {"intern (same characters, same handle)"};
+
+        lw_std::interned_string empty = interner.intern("");
+        if (!empty || !empty.empty() || empty.c_str()[0] != '\0' || empty == lw_std::interned_string()) return {"intern (empty string)"};
+
+        if (temperature.view() != "sensor.temperature" || std::string(temperature.c_str()) != "sensor.temperature" || temperature.size() != 18) return {"view"};
+        if (temperature.hash() != lw_std::hash<lw_std::string_view>{}("sensor.temperature")) return {"precomputed hash"};
+        if (temperature.id() != 0 || empty.id() != 1 || interner.from_id(1) != empty) return {"ids"};
+
+        // NOTE: a handle that refers to no string (default constructed, or not found) has no id
+        lw_std::interned_string missing = interner.find("sensor.humidity");
+        if (missing || missing.id() != lw_std::interned_string::invalid_id || lw_std::interned_string().id() != lw_std::interned_string::invalid_id) return {"id of no string"};
+        if (interner.from_id(lw_std::interned_string::invalid_id) || interner.from_id(2)) return {"from_id (no such id)"};
+
+        // NOTE: handles and their characters stay where they are while the interner grows
+        std::vector<std::string> keys;
+        std::vector<lw_std::interned_string> handles;
+        std::vector<const char*> addresses;
+        for (unsigned i = 0; i < 3000; ++i) {
+            keys.push_back("metric." + std::to_string(i * 7919u) + (i % 5 == 0 ? std::string(100, 'x') : std::string()));
+            handles.push_back(interner.intern(lw_std::string_view(keys.back().data(), keys.back().size())));
+            addresses.push_back(handles.back().c_str());
+        }
+        if (interner.size() != 3002 || interner.arena_bytes() < 3000 * 16) return {"size"};
+
+        for (unsigned i = 0; i < 3000; ++i) {
+            lw_std::string_view key(keys[i].data(), keys[i].size());
+            if (interner.find(key) != handles[i] || interner.intern(key) != handles[i] || handles[i].c_str() != addresses[i]) return {"stable handles"};
+            if (handles[i].view() != key || interner.from_id(handles[i].id()) != handles[i]) return {"stable characters"};
+        }
+        if (interner.size() != 3002 || interner.find("metric.1") || interner.find("metric.7919x")) return {"find (missing)"};
+
+        // NOTE: handles as keys, hashed and compared without touching the characters
+        lw_std::unordered_map<lw_std::interned_string, unsigned> counts;
+        for (unsigned round = 0; round < 3; ++round)
+            for (unsigned i = 0; i < 100; ++i) {
+                auto handle = interner.intern(lw_std::string_view(keys[i].data(), keys[i].size()));
+                auto it = counts.find(handle);
+                if (it == counts.end())
+                    counts.insert({handle, 1u});
+                else
+                    ++it->second;
+            }
+        if (counts.size() != 100 || counts.find(handles[42])->second != 3 || counts.find(temperature) != counts.end()) return {"unordered_map<interned_string>"};
+
+        interner.clear();
+        if (!interner.empty() || interner.arena_bytes() != 0 || interner.find("sensor.temperature")) return {"clear"};
+        if (interner.intern("again").id() != 0 || interner.size() != 1) return {"intern after clear"};
+
+        return {};
+    }
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <ftest/test_logging.hpp>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "functional.hpp"
+#include "string_view.hpp"
+#include "unordered_map.hpp"
+
+class TestLwStringView {
+   public:
+    static TestLogging::test_result run() {
+        static constexpr lw_std::string_view keyword("return");
+        static_assert(keyword.size() == 6 && keyword.starts_with("re") && keyword.find('u') == 3 && keyword.substr(2, 2) == "tu");
+        static_assert(lw_std::hash<lw_std::string_view>{}(keyword) == lw_std::impl::hash_bytes("return", 6));
+
+        // NOTE: a view of a string, no copies
+        lw_std::string text("key=value; other = 42");
+        lw_std::string_view view = text;
+        if (view.data() != text.data() || view.size() != text.size()) return {"view of a string"};
+
+        lw_std::string_view key = view.substr(0, view.find('='));
+        if (key != "key" || "key" != key || key != lw_std::string("key") || key.data() != text.data()) return {"substr"};
+        if (!(key < "kez") || !(key > "ke") || key.compare("key") != 0) return {"compare"};
+
+        lw_std::string_view rest = view;
+        rest.remove_prefix(view.find(';') + 1);
+        rest.remove_suffix(3);
+        if (rest != " other =") return {"remove_prefix/remove_suffix"};
+
+        if (!view.ends_with("42") || view.ends_with('4') || !view.contains("e; o") || view.contains("==")) return {"ends_with/contains"};
+        if (view.rfind("e") != 14 || view.find_first_of("=;") != 3 || view.find_last_not_of("0123456789") != 18) return {"find"};
+        if (view.substr(100).size() != 0 || view.substr(4, 100) != "value; other = 42") return {"substr (clamped)"};
+
+        // NOTE: no exceptions, out of range at gives the last character, or a null character for an empty view
+        static_assert(lw_std::string_view().at(0) == '\0' && keyword.at(100) == 'n');
+        if (view.at(1) != 'e' || view.at(1000) != '2' || lw_std::string_view().at(0) != '\0' || lw_std::string_view(text.data(), size_t{0}).at(5) != '\0') return {"at"};
+
+        // NOTE: strings take views everywhere a const CharT* works
+        lw_std::string built(key);
+        built += lw_std::string_view(":");
+        built.append(view.substr(4, 5));
+        if (built != "key:value" || !built.starts_with(key) || built.find(lw_std::string_view("val")) != 4) return {"string from views"};
+
+        for (auto failed : {run_random(), run_split(), run_hash()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    // NOTE: the searches against std::string_view
+    static const char* run_random() {
+        std::mt19937 rng(4);
+        std::uniform_int_distribution<int> char_dist('a', 'd');
+
+        std::string haystack(200, 'a');
+        for (auto& ch : haystack)
+            ch = static_cast<char>(char_dist(rng));
+
+        lw_std::string_view c(haystack.data(), haystack.size());
+        std::string_view expected(haystack);
+
+        for (size_t i = 0; i < 2000; ++i) {
+            std::string needle(rng() % 4, 'a');
+            for (auto& ch : needle)
+                ch = static_cast<char>(char_dist(rng));
+            size_t pos = rng() % 210;
+
+            lw_std::string_view n(needle.data(), needle.size());
+            if (c.find(n, pos) != expected.find(needle, pos)) return "find (random)";
+            if (c.rfind(n, pos) != expected.rfind(needle, pos)) return "rfind (random)";
+            if (c.find_first_of(n, pos) != expected.find_first_of(needle, pos)) return "find_first_of (random)";
+            if (c.find_last_of(n, pos) != expected.find_last_of(needle, pos)) return "find_last_of (random)";
+            if (c.find_first_not_of(n, pos) != expected.find_first_not_of(needle, pos)) return "find_first_not_of (random)";
+            if (c.find_last_not_of(n, pos) != expected.find_last_not_of(needle, pos)) return "find_last_not_of (random)";
+            if ((c.substr(pos % 200, 8).compare(n) < 0) != (expected.substr(pos % 200, 8).compare(needle) < 0)) return "compare (random)";
+        }
+
+        return nullptr;
+    }
+
+    static const char* run_split() {
+        auto collect = [](auto range) {
+            std::string res;
+            for (lw_std::string_view token : range) {
+                res.append(token.data(), token.size());
+                res.push_back('|');
+            }
+            return res;
+        };
+
+        if (collect(lw_std::split("a,,b,", ",")) != "a||b||") return "split";
+        if (collect(lw_std::split("", ",")) != "|") return "split (empty text)";
+        if (collect(lw_std::split("a::b:c::", "::")) != "a|b:c||") return "split (delimiter sequence)";
+        if (collect(lw_std::split("abc", "")) != "abc|") return "split (empty delimiter)";
+
+        if (collect(lw_std::tokenize("  GET /index.html\tHTTP/1.1 ", " \t")) != "GET|/index.html|HTTP/1.1|") return "tokenize";
+        if (collect(lw_std::tokenize(" \t ", " \t")) != "" || collect(lw_std::tokenize("", " ")) != "") return "tokenize (no tokens)";
+
+        // NOTE: the tokens point into the text
+        lw_std::string line("x=1&y=22");
+        auto fields = lw_std::split(line, "&");
+        auto it = fields.begin();
+        if (it->data() != line.data() + 0 || (++it)->data() != line.data() + 4 || it->size() != 4 || ++it != fields.end()) return "split (views into the text)";
+
+        return nullptr;
+    }
+
+    static const char* run_hash() {
+        // NOTE: views as lookup keys, the strings they point to have to outlive the map
+        static const char* const names[] = {"temperature", "humidity", "pressure"};
+
+        lw_std::unordered_map<lw_std::string_view, int> ids;
+        for (int i = 0; i < 3; ++i)
+            ids.insert({names[i], i});
+
+        lw_std::string frame("pressure=1013");
+        lw_std::string_view name = lw_std::string_view(frame).substr(0, frame.find('='));
+        auto it = ids.find(name);
+        if (it == ids.end() || it->second != 2 || ids.find("wind") != ids.end()) return "unordered_map<string_view>";
+
+        if (lw_std::hash<lw_std::string_view>{}(name) != lw_std::hash<lw_std::string>{}(lw_std::string("pressure"))) return "views and strings hash the same";
+
+        return nullptr;
+    }
+};
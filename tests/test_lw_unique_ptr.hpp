@@ -0,0 +1,139 @@
+#pragma once
+
+#include <ftest/test_logging.hpp>
+
+#include "memory.hpp"
+#include "unordered_map.hpp"
+
+class TestLwUniquePtr {
+   public:
+    static TestLogging::test_result run() {
+        // NOTE: stateless deleters take no space
+        static_assert(sizeof(lw_std::unique_ptr<int>) == sizeof(int*));
+        static_assert(sizeof(lw_std::unique_ptr<int[]>) == sizeof(int*));
+        static_assert(sizeof(lw_std::unique_ptr<int, lw_std::allocator_delete<lw_std::allocator<int>>>) == sizeof(int*));
+        static_assert(sizeof(lw_std::unique_ptr<int, void (*)(int*)>) == 2 * sizeof(int*));
+
+        int deleted = 0;
+        {
+            lw_std::unique_ptr<int, counting_delete> p(new int(5), counting_delete{&deleted});
+            lw_std::unique_ptr<int, counting_delete> q = lw_std::move(p);
+            if (p || !q || *q != 5 || q.get_deleter().count != &deleted) return {"move with a deleter"};
+
+            q.reset(new int(6));
+            if (deleted != 1 || *q != 6) return {"reset calls the deleter"};
+
+            delete q.release();
+            if (q != nullptr || deleted != 1) return {"release"};
+        }
+        if (deleted != 1) return {"destructor of an empty unique_ptr"};
+
+        {
+            lw_std::unique_ptr<int, void (*)(int*)> p(new int(1), [](int* ptr) { delete ptr; });
+            if (*p != 1) return {"function pointer deleter"};
+        }
+
+        auto array = lw_std::make_unique<int[]>(size_t{4});
+        for (size_t i = 0; i < 4; ++i)
+            if (array[i] != 0) return {"make_unique<T[]> value initializes"};
+        array[3] = 7;
+        auto other = lw_std::make_unique_for_overwrite<int[]>(size_t{2});
+        other.swap(array);
+        if (other[3] != 7 || !array) return {"swap of arrays"};
+
+        // NOTE: a unique_ptr to a derived class converts to one to its base
+        lw_std::unique_ptr<base> b = lw_std::make_unique<derived>(&deleted);
+        b.reset();
+        if (deleted != 2) return {"unique_ptr<derived> to unique_ptr<base>"};
+
+        for (auto failed : {run_allocate_unique(), run_container()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    struct counting_delete {
+        int* count;
+
+        void operator()(int* ptr) const {
+            ++*count;
+            delete ptr;
+        }
+    };
+
+    struct base {
+        virtual ~base() = default;
+    };
+
+    struct derived : base {
+        explicit derived(int* count)
+            : m_count(count) {}
+
+        ~derived() override {
+            ++*m_count;
+        }
+
+        int* m_count;
+    };
+
+    // NOTE: a stand-in for a pool allocator, stateless, counting what is in use
+    template <typename T>
+    struct counting_allocator : lw_std::allocator<T> {
+        inline static int in_use = 0;
+
+        template <typename U>
+        struct rebind {
+            typedef counting_allocator<U> other;
+        };
+
+        counting_allocator() = default;
+
+        template <typename U>
+        counting_allocator(const counting_allocator<U>&) {}
+
+        T* allocate(size_t n) {
+            ++in_use;
+            return lw_std::allocator<T>::allocate(n);
+        }
+
+        void deallocate(T* p, size_t n) {
+            --in_use;
+            lw_std::allocator<T>::deallocate(p, n);
+        }
+    };
+
+    static const char* run_allocate_unique() {
+        counting_allocator<char> alloc;
+        {
+            auto p = lw_std::allocate_unique<double>(alloc, 2.5);
+            static_assert(sizeof(p) == sizeof(double*));
+            if (*p != 2.5 || counting_allocator<double>::in_use != 1) return "allocate_unique";
+
+            lw_std::unique_ptr<double, lw_std::allocator_delete<counting_allocator<double>>> q;
+            q = lw_std::move(p);
+            if (counting_allocator<double>::in_use != 1) return "allocate_unique (move)";
+        }
+        if (counting_allocator<double>::in_use != 0) return "allocate_unique frees through the allocator";
+
+        return nullptr;
+    }
+
+    // NOTE: the elements of the hash containers go through their allocator
+    static const char* run_container() {
+        using value_type = lw_std::pair<const int, int>;
+        {
+            lw_std::unordered_map<int, int, lw_std::hash<int>, lw_std::equal_to<int>, counting_allocator<value_type>> map;
+            for (int i = 0; i < 100; ++i)
+                map.emplace(i, i);
+            map.erase(map.find(50));
+
+            auto copy = map;
+            if (copy.size() != 99 || copy.find(7)->second != 7) return "copy of a map with an allocator";
+            if (counting_allocator<value_type>::in_use != 2 * 99) return "elements of a map are allocated through its allocator";
+        }
+        if (counting_allocator<value_type>::in_use != 0) return "elements of a map are freed through its allocator";
+
+        return nullptr;
+    }
+};
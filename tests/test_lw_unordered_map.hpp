@@ -39,6 +39,7 @@ class TestLwUnorderedMap : public ContainerTestDefaultMixin<TestLwUnorderedMap,
         tester.add_shrink_modifier("erase", ContainerTestType::shrink_by_erase_by_iterator_for_map);
         // FIXME: tester.add_shrink_modifier("erase (range)", ContainerTestType::shrink_by_erase_by_range_for_map);
         tester.add_shrink_modifier("erase (value)", ContainerTestType::shrink_by_erase_by_value_for_map);
+        tester.add_shrink_modifier("erase_if", ContainerTestType::shrink_by_erase_if_for_map);
 
         (void)tester.tc().count(0);  // just test if it compiles
         tester.add_verifier("find (existing)", ContainerTestType::verify_find_existing_element_for_map);
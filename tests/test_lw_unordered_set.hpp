@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <unordered_set>
+#include <vector>
 
 #include "compile_accelerators/accelerator_defs.hpp"
 #include "container_test_mixin.hpp"
@@ -9,6 +11,43 @@
 class TestLwUnorderedSet : public ContainerTestDefaultMixin<TestLwUnorderedSet, lw_std::unordered_set, std::unordered_set> {
     friend ContainerTestDefaultMixin;
 
+   public:
+    // NOTE: a big table with only a few elements left, iteration only visits the used buckets
+    static TestLogging::test_result run_sparse() {
+        lw_std::unordered_set<int> c;
+        c.reserve(100000);
+        for (int i = 0; i < 100000; ++i)
+            c.insert(i);
+
+        std::vector<int> kept;
+        for (int i = 0; i < 100000; ++i) {
+            if (i % 9973 == 5)
+                kept.push_back(i);
+            else
+                c.erase(i);
+        }
+
+        std::vector<int> visited(c.begin(), c.end());
+        std::sort(visited.begin(), visited.end());
+        if (visited != kept || c.size() != kept.size()) return {"iteration after mass erase"};
+
+        // NOTE: erasing the first element moves begin() on to the next used bucket
+        while (!c.empty()) {
+            auto it = c.erase(c.begin());
+            if (it != c.begin()) return {"erase(begin()) returns the new begin()"};
+        }
+        if (c.begin() != c.end()) return {"begin() of an emptied table"};
+
+        c.insert(77);
+        c.insert(3);
+        if (std::distance(c.begin(), c.end()) != 2) return {"insert after emptying"};
+
+        const auto& const_c = c;
+        if (*const_c.find(77) != 77 || const_c.find(78) != const_c.end()) return {"find"};
+
+        return {};
+    }
+
    private:
     template <typename ContainerTestType>
     static TestLogging::test_result run_templated(ContainerTestType& tester, size_t operation_count) {
@@ -36,6 +75,7 @@ class TestLwUnorderedSet : public ContainerTestDefaultMixin<TestLwUnorderedSet,
         tester.add_shrink_modifier("erase", ContainerTestType::shrink_by_erase_by_iterator_no_pos);
         // FIXME: tester.add_shrink_modifier("erase (range)", ContainerTestType::shrink_by_erase_by_range_no_pos);
         tester.add_shrink_modifier("erase (value)", ContainerTestType::shrink_by_erase_by_value);
+        tester.add_shrink_modifier("erase_if", ContainerTestType::shrink_by_erase_if_no_pos);
 
         (void)tester.tc().count(0);  // just test if it compiles
         tester.add_verifier("find (existing)", ContainerTestType::verify_find_existing_element);
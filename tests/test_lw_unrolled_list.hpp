@@ -0,0 +1,149 @@
+#pragma once
+
+#include <list>
+#include <vector>
+
+#include "container_test_mixin.hpp"
+#include "unrolled_list.hpp"
+
+// NOTE: a small node capacity, so the operations split and merge nodes all the time
+template <typename T>
+using unrolled_list_4 = lw_std::unrolled_list<T, 4>;
+
+class TestLwUnrolledList : public ContainerTestDefaultMixin<TestLwUnrolledList, unrolled_list_4, std::list> {
+    friend ContainerTestDefaultMixin;
+
+   public:
+    static TestLogging::test_result run_nodes() {
+        for (auto failed : {run_traversal(), run_split_and_merge()})
+            if (failed != nullptr) return {failed};
+
+        return {};
+    }
+
+   private:
+    template <typename List>
+    static bool equals(const List& c, const std::vector<int>& verify) {
+        if (c.size() != verify.size()) return false;
+
+        size_t i = 0;
+        for (int value : c)
+            if (value != verify[i++]) return false;
+
+        // NOTE: backwards across the node boundaries as well
+        auto it = c.end();
+        for (i = verify.size(); i > 0; --i)
+            if (*--it != verify[i - 1]) return false;
+
+        return it == c.begin();
+    }
+
+    static const char* run_traversal() {
+        lw_std::unrolled_list<int, 8> c;
+        std::vector<int> verify;
+        for (int i = 0; i < 100; ++i) {
+            c.push_back(i);
+            verify.push_back(i);
+        }
+
+        if (!equals(c, verify)) return "push_back";
+
+        // NOTE: advance skips whole nodes
+        if (*lw_std::next(c.begin(), 37) != 37 || *lw_std::prev(c.end(), 37) != 63) return "next/prev";
+        if (lw_std::distance(c.begin(), c.end()) != 100) return "distance";
+
+        return nullptr;
+    }
+
+    static const char* run_split_and_merge() {
+        lw_std::unrolled_list<int, 4> c;
+        std::vector<int> verify;
+
+        // NOTE: always in the middle, so every node fills up and splits
+        auto it = c.begin();
+        for (int i = 0; i < 50; ++i) {
+            it = c.insert(lw_std::next(c.begin(), static_cast<ptrdiff_t>(c.size() / 2)), i);
+            verify.insert(verify.begin() + static_cast<ptrdiff_t>(verify.size() / 2), i);
+            if (*it != i) return "insert (returned iterator)";
+        }
+
+        if (!equals(c, verify)) return "insert (split)";
+
+        while (c.size() > 3) {
+            auto pos = static_cast<ptrdiff_t>(c.size() / 3);
+            it = c.erase(lw_std::next(c.begin(), pos));
+            verify.erase(verify.begin() + pos);
+            if (*it != verify[static_cast<size_t>(pos)]) return "erase (returned iterator)";
+        }
+
+        if (!equals(c, verify)) return "erase (merge)";
+
+        c.assign(20, 1);
+        if (c.remove(1) != 20 || !c.empty() || c.begin() != c.end()) return "remove (all)";
+
+        for (int i = 0; i < 20; ++i)
+            c.push_back(i);
+        verify.clear();
+        for (int i = 0; i < 20; ++i)
+            if (i % 3 == 0) verify.push_back(i);
+
+        if (c.remove_if([](int x) { return x % 3 != 0; }) != 13 || !equals(c, verify)) return "remove_if";
+
+        return nullptr;
+    }
+
+    template <typename ContainerTestType>
+    static TestLogging::test_result run_templated(ContainerTestType& tester, size_t operation_count) {
+        tester.set_test_container_size_getter(ContainerTestType::default_test_container_size_getter);
+        tester.set_verify_container_size_getter(ContainerTestType::default_verify_container_size_getter);
+
+        tester.set_test_container_printer(ContainerTestType::default_test_container_printer);
+        tester.set_verify_container_printer(ContainerTestType::default_verify_container_printer);
+
+        tester.add_neutral_modifier("operator=(const T&)", ContainerTestType::modify_by_copy);
+        tester.add_neutral_modifier("operator=(T&&)", ContainerTestType::modify_by_move);
+
+        tester.add_neutral_modifier("assign", ContainerTestType::modify_by_assign);
+        tester.add_neutral_modifier("assign (range)", ContainerTestType::modify_by_assign_range);
+
+        tester.add_verifier("front", ContainerTestType::verify_front);
+        tester.add_verifier("back", ContainerTestType::verify_back);
+
+        tester.add_verifier("element position (iterator)", ContainerTestType::verify_element_position_with_iterator);
+
+        (void)tester.tc().empty();  // just test if it compiles
+        tester.add_verifier("size", ContainerTestType::verify_size);
+        (void)tester.tc().max_size();  // just test if it compiles
+
+        tester.add_shrink_modifier("clear", ContainerTestType::shrink_by_clear);
+
+        tester.add_grow_modifier("insert", ContainerTestType::grow_by_insert);
+        tester.add_grow_modifier("insert (rvalue)", ContainerTestType::grow_by_insert_rvalue);
+        tester.add_grow_modifier("insert (count)", ContainerTestType::grow_by_insert_count);
+        tester.add_grow_modifier("insert (range)", ContainerTestType::grow_by_insert_range);
+
+        tester.add_grow_modifier("emplace", ContainerTestType::grow_by_emplace);
+
+        tester.add_shrink_modifier("erase", ContainerTestType::shrink_by_erase_by_iterator);
+        tester.add_shrink_modifier("erase (range)", ContainerTestType::shrink_by_erase_by_range);
+        tester.add_shrink_modifier("erase (free)", ContainerTestType::shrink_by_erase_free);
+        tester.add_shrink_modifier("erase_if", ContainerTestType::shrink_by_erase_if);
+        tester.add_shrink_modifier("remove", ContainerTestType::shrink_by_remove);
+
+        tester.add_grow_modifier("push_back", ContainerTestType::grow_by_push_back);
+        tester.add_grow_modifier("push_back (rvalue)", ContainerTestType::grow_by_push_back_rvalue);
+
+        tester.add_grow_modifier("emplace_back", ContainerTestType::grow_by_emplace_back);
+
+        tester.add_shrink_modifier("pop_back", ContainerTestType::shrink_by_pop_back);
+
+        tester.add_grow_modifier("push_front", ContainerTestType::grow_by_push_front);
+        tester.add_grow_modifier("push_front (rvalue)", ContainerTestType::grow_by_push_front_rvalue);
+
+        tester.add_grow_modifier("emplace_front", ContainerTestType::grow_by_emplace_front);
+
+        tester.add_shrink_modifier("pop_front", ContainerTestType::shrink_by_pop_front);
+
+        return tester.run_operations(operation_count);
+    }
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "compile_accelerators/accelerator_defs.hpp"
@@ -9,6 +10,69 @@
 class TestLwVector : public ContainerTestDefaultMixin<TestLwVector, lw_std::vector, std::vector> {
     friend ContainerTestDefaultMixin;
 
+   public:
+    static TestLogging::test_result run_resize() {
+        lw_std::vector<uint8_t> buffer(3, uint8_t{5});
+        buffer.resize_for_overwrite(1000);
+        if (buffer.size() != 1000 || buffer[0] != 5 || buffer[2] != 5) return {"resize_for_overwrite keeps the old elements"};
+
+        buffer.resize_for_overwrite(2);
+        if (buffer.size() != 2 || buffer.capacity() < 1000) return {"resize_for_overwrite (shrink)"};
+
+        // NOTE: the zero fill path
+        buffer.resize(500);
+        for (size_t i = 2; i < 500; ++i)
+            if (buffer[i] != 0) return {"resize zero fills"};
+
+        buffer.resize(600, uint8_t{9});
+        if (buffer[499] != 0 || buffer[500] != 9 || buffer[599] != 9) return {"resize (value) fills"};
+
+        lw_std::vector<int*> pointers;
+        pointers.resize(10);
+        for (auto* pointer : pointers)
+            if (pointer != nullptr) return {"resize (pointers)"};
+
+        // NOTE: types with a constructor are still constructed
+        lw_std::vector<NonTrivial> non_trivial;
+        non_trivial.resize_for_overwrite(10);
+        for (const auto& element : non_trivial)
+            if (element.data() != -1u) return {"resize_for_overwrite constructs non trivial types"};
+
+        lw_std::vector<int> aliased(1, 3);
+        aliased.resize(100, aliased[0]);
+        if (aliased[99] != 3) return {"resize (value) with an element of the vector"};
+
+        return {};
+    }
+
+    static TestLogging::test_result run_emplace() {
+        auto& counters = NonTrivial::counters();
+
+        lw_std::vector<NonTrivial> c;
+        c.reserve(16);
+        for (unsigned i = 0; i < 8; ++i)
+            c.emplace_back(i);
+
+        // NOTE: the 6 elements after the position move one slot, the new one is constructed in place
+        counters = {};
+        c.emplace(c.begin() + 2, 42u);
+        if (counters.constructions != 1 || counters.copies != 0 || counters.moves != 6 || counters.destructions != 1) return {"emplace in the middle constructs in place"};
+        if (c.size() != 9 || c[1].data() != 1 || c[2].data() != 42 || c[3].data() != 2 || c[8].data() != 7) return {"emplace in the middle"};
+
+        // NOTE: when full every element is moved once into the new storage
+        c.shrink_to_fit();
+        counters = {};
+        c.emplace(c.begin() + 4, 43u);
+        if (counters.constructions != 1 || counters.copies != 0 || counters.moves != 9) return {"emplace in the middle (reallocating)"};
+        if (c.size() != 10 || c[3].data() != 2 || c[4].data() != 43 || c[5].data() != 3 || c[9].data() != 7) return {"emplace in the middle (reallocating)"};
+
+        c.reserve(32);
+        c.insert(c.begin(), c.back());
+        if (c.size() != 11 || c[0].data() != 7 || c[10].data() != 7 || c[1].data() != 0) return {"insert of an element of the vector"};
+
+        return {};
+    }
+
    private:
     template <typename ContainerTestType>
     static TestLogging::test_result run_templated(ContainerTestType& tester, size_t operation_count) {
@@ -52,6 +116,8 @@ class TestLwVector : public ContainerTestDefaultMixin<TestLwVector, lw_std::vect
 
         tester.add_shrink_modifier("erase", ContainerTestType::shrink_by_erase_by_iterator);
         tester.add_shrink_modifier("erase (range)", ContainerTestType::shrink_by_erase_by_range);
+        tester.add_shrink_modifier("erase (free)", ContainerTestType::shrink_by_erase_free);
+        tester.add_shrink_modifier("erase_if", ContainerTestType::shrink_by_erase_if);
 
         tester.add_grow_modifier("push_back", ContainerTestType::grow_by_push_back);
         tester.add_grow_modifier("push_back (rvalue)", ContainerTestType::grow_by_push_back_rvalue);
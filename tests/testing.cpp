@@ -1,10 +1,31 @@
 #include <ftest/test_logging.hpp>
 
+#include "test_lw_algorithm.hpp"
+#include "test_lw_arena_list.hpp"
+#include "test_lw_charconv.hpp"
+#include "test_lw_concurrent_unordered_map.hpp"
+#include "test_lw_dynamic_bitset.hpp"
+#include "test_lw_flat_map.hpp"
+#include "test_lw_flat_set.hpp"
+#include "test_lw_forward_list.hpp"
+#include "test_lw_frozen_map.hpp"
+#include "test_lw_frozen_set.hpp"
+#include "test_lw_intrusive_list.hpp"
+#include "test_lw_iterator.hpp"
 #include "test_lw_list.hpp"
 #include "test_lw_pair.hpp"
 #include "test_lw_queue.hpp"
+#include "test_lw_read_mostly_map.hpp"
+#include "test_lw_shared_ptr.hpp"
+#include "test_lw_span.hpp"
+#include "test_lw_static_search_index.hpp"
+#include "test_lw_string.hpp"
+#include "test_lw_string_interner.hpp"
+#include "test_lw_string_view.hpp"
+#include "test_lw_unique_ptr.hpp"
 #include "test_lw_unordered_map.hpp"
 #include "test_lw_unordered_set.hpp"
+#include "test_lw_unrolled_list.hpp"
 #include "test_lw_vector.hpp"
 
 int main() {
@@ -12,21 +33,71 @@ int main() {
 
     TestLogging::start_suite("lw_std");
 
+    TestLogging::run("binary search", TestLwAlgorithm::run_binary_search);
+    TestLogging::run("vectorized find/count/equal", TestLwAlgorithm::run_vectorized);
+    TestLogging::run("comparison", TestLwAlgorithm::run_comparison);
+
+    TestLogging::run("iterator", TestLwIterator::run);
+
     TestLogging::run("vector<int>", TestLwVector::run_with_int, num_operations);
     TestLogging::run("vector<NonTrivial>", TestLwVector::run_with_non_trivial, num_operations);
+    TestLogging::run("vector resize", TestLwVector::run_resize);
+    TestLogging::run("vector emplace", TestLwVector::run_emplace);
+    TestLogging::run("vector<bool>", TestLwDynamicBitset::run_vector_bool);
+
+    TestLogging::run("string", TestLwString::run_random, num_operations);
+    TestLogging::run("string small string optimization", TestLwString::run_small_strings);
+    TestLogging::run("string operations", TestLwString::run_operations);
+    TestLogging::run("string_view", TestLwStringView::run);
+    TestLogging::run("span", TestLwSpan::run);
+    TestLogging::run("string_interner", TestLwStringInterner::run);
+    TestLogging::run("charconv integers", TestLwCharconv::run_integers);
+    TestLogging::run("charconv floating point", TestLwCharconv::run_floating_point);
+    TestLogging::run("charconv append_chars", TestLwCharconv::run_append);
 
     TestLogging::run("list<int>", TestLwList::run_with_int, num_operations);
     TestLogging::run("list<NonTrivial", TestLwList::run_with_non_trivial, num_operations);
+    TestLogging::run("list operations", TestLwList::run_operations);
+    TestLogging::run("forward_list<NonTrivial>", TestLwForwardList::run, num_operations);
+    TestLogging::run("forward_list operations", TestLwForwardList::run_operations);
+    TestLogging::run("intrusive_list", TestLwIntrusiveList::run);
+
+    TestLogging::run("unrolled_list<int>", TestLwUnrolledList::run_with_int, num_operations);
+    TestLogging::run("unrolled_list<NonTrivial>", TestLwUnrolledList::run_with_non_trivial, num_operations);
+    TestLogging::run("unrolled_list nodes", TestLwUnrolledList::run_nodes);
+
+    TestLogging::run("arena_list<int>", TestLwArenaList::run_with_int, num_operations);
+    TestLogging::run("arena_list<NonTrivial>", TestLwArenaList::run_with_non_trivial, num_operations);
+    TestLogging::run("arena_list arena", TestLwArenaList::run_arena);
 
     TestLogging::run("pair", TestLwPair::run);
+    TestLogging::run("unique_ptr", TestLwUniquePtr::run);
+    TestLogging::run("shared_ptr", TestLwSharedPtr::run);
+    TestLogging::run("intrusive_ptr", TestLwSharedPtr::run_intrusive);
 
     TestLogging::run("queue<int>", TestLwQueue::run_with_int, num_operations);
     TestLogging::run("queue<NonTrivial>", TestLwQueue::run_with_non_trivial, num_operations);
 
     TestLogging::run("unordered_set<int>", TestLwUnorderedSet::run_with_int, num_operations);
+    TestLogging::run("unordered_set sparse iteration", TestLwUnorderedSet::run_sparse);
 
     TestLogging::run("unordered_map<int, int>", TestLwUnorderedMap::run_with_int_int, num_operations);
     TestLogging::run("unordered_map<int, NonTrivial>", TestLwUnorderedMap::run_with_int_non_trivial, num_operations);
 
+    TestLogging::run("concurrent_unordered_map", TestLwConcurrentUnorderedMap::run);
+    TestLogging::run("read_mostly_map", TestLwReadMostlyMap::run);
+
+    TestLogging::run("flat_set<int>", TestLwFlatSet::run_with_int, num_operations);
+
+    TestLogging::run("flat_map<int, int>", TestLwFlatMap::run_with_int_int, num_operations);
+    TestLogging::run("flat_map<int, NonTrivial>", TestLwFlatMap::run_with_int_non_trivial, num_operations);
+
+    TestLogging::run("static_search_index", TestLwStaticSearchIndex::run);
+
+    TestLogging::run("frozen_map", TestLwFrozenMap::run);
+    TestLogging::run("frozen_set", TestLwFrozenSet::run);
+
+    TestLogging::run("dynamic_bitset", TestLwDynamicBitset::run);
+
     return TestLogging::results();
 }
\ No newline at end of file